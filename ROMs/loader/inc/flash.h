@@ -0,0 +1,18 @@
+
+#ifndef _FLASH_H
+#define _FLASH_H
+
+__sfr __at 0x4C FLASH_CTRL;
+__sfr __at 0x4D FLASH_DATA;
+
+#define FLASH_nCS 0x01
+#define FLASH_nWP 0x02
+
+#define EnableFlash()  (FLASH_CTRL = 0x00)
+#define DisableFlash() (FLASH_CTRL = FLASH_nCS)
+
+void FlashWritePage(unsigned char *pBuffer);
+void FlashReadPage(unsigned char *pBuffer);
+unsigned int FlashVerifyPage(unsigned char *pBuffer);
+
+#endif	/* _FLASH_H */
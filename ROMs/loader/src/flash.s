@@ -0,0 +1,65 @@
+	.module flash
+	.optsdcc -mz80
+
+	.area	_CODE
+
+FLASH_DATA = 0x4D
+
+; Every IN or OUT on FLASH_DATA clocks one byte through the
+; configuration flash (rtl/peripheral/spiflash.vhd), so a whole
+; 256-byte page goes with one OTIR or INIR. The flash must be
+; selected and the command and address already sent.
+
+; ------------------------------------------------
+; Send 256 bytes (one page program)
+; ------------------------------------------------
+; void FlashWritePage(unsigned char *pBuffer)
+_FlashWritePage::
+	ld		iy, #0
+	add		iy, sp
+	ld		l, 2(iy)
+	ld		h, 3(iy)
+	ld		bc, #FLASH_DATA				; B = 0, 256 bytes
+	otir
+	ret
+
+; ------------------------------------------------
+; Receive 256 bytes (one page read)
+; ------------------------------------------------
+; void FlashReadPage(unsigned char *pBuffer)
+_FlashReadPage::
+	ld		iy, #0
+	add		iy, sp
+	ld		l, 2(iy)
+	ld		h, 3(iy)
+	ld		bc, #FLASH_DATA				; B = 0, 256 bytes
+	inir
+	ret
+
+; ------------------------------------------------
+; Receive 256 bytes and compare them with the buffer,
+; stops at the first difference
+; ------------------------------------------------
+; unsigned int FlashVerifyPage(unsigned char *pBuffer)
+; returns the number of bytes equal before the first
+; difference, 256 if the whole page is equal
+_FlashVerifyPage::
+	ld		iy, #0
+	add		iy, sp
+	ld		l, 2(iy)
+	ld		h, 3(iy)
+	ld		bc, #FLASH_DATA				; B = 0, 256 bytes
+.vloop:
+	in		a, (c)
+	cp		(hl)
+	jr		nz, .vdiff
+	inc		hl
+	djnz	.vloop
+	ld		hl, #256					; page equal
+	ret
+.vdiff:
+	xor		a							; bytes equal = (256 - B) & 0xFF
+	sub		b
+	ld		l, a
+	ld		h, #0
+	ret
@@ -8,28 +8,18 @@
 #include "vdp.h"
 #include "mmc.h"
 #include "fat.h"
+#include "flash.h"
 
 // DEFINES /////////////////////////////////////////////////////////////////////
 
 #define peek16(A)  (*(volatile unsigned int*)(A))
 #define poke16(A,V) *(volatile unsigned int*)(A)=(V)
 
-#define nCS   0x01
-#define  SCLK 0x02
-#define  MOSI 0x04
-#define nWP   0x08
-#define nHOLD 0x10
-
-#define  CS   0x00
-#define nSCLK 0x00
-#define nMOSI 0x00
-#define  WP   0x00
-#define  HOLD 0x00
-
 #define FI_32KB_BLOCK_ERASE                          0x52
 #define FI_64KB_BLOCK_ERASE                          0xD8
 #define FI_PAGE_PROGRAM                              0x02
 #define FI_READ_DATA                                 0x03
+#define FI_FAST_READ                                 0x0B
 #define FI_READ_STATUS_REGISTER_1                    0x05
 #define FI_READ_STATUS_REGISTER_2                    0x35
 #define FI_READ_STATUS_REGISTER_3                    0x15
@@ -46,7 +36,6 @@
 __sfr __at 0x55 CONFIG;
 __sfr __at 0x56 STATUS;
 __sfr __at 0x58 MACHID;
-__sfr __at 0x59 FLASH ;
 
 // CONSTANTS ///////////////////////////////////////////////////////////////////
 
@@ -101,6 +90,7 @@ void printCenter(unsigned char y, unsigned char *msg)
 void erro(unsigned char *erro)
 {
 	DisableCard();
+	DisableFlash();
 	vdp_setcolor(COLOR_RED, COLOR_BLACK, COLOR_WHITE);
 	printCenter(12, erro);
 	for (;;);
@@ -148,111 +138,171 @@ void startExtCart()
 
 unsigned char fiWR(unsigned char ir, unsigned char wc, unsigned char rc, unsigned char h, unsigned char m, unsigned char l, unsigned char d)
 {
-	signed char i;
-	int j;
-	unsigned char bi;
+	unsigned char bi = 0;
 
-//	MODE 0 (DRIVE CLOCK LOW WHILE NOT CS) & WP
+//	ASSERT CS, WP STAYS ASSERTED
 
-	FLASH = nHOLD |  WP | nMOSI | nSCLK | nCS;
+	EnableFlash();
 
-//	ASSERT CS
+//	1ST BYTE (INSTRUCTION)
 
-	FLASH = nHOLD |  WP | nMOSI | nSCLK |  CS;
+	FLASH_DATA = ir;
 
-//	1ST BYTE (INSTRUCTION)
+//	2ND TO 5TH BYTE
 
-	for (i = 7; i >= 0; i--)
-	{
-		bi = ((ir >> i) & 1) << 2;
-		FLASH = nHOLD |  WP | bi    | nSCLK |  CS;
-		FLASH = nHOLD |  WP | bi    |  SCLK |  CS;
-	}
+	if (wc >= 1) FLASH_DATA = h;
+	if (wc >= 2) FLASH_DATA = m;
+	if (wc >= 3) FLASH_DATA = l;
+	if (wc == 4) FLASH_DATA = d;
 
-//	2ND BYTE
+//	PAGE DATA
 
-	if (wc >= 1)
-	for (i = 7; i >= 0; i--)
-	{
-		bi = ((h >> i) & 1) << 2;
-		FLASH = nHOLD |  WP | bi    | nSCLK |  CS;
-		FLASH = nHOLD |  WP | bi    |  SCLK |  CS;
-	}
+	if (wc == 255) FlashWritePage(pbios);
+	if (rc == 255) FlashReadPage(pbios);
 
-//	3RD BYTE
+	if (rc == 1) bi = FLASH_DATA;
 
-	if (wc >= 2)
-	for (i = 7; i >= 0; i--)
-	{
-		bi = ((m >> i) & 1) << 2;
-		FLASH = nHOLD |  WP | bi    | nSCLK |  CS;
-		FLASH = nHOLD |  WP | bi    |  SCLK |  CS;
-	}
+	DisableFlash();
 
-//	4TH BYTE
+	return bi;
+}
 
-	if (wc >= 3)
-	for (i = 7; i >= 0; i--)
-	{
-		bi = ((l >> i) & 1) << 2;
-		FLASH = nHOLD |  WP | bi    | nSCLK |  CS;
-		FLASH = nHOLD |  WP | bi    |  SCLK |  CS;
-	}
+// FLASH INTERFACE WAIT ////////////////////////////////////////////////////////
 
-//	5TH BYTE
+void fiWait(void)
+{
+	unsigned char sr1;
 
-	if (wc == 4)
+	do
 	{
-		for (i = 7; i >= 0; i--)
-		{
-			bi = ((d >> i) & 1) << 2;
-			FLASH = nHOLD |  WP | bi    | nSCLK |  CS;
-			FLASH = nHOLD |  WP | bi    |  SCLK |  CS;
-		}
+		sr1 = fiWR(FI_READ_STATUS_REGISTER_1, 0, 1, 0, 0, 0, 0);
 	}
-	
-	if (wc == 255)
+	while (sr1 & 1);
+}
+
+// FLASH INTERFACE FAST READ //////////////////////////////////////////////////
+
+//	Select the flash and start a FAST_READ at h:m:l. The data then
+//	streams out of FLASH_DATA, across pages and sectors, until the
+//	flash is deselected.
+
+void fiFastRead(unsigned char h, unsigned char m, unsigned char l)
+{
+	EnableFlash();
+	FLASH_DATA = FI_FAST_READ;
+	FLASH_DATA = h;
+	FLASH_DATA = m;
+	FLASH_DATA = l;
+	FLASH_DATA = 0;		// dummy byte
+}
+
+// FLASH INTERFACE SECTOR COMPARE /////////////////////////////////////////////
+
+//	Compare the 4K sector at h:m:00 with the 16 pages at 0x8000.
+//	Returns 1 if equal.
+
+unsigned char fiSectorEqual(unsigned char h, unsigned char m)
+{
+	unsigned char p;
+
+	fiFastRead(h, m, 0);
+	for (p = 0; p < 16; p++)
+		if (FlashVerifyPage((unsigned char *) 0x8000 + (p << 8)) != 256)
+			break;
+	DisableFlash();
+
+	return p == 16;
+}
+
+// FLASH INTERFACE IMAGE VERIFY ////////////////////////////////////////////////
+
+//	Read the whole core back with one FAST_READ and compare it with the
+//	file on the SD card, 512 bytes at a time. Stops with the address of
+//	the first byte that differs. 'V' = 4K verified
+
+void fiVerify(fileTYPE *file, unsigned int blocks)
+{
+	unsigned char *pb = (unsigned char *) 0x8000;
+	unsigned int   i16, n;
+	unsigned long  addr;
+
+	fiFastRead(0, 0, 0);
+
+	for (i16 = 0; i16 < blocks; i16++)
 	{
-		for (j = 0; j < 256; j++)
+		if (!FileRead(file, pb))
+			erro("READ ERR");
+
+		n = FlashVerifyPage(pb);
+		if (n == 256)
+			n += FlashVerifyPage(pb + 256);
+
+		if (n != 512)
 		{
-			for (i = 7; i >= 0; i--)
-			{
-				bi = ((pbios[j] >> i) & 1) << 2;
-				FLASH = nHOLD |  WP | bi    | nSCLK |  CS;
-				FLASH = nHOLD |  WP | bi    |  SCLK |  CS;
-			}
+			addr = ((unsigned long) i16 << 9) + n;
+			strcpy(msg, "VERIFY ERR ");
+			byte = addr >> 16;
+			byte2bcd();
+			strcat(msg, bcd);
+			byte = addr >> 8;
+			byte2bcd();
+			strcat(msg, bcd);
+			byte = addr;
+			byte2bcd();
+			strcat(msg, bcd);
+			erro(msg);
 		}
+
+		if ((i16 & 7) == 7) vdp_putchar('V');
 	}
 
-	if (rc == 1)
+	DisableFlash();
+}
+
+// PHX HEADER CHECK ////////////////////////////////////////////////////////////
+
+//	The PHX header has the header version at 12-13 and, from version 1 on,
+//	a CRC-32 of bytes 00-1B at 1C-1F (little-endian, the zlib CRC).
+//	Version 0 headers from the older BIN2PHX have no CRC and always pass.
+//	Returns 0 only for a version 1 header whose CRC is wrong.
+
+unsigned char phxHeaderOk(unsigned char *h)
+{
+	unsigned long crc = 0xFFFFFFFF;
+	unsigned char i, b;
+
+	if (h[0x12] != 1 || h[0x13] != 0)
+		return 1;
+
+	for (i = 0; i < 0x1C; i++)
 	{
-		bi = 0;
-		for (i = 7; i >= 0; i--)
-		{
-			FLASH = nHOLD |  WP | nMOSI | nSCLK |  CS;
-			bi <<= 1;
-			bi |= FLASH & 1;
-			if (i) FLASH = nHOLD |  WP | nMOSI |  SCLK |  CS;
-		}
+		crc ^= h[i];
+		for (b = 0; b < 8; b++)
+			crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
 	}
 
-	FLASH = nHOLD |  WP | bi | nSCLK |  CS;
-	FLASH = nHOLD |  WP | bi | nSCLK | nCS;
-
-	return bi;
+	return ~crc == *(unsigned long *) (h + 0x1C);
 }
 
-// FLASH INTERFACE WAIT ////////////////////////////////////////////////////////
+// FLASH INTERFACE SECTOR WRITE ////////////////////////////////////////////////
 
-void fiWait(void)
+//	Erase the 4K sector at h:m:00 and program it with the 16 pages at 0x8000
+
+void fiSectorWrite(unsigned char h, unsigned char m)
 {
-	unsigned char sr1;
+	unsigned char p;
 
-	do
+	fiWR(FI_WRITE_ENABLE, 0, 0, 0, 0, 0, 0);
+	fiWR(FI_SECTOR_ERASE, 3, 0, h, m, 0, 0);
+	fiWait();
+
+	for (p = 0; p < 16; p++)
 	{
-		sr1 = fiWR(FI_READ_STATUS_REGISTER_1, 0, 1, 0, 0, 0, 0);
+		pbios = (unsigned char *) 0x8000 + (p << 8);
+		fiWR(FI_WRITE_ENABLE,   0, 0, 0, 0, 0, 0);
+		fiWR(FI_PAGE_PROGRAM, 255, 0, h, m | p, 0, 0);
+		fiWait();
 	}
-	while (sr1 & 1);
 }
 
 // DUMP STRING + BCD ///////////////////////////////////////////////////////////
@@ -338,52 +388,66 @@ void main()
 //		erro("3: WRONG CORE SIZE");
 ///		goto skipcore;
 
-	vdp_gotoxy(0, 2);
-
-	for (i = 0; i < 8; i++)
-	{
-		vdp_putchar('E');
-		fiWR(FI_WRITE_ENABLE    , 0, 0, 0, 0, 0, 0);
-		fiWR(FI_64KB_BLOCK_ERASE, 3, 0, i, 0, 0, 0);
-		fiWait();
-	}
-
-//	Read 16 blocks of 512 bytes (8192 bytes)
+//	Check the PHX header CRC before any sector is erased, so a damaged
+//	header leaves the flash as it is. Cores mastered before the CRC was
+//	added (header version 0) are flashed as before and rely on the
+//	readback. The data CRC at 18-1B is not checked: it would take a
+//	second pass over the file, and the readback below compares the flash
+//	with the file byte for byte.
+
+	pbios = (unsigned char *) 0x8000;
+	if (!FileRead(&file, pbios))
+		erro("READ ERR");
+	if (!phxHeaderOk(pbios))
+		erro("BAD CORE");
+	if (!FileOpen(&file, corefile))
+		erro("NO CORE");
 
-//	0000-039F
-//	0000-073E
+//	116 sectors of 4K (475136 bytes), 8 SD blocks each. A sector is
+//	only erased and programmed when the flash differs from the file,
+//	so an update that changes the boot ROM rewrites a few sectors only.
+//	'.' = sector unchanged, 'W' = sector rewritten and verified
 
-	vdp_gotoxy(0, 4);
+	vdp_gotoxy(0, 2);
 
 	CONFIG = 3;
+	byte = 0;
 
-	for (i16 = 0; i16 < 928; i16++)
+	for (i = 0; i < 116; i++)
 	{
 		pbios = (unsigned char *) 0x8000;
-		if (!FileRead(&file, pbios))
-			erro("READ ERR");
+		for (i16 = 0; i16 < 8; i16++)
+		{
+			if (!FileRead(&file, pbios))
+				erro("READ ERR");
+			pbios += 512;
+		}
 
-		if ((i16 & 1) == 0) vdp_putchar('W');
-		fiWR(FI_WRITE_ENABLE,   0, 0, 0, 0, 0, 0);
-		fiWR(FI_PAGE_PROGRAM, 255, 0, (i16 << 1) >> 8, (i16 << 1) & 0xFF, 0, 0);
-		fiWait();
-		pbios = (unsigned char *) 0x8100;
-		fiWR(FI_WRITE_ENABLE,   0, 0, 0, 0, 0, 0);
-		fiWR(FI_PAGE_PROGRAM, 255, 0, (i16 << 1) >> 8, ((i16 << 1) & 0xFF) | 1, 0, 0);
-		fiWait();
+		if (fiSectorEqual(i >> 4, (i & 0x0F) << 4))
+		{
+			vdp_putchar('.');
+			continue;
+		}
 
+		vdp_putchar('W');
+		fiSectorWrite(i >> 4, (i & 0x0F) << 4);
+		if (!fiSectorEqual(i >> 4, (i & 0x0F) << 4))
+			erro("VERIFY ERR");
+		byte++;
 	}
 
-//	fiWR(FI_WRITE_DISABLE, 0, 0, 0, 0, 0, 0);
+	dump(21, "SECTORS WRITTEN:");
 
-	byte = fiWR(FI_READ_DATA, 3, 1, 0, 0, 0x11, 0);
-	dump(22, "11:");
-/*
-	byte = pbios[0x11];
-	dump(23, "BB:");
-*/
-//	byte = fiWR(FI_READ_DATA, 3, 1, 0, 0, 0, 0);
-//	dump(16, "PP:");
+//	Full readback of the image against the file, on every update
+
+	if (!FileOpen(&file, corefile))
+		erro("NO CORE");
+
+	vdp_gotoxy(0, 7);
+	fiVerify(&file, 928);
+
+	strcpy(msg, "VERIFY OK");
+	printCenter(22, msg);
 
 	strcpy(msg, "OK");
 	printCenter(20, msg);
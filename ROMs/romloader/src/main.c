@@ -330,7 +330,9 @@ disp_hex(uint8_t d)
 //
 //   >56  xxxxxx_W (W) SD-card CE_n (AKA SS_n), 0=enable
 //        xxxxxxW_ (W) SD-card speed, 1=400KHz, 0=12MHz
-//        RxxxxxRR (R) SD-card card-detect, bit >80 1=card inserted
+//        xxxWxxxx (W) SD-card CRC restart, 1=check the next 512+2 bytes read
+//        RxxRxxRR (R) SD-card card-detect, bit >80 1=card inserted
+//                     SD-card CRC, bit >10 1=data block and CRC read, CRC good
 //   
 //   >57  WWWWWWWW (W) SD-card Data Write
 //        RRRRRRRR (R) SD-card Data Read
@@ -341,6 +343,9 @@ disp_hex(uint8_t d)
 #define CK_FAST                 0x00
 #define CE_OFF                  0x01
 #define CE_ON                   0x00
+#define CRC_RESTART             0x10
+#define CRC_OK                  0x10
+#define SD_READ_RETRIES         3
 #define R1_IDLE                 0x01
 #define R1_READY                0x00
 #define NODATA                  0xFF
@@ -454,7 +459,8 @@ enum SD_CARD_ERROR {
     SD_BAD_SSC_READ,
     SD_SET_BSIZE_FAILED,
     SD_READ_BLOCK_FAILED,
-    SD_TOKEN_TIMEOUT
+    SD_TOKEN_TIMEOUT,
+    SD_CRC_ERROR
 };
 
 #define ADDR_BYTE   0
@@ -797,24 +803,14 @@ sd_card_init(void)
 
 
 /**
- * Read a 512 byte block from SD-card to CPU RAM or VRAM.
- *
- * If the dst parameter is 0x0000, the destination will be VRAM.
- *
- * For a VRAM copy, the caller must set up the destination VRAM address prior
- * to calling this function.
+ * Read a 512 byte block from SD-card to CPU RAM or VRAM, once.
  *
- * @note This function uses the FAST clock speed, assuming that the card has
- * been properly initialized.
- *
- * @param[in] block_addr    The 512-byte SD-card block address to read.
- * @param[in] dst           The destination address to write the data, or NULL
- *                          for a VRAM copy.
+ * See sd_read_block().
  *
  * @return SD_CARD_OK on success, otherwise CARD_ERROR enum error value.
  */
 uint8_t
-sd_read_block(uint32_t block_addr, uint8_t *dst)
+sd_read_block_once(uint32_t block_addr, uint8_t *dst)
 {
     if ( g_sd_addr_size == ADDR_BYTE ) {
         block_addr *= 512;
@@ -866,6 +862,10 @@ sd_read_block(uint32_t block_addr, uint8_t *dst)
         return SD_TOKEN_TIMEOUT;
     }
 
+    // The hardware runs the data and the card's CRC through a CRC-16 as
+    // they are read, so the check costs nothing here.
+    SD_CTRL_PORT = CK_FAST | CE_ON | CRC_RESTART;
+
     // Start token received, 512 data bytes follow.
     // The C compiler does not do a very good job of using the CPU's block
     // data movement instructions.  This loop could be much faster if it
@@ -890,15 +890,60 @@ sd_read_block(uint32_t block_addr, uint8_t *dst)
         }
     }
 
-    // Consume the 16-bit CRC from the card.
+    // Consume the 16-bit CRC from the card, which completes the check.
     d = SD_DATA_PORT;
     d = SD_DATA_PORT;
 
+    d = SD_CTRL_PORT;
     SD_CTRL_PORT = CK_FAST | CE_OFF;
     eop = SD_DATA_PORT; // required end-of-op 8-clocks
 
+    if ( (d & CRC_OK) == 0 ) {
+        return SD_CRC_ERROR;
+    }
+
     return SD_CARD_OK;
 }
+// sd_read_block_once()
+
+
+/**
+ * Read a 512 byte block from SD-card to CPU RAM or VRAM.
+ *
+ * If the dst parameter is 0x0000, the destination will be VRAM.
+ *
+ * For a VRAM copy, the caller must set up the destination VRAM address prior
+ * to calling this function.
+ *
+ * A failed read to CPU RAM is tried again, up to SD_READ_RETRIES times.  A
+ * VRAM copy is only tried once, since the VRAM address belongs to the caller.
+ *
+ * @note This function uses the FAST clock speed, assuming that the card has
+ * been properly initialized.
+ *
+ * @param[in] block_addr    The 512-byte SD-card block address to read.
+ * @param[in] dst           The destination address to write the data, or NULL
+ *                          for a VRAM copy.
+ *
+ * @return SD_CARD_OK on success, otherwise CARD_ERROR enum error value.
+ */
+uint8_t
+sd_read_block(uint32_t block_addr, uint8_t *dst)
+{
+    uint8_t rtn;
+    uint8_t retry;
+
+    for ( retry = SD_READ_RETRIES ; retry > 0 ; retry-- )
+    {
+        rtn = sd_read_block_once(block_addr, dst);
+
+        if ( rtn == SD_CARD_OK || dst == 0 ) {
+            break;
+        }
+    }
+
+    return rtn;
+}
 // sd_read_block()
 
 
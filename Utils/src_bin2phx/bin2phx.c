@@ -35,6 +35,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // INCLUDES ////////////////////////////////////////////////////////////////////
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -51,17 +52,25 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define HEADER_SIZE PAGE_SIZE
 #define NAME_SIZE   (16)
 
+#define HEADER_VERSION 1
+
 // GLOBALS /////////////////////////////////////////////////////////////////////
 
-struct
+struct header_s
 {
 	char    name[NAME_SIZE];
 	uint8_t issue[2];
-	uint8_t reserved[HEADER_SIZE - (NAME_SIZE + 2)];
+	uint8_t version[2];
+	uint8_t length[4];
+	uint8_t crc[4];
+	uint8_t header_crc[4];
+	uint8_t reserved[HEADER_SIZE - (NAME_SIZE + 16)];
 } header;
 
 uint8_t sector[SECTOR_SIZE];
 
+uint32_t crc_table[256];
+
 FILE *fi, *fo, *fx;
 
 // CLEANUP /////////////////////////////////////////////////////////////////////
@@ -82,19 +91,100 @@ void abend(char *error)
 	exit(EXIT_FAILURE);
 }
 
+// CRC-32 //////////////////////////////////////////////////////////////////////
+
+// IEEE 802.3 polynomial, reflected, as used by zlib and ZIP.
+
+void crc32_init(void)
+{
+	for (uint32_t i = 0; i < 256; i++)
+	{
+		uint32_t c = i;
+		for (int k = 0; k < 8; k++)
+			c = (c & 1) ? (c >> 1) ^ 0xEDB88320 : c >> 1;
+		crc_table[i] = c;
+	}
+}
+
+uint32_t crc32_update(uint32_t crc, const uint8_t *p, size_t n)
+{
+	crc = ~crc;
+	while (n--) crc = crc_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+// LITTLE-ENDIAN FIELDS ////////////////////////////////////////////////////////
+
+void put32(uint8_t *p, uint32_t v)
+{
+	p[0] = v & 0xFF;
+	p[1] = (v >>  8) & 0xFF;
+	p[2] = (v >> 16) & 0xFF;
+	p[3] = v >> 24;
+}
+
+uint32_t get32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// VERIFY //////////////////////////////////////////////////////////////////////
+
+// Checks a PHX file in one pass: the header CRC, then the length and CRC of
+// everything after the header.
+
+int verify(char *name)
+{
+	if (!(fi = fopen(name, "rb"))) abend("CANNOT OPEN CORE FILE");
+
+	if (!fread(&header, HEADER_SIZE, 1, fi)) abend("CORE FILE HEADER READ ERROR");
+
+	if ((header.version[0] | (header.version[1] << 8)) < HEADER_VERSION)
+		abend("NO CHECKSUM IN CORE FILE HEADER");
+
+	if (get32(header.header_crc) !=
+	    crc32_update(0, (uint8_t *)&header, offsetof(struct header_s, header_crc)))
+		abend("CORE FILE HEADER CRC MISMATCH");
+
+	uint32_t length = 0;
+	uint32_t crc = 0;
+	size_t n;
+
+	while ((n = fread(sector, 1, SECTOR_SIZE, fi)) > 0)
+	{
+		crc = crc32_update(crc, sector, n);
+		length += n;
+	}
+	if (ferror(fi)) abend("CORE FILE READ ERROR");
+
+	if (length != get32(header.length)) abend("CORE FILE LENGTH MISMATCH");
+	if (crc != get32(header.crc)) abend("CORE FILE CRC MISMATCH");
+
+	printf("%.16s ISSUE %u, %u BYTES, CRC %08X OK\n",
+		header.name, header.issue[0] | (header.issue[1] << 8),
+		(unsigned)length, (unsigned)crc);
+
+	cleanup();
+	return EXIT_SUCCESS;
+}
+
 // MAIN ////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char **argv)
 {
 //	BANNER
 
-	printf("BIN2PHX 1.2\n");
+	printf("BIN2PHX 1.3\n");
 	printf("PHOENIX PHX CORE FILE MASTERING\n");
 	printf("DEEP-FRIED BY MADONNA MARK III\n");
 	printf("COPYRIGHT 2019 SILICON SEX\n\n");
 
+	crc32_init();
+
 //	ARGUMENTS
 
+	if ((argc == 3) && !strcmp(argv[1], "--verify")) return verify(argv[2]);
+
 	if ((argc != 5) && (argc != 6)) abend("WRONG NUMBER OF ARGUMENTS");
 
 	if (!(fi = fopen(argv[1], "rb"))) abend("CANNOT OPEN SOURCE FILE");
@@ -132,6 +222,11 @@ int main(int argc, char **argv)
 	header.issue[0] = ((uint16_t)issue) & 0xFF;
 	header.issue[1] = ((uint16_t)issue) >> 8;
 
+	header.version[0] = HEADER_VERSION;
+
+	uint32_t length = 0;
+	uint32_t crc = 0;
+
 //	BITSTREAM
 
 	for (size_t i = 0; i < BITSTREAM_SIZE / SECTOR_SIZE; i++)
@@ -146,6 +241,9 @@ int main(int argc, char **argv)
 				if (ferror(fi)) abend("SOURCE FILE READ ERROR");
 			if (!fwrite(sector, SECTOR_SIZE, 1, fo))
 				abend("TARGET FILE HEADER WRITE ERROR");
+
+			crc = crc32_update(crc, sector + HEADER_SIZE, SECTOR_SIZE - HEADER_SIZE);
+			length += SECTOR_SIZE - HEADER_SIZE;
 		}
 		else
 		{
@@ -153,6 +251,9 @@ int main(int argc, char **argv)
 				if (ferror(fi)) abend("SOURCE FILE READ ERROR");
 			if (!fwrite(sector, SECTOR_SIZE, 1, fo))
 				abend("TARGET FILE BITSTREAM WRITE ERROR");
+
+			crc = crc32_update(crc, sector, SECTOR_SIZE);
+			length += SECTOR_SIZE;
 		}
 	}
 
@@ -170,9 +271,24 @@ int main(int argc, char **argv)
 				if (ferror(fx)) abend("EXTRA DATA FILE READ ERROR");
 			if (!fwrite(sector, SECTOR_SIZE, 1, fo))
 				abend("TARGET FILE EXTRA DATA WRITE ERROR");
+
+			crc = crc32_update(crc, sector, SECTOR_SIZE);
+			length += SECTOR_SIZE;
 		}
 	}
 
+//	HEADER: CHECKSUMS
+
+	put32(header.length, length);
+	put32(header.crc, crc);
+	put32(header.header_crc,
+		crc32_update(0, (uint8_t *)&header, offsetof(struct header_s, header_crc)));
+
+	if (fseek(fo, 0, SEEK_SET) || !fwrite(&header, HEADER_SIZE, 1, fo))
+		abend("TARGET FILE HEADER WRITE ERROR");
+
+	printf("%u BYTES, CRC %08X\n", (unsigned)length, (unsigned)crc);
+
 //	CLEANUP
 
 	cleanup();
@@ -3,21 +3,63 @@
  *
  * Borrowed from:
  * https://github.com/sadman/zxuno-mirror/blob/master/firmware/roms/Bit2Bin.c
+ *
+ * The .bit header is read as tagged fields instead of fixed hops:
+ *
+ *   2-byte length, magic 0F F0 0F F0 0F F0 0F F0 00
+ *   2-byte count, always 1
+ *   'a' 2-byte length, design name (and bitgen options)
+ *   'b' 2-byte length, part
+ *   'c' 2-byte length, date
+ *   'd' 2-byte length, time
+ *   'e' 4-byte length, configuration data
+ *
+ * All lengths are big-endian and the strings are NUL terminated.  The data is
+ * copied through a 16K buffer, so any length works, then padded with zeros to
+ * a multiple of 16K and to at least 21 blocks (336K) as before.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#define BLOCK       0x4000
+#define MIN_BLOCKS  21
+
 FILE *fi, *fo;
-int i, length;
-unsigned char mem[0x4000];
-unsigned short j;
+char *outname;
+unsigned char mem[BLOCK];
+char field[4][256];
+const char *field_name[4]= { "Design", "Part", "Date", "Time" };
+
+void fail(const char *msg) {
+  printf("\n%s\n", msg);
+  if( fo )
+    fclose(fo),
+    remove(outname);
+  exit(-1);
+}
+
+unsigned long get_be(int n, const char *what) {
+  unsigned long v= 0;
+  int c;
+  while( n-- ) {
+    if( (c= fgetc(fi))==EOF )
+      printf("\nTruncated bit file reading %s\n", what),
+      exit(-1);
+    v= v<<8 | c;
+  }
+  return v;
+}
 
 int main(int argc, char *argv[]) {
+  static const unsigned char magic[9]= { 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00 };
+  unsigned long i, j, length, blocks, done;
+  int key, last= 0;
+
   if( argc==1 )
     printf("\n"
-    "Bit2Bin v0.02, strip .bit header and align binary to 16k, 2016-02-23\n\n"
+    "Bit2Bin v0.03, strip .bit header and align binary to 16k, 2016-02-23\n\n"
     "  Bit2Bin        <input_file> <output_file>\n\n"
     "  <input_file>   Input BIT file\n"
     "  <output_file>  Output BIN file\n\n"
@@ -30,41 +72,69 @@ int main(int argc, char *argv[]) {
   if( !fi )
     printf("\nInput file not found: %s\n", argv[1]),
     exit(-1);
-  fseek(fi, 0, SEEK_END);
-  i= ftell(fi);
-  fseek(fi, 0, SEEK_SET);
-  fread(mem, 1, 2, fi);
-  i-= (j= mem[1]|mem[0]<<8)+4;
-  fread(mem, 1, j+2, fi);
-  i-= (j= mem[j+1]|mem[j]<<8)+3;
-  fread(mem, 1, j+3, fi);
-  i-= (j= mem[j+1]|mem[j]<<8)+3;
-  fread(mem, 1, j+3, fi);
-  i-= (j= mem[j+1]|mem[j]<<8)+3;
-  fread(mem, 1, j+3, fi);
-  i-= (j= mem[j+1]|mem[j]<<8)+3;
-  fread(mem, 1, j+3, fi);
-  i-= (j= mem[j+1]|mem[j]<<8)+4;
-  fread(mem, 1, j+4, fi);
-  length= mem[j+3]|mem[j+2]<<8|mem[j+1]<<16|mem[j]<<24;
-  if( i!=length )
-    printf("\nInvalid file length\n"),
-    exit(-1);
-  fo= fopen(argv[2], "wb+");
+
+  if( get_be(2, "header")!=sizeof magic
+   || fread(mem, 1, sizeof magic, fi)!=sizeof magic
+   || memcmp(mem, magic, sizeof magic) )
+    fail("Not a Xilinx bit file");
+  if( get_be(2, "header")!=1 )
+    fail("Invalid bit file header");
+
+  // fields a..d in order, each optional, then the data
+  while( (key= (int)get_be(1, "field key"))!='e' ) {
+    if( key<'a' || key>'d' )
+      printf("\nUnknown bit file field '%c' (0x%02X)\n", key, key),
+      exit(-1);
+    if( key<=last )
+      printf("\nBit file field '%c' out of order\n", key),
+      exit(-1);
+    last= key;
+    j= get_be(2, "field length");
+    for ( i= 0; i<j; i++ ) {
+      int c= fgetc(fi);
+      if( c==EOF )
+        fail("Truncated bit file reading a header field");
+      if( i<sizeof field[0]-1 )
+        field[key-'a'][i]= c;
+    }
+  }
+  length= get_be(4, "data length");
+
+  for ( i= 0; i<4; i++ )
+    if( field[i][0] )
+      printf("%-7s %s\n", field_name[i], field[i]);
+  printf("Length  %lu\n", length);
+
+  outname= argv[2];
+  fo= fopen(outname, "wb+");
   if( !fo )
     printf("\nCannot create output file: %s\n", argv[2]),
     exit(-1);
-  j= i>>14;
-  if( j )
-    for ( i= 0; i<j; i++ )
-      fread(mem, 1, 0x4000, fi),
-      fwrite(mem, 1, 0x4000, fo);
-  memset(mem, 0, 0x4000);
-  fread(mem, 1, length&0x3fff, fi),
-  fwrite(mem, 1, 0x4000, fo);
-  memset(mem, 0, 0x4000);
-  for ( i= 0; i<20-j; i++ )
-    fwrite(mem, 1, 0x4000, fo);
+
+  // copy the data, a short read means the file is truncated
+  for ( done= 0; done<length; done+= j ) {
+    j= length-done<BLOCK ? length-done : BLOCK;
+    if( fread(mem, 1, j, fi)!=j )
+      fail("Bit file is shorter than its data length");
+    if( fwrite(mem, 1, j, fo)!=j )
+      fail("Cannot write output file");
+  }
+  if( fgetc(fi)!=EOF )
+    fail("Bit file has extra bytes after the data");
+
+  // pad to 16K, a whole block when already aligned, and the minimum size
+  blocks= length/BLOCK+1;
+  if( blocks<MIN_BLOCKS )
+    blocks= MIN_BLOCKS;
+  memset(mem, 0, BLOCK);
+  for ( j= blocks*BLOCK-length; j; j-= i ) {
+    i= j<BLOCK ? j : BLOCK;
+    if( fwrite(mem, 1, i, fo)!=i )
+      fail("Cannot write output file");
+  }
+  if( fclose(fo) )
+    printf("\nCannot write output file: %s\n", argv[2]),
+    exit(-1);
   printf("\nFile generated successfully\n");
-  fclose(fo);
+  return 0;
 }
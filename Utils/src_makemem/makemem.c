@@ -3,6 +3,14 @@
  * the Xilinx data2mem tool for merging into a bit-stream, or to generate
  * VHDL BlockRAM initialization syntax to copy-n-paste into a source file.
  *
+ * It can also write Intel HEX, Verilog $readmemh, Xilinx COE and a VHDL
+ * package with the ROM as a constant array, for simulation testbenches and
+ * BRAM cores.
+ *
+ * The whole ROM is read at once and each 16-byte line is formatted in a
+ * buffer with a hex lookup table, then written in large blocks, so a 512K
+ * image converts as quickly as the 24K boot ROM.
+ *
  * Matthew Hagerty, June 2019, Public Domain.
  *
  * Unix/MinGW:
@@ -11,8 +19,215 @@
  * Vistual Studio:
  * cl /W4 makemem.c
  */
-#include <stdio.h>              // printf
-#include <stdlib.h>             // fopen, fclose, fgetc, fputc
+#include <stdio.h>              // printf, fopen, fread, fwrite
+#include <stdlib.h>             // malloc, free
+#include <string.h>             // memcpy, strlen, strrchr
+
+#define OUT_BUF     65536       // output is written in blocks of this size
+#define LINE_BYTES  16
+
+static FILE *dst;
+static char outbuf[OUT_BUF];
+static int outlen;
+static int outerr;
+static char hex[256][2];
+
+static void
+flush(void)
+{
+    if ( outlen > 0 && fwrite(outbuf, 1, outlen, dst) != (size_t)outlen ) {
+        outerr = 1;
+    }
+    outlen = 0;
+}
+
+// Add text to the output buffer, no more than 256 bytes at a time. The
+// buffer is flushed before text that would not fit, never after, so the
+// text just added can still be trimmed or patched in outbuf.
+static void
+put(const char *s, int n)
+{
+    if ( outlen + n > OUT_BUF ) {
+        flush();
+    }
+    memcpy(outbuf + outlen, s, n);
+    outlen += n;
+}
+
+static void
+puts_(const char *s)
+{
+    put(s, strlen(s));
+}
+
+// One line of hex bytes: pre, 2 hex digits, post, for each byte.
+static void
+hexline(const unsigned char *p, int n, const char *pre, const char *post)
+{
+    char line[256];
+    int len = 0;
+    int lpre = strlen(pre);
+    int lpost = strlen(post);
+
+    for ( int i = 0; i < n; i++ )
+    {
+        memcpy(line + len, pre, lpre);
+        len += lpre;
+        line[len++] = hex[p[i]][0];
+        line[len++] = hex[p[i]][1];
+        memcpy(line + len, post, lpost);
+        len += lpost;
+    }
+
+    put(line, len);
+}
+
+// data2mem MEM, an address line every 2K.
+static void
+mem_format(const unsigned char *rom, long size)
+{
+    char adr[24];
+
+    for ( long cnt = 0; cnt < size; cnt += LINE_BYTES )
+    {
+        int n = size - cnt < LINE_BYTES ? size - cnt : LINE_BYTES;
+
+        if ( (cnt % 2048) == 0 ) {
+            put(adr, sprintf(adr, "@%04lX\n", cnt));
+        }
+
+        hexline(rom + cnt, n, "", " ");
+        if ( n == LINE_BYTES ) {
+            put("\n", 1);
+        }
+    }
+}
+
+// VHDL values to paste into a BRAM initialization.
+static void
+vhdl_format(const unsigned char *rom, long size)
+{
+    for ( long cnt = 0; cnt < size; cnt += LINE_BYTES )
+    {
+        int n = size - cnt < LINE_BYTES ? size - cnt : LINE_BYTES;
+
+        hexline(rom + cnt, n, "x\"", "\",");
+        if ( n == LINE_BYTES ) {
+            put("\n", 1);
+        }
+    }
+}
+
+// Intel HEX, 16-byte data records and an extended linear address record
+// every 64K.
+static void
+ihex_format(const unsigned char *rom, long size)
+{
+    char rec[64];
+
+    for ( long cnt = 0; cnt < size; cnt += LINE_BYTES )
+    {
+        int n = size - cnt < LINE_BYTES ? size - cnt : LINE_BYTES;
+        unsigned sum;
+
+        if ( (cnt & 0xFFFF) == 0 && cnt > 0 ) {
+            sum = 2 + 4 + (cnt >> 24) + ((cnt >> 16) & 0xFF);
+            put(rec, sprintf(rec, ":02000004%04lX%02X\n", cnt >> 16, (-sum) & 0xFF));
+        }
+
+        sum = n + ((cnt >> 8) & 0xFF) + (cnt & 0xFF);
+        put(rec, sprintf(rec, ":%02X%04lX00", n, cnt & 0xFFFF));
+        for ( int i = 0; i < n; i++ ) {
+            sum += rom[cnt + i];
+        }
+        hexline(rom + cnt, n, "", "");
+        put(rec, sprintf(rec, "%02X\n", (-sum) & 0xFF));
+    }
+
+    puts_(":00000001FF\n");
+}
+
+// Verilog $readmemh, 16 bytes per line.
+static void
+readmemh_format(const unsigned char *rom, long size)
+{
+    puts_("@0\n");
+
+    for ( long cnt = 0; cnt < size; cnt += LINE_BYTES )
+    {
+        int n = size - cnt < LINE_BYTES ? size - cnt : LINE_BYTES;
+
+        hexline(rom + cnt, n, "", " ");
+        outlen--;               // no space at the end of the line
+        put("\n", 1);
+    }
+}
+
+// Xilinx CORE Generator COE file.
+static void
+coe_format(const unsigned char *rom, long size)
+{
+    puts_("memory_initialization_radix=16;\n");
+    puts_("memory_initialization_vector=\n");
+
+    for ( long cnt = 0; cnt < size; cnt += LINE_BYTES )
+    {
+        int n = size - cnt < LINE_BYTES ? size - cnt : LINE_BYTES;
+
+        hexline(rom + cnt, n, "", ",");
+        if ( cnt + n == size ) {
+            outbuf[outlen - 1] = ';';
+        }
+        put("\n", 1);
+    }
+}
+
+// VHDL package with the ROM as a constant array, named after the output
+// file: rom.vhd gives package rom_pkg, type rom_t and constant rom_c.
+static void
+package_format(const unsigned char *rom, long size, const char *file)
+{
+    char name[64];
+    char line[256];
+    const char *base = file;
+    int len = 0;
+
+    for ( const char *p = file; *p; p++ ) {
+        if ( *p == '/' || *p == '\\' || *p == ':' ) {
+            base = p + 1;
+        }
+    }
+
+    if ( !((*base >= 'a' && *base <= 'z') || (*base >= 'A' && *base <= 'Z')) ) {
+        len = sprintf(name, "rom_");
+    }
+
+    for ( ; *base && *base != '.' && len < 48; base++ )
+    {
+        char c = *base;
+        name[len++] = ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                       (c >= '0' && c <= '9')) ? c : '_';
+    }
+    name[len] = '\0';
+
+    puts_("library ieee;\nuse ieee.std_logic_1164.all;\n\n");
+    put(line, sprintf(line, "package %s_pkg is\n\n", name));
+    put(line, sprintf(line,
+        "   type %s_t is array (0 to %ld) of std_logic_vector(7 downto 0);\n\n", name, size - 1));
+    put(line, sprintf(line, "   constant %s_c : %s_t := (\n", name, name));
+
+    for ( long cnt = 0; cnt < size; cnt += LINE_BYTES )
+    {
+        int n = size - cnt < LINE_BYTES ? size - cnt : LINE_BYTES;
+
+        put("      ", 6);
+        hexline(rom + cnt, n, "x\"", "\", ");
+        outlen -= (cnt + n == size) ? 2 : 1;    // no comma after the last
+        put("\n", 1);
+    }
+
+    puts_("   );\n\nend package;\n");
+}
 
 int
 main(int argc, char *argv[])
@@ -20,12 +235,16 @@ main(int argc, char *argv[])
     if ( argc != 4 )
     {
         printf(
-        "makemem by Matthew Hagerty, version 1.0\n\n"
+        "makemem by Matthew Hagerty, version 1.1\n\n"
         "Convert a binary ROM file into a data2mem or VHDL code format.\n\n"
         "Use: makemem <format> <input rom file> <output mem file>\n\n"
         "format options:\n"
         "  m  - MEM format for data2mem\n"
         "  v  - VHDL format to include in source code for BRAM initialization\n"
+        "  h  - Intel HEX\n"
+        "  r  - Verilog $readmemh\n"
+        "  c  - Xilinx COE for CORE Generator memories\n"
+        "  p  - VHDL package with a constant array, named after the output file\n"
         "\n"
         );
 
@@ -33,47 +252,66 @@ main(int argc, char *argv[])
     }
 
     char type = argv[1][0];
+    int ret = 1;
+    unsigned char *rom = NULL;
+    long size = 0;
 
     FILE *src = fopen(argv[2], "rb");
-    FILE *dst = fopen(argv[3], "wb");
+    dst = NULL;
 
     if ( src == NULL ) {
         printf("Error, could not open input file: [%s]\n", argv[2]);
         goto DONE;
     }
 
+    // Read the whole ROM.
+    fseek(src, 0, SEEK_END);
+    size = ftell(src);
+    fseek(src, 0, SEEK_SET);
+
+    rom = malloc(size > 0 ? size : 1);
+    if ( rom == NULL || (size > 0 && fread(rom, 1, size, src) != (size_t)size) ) {
+        printf("Error, could not read input file: [%s]\n", argv[2]);
+        goto DONE;
+    }
+
+    dst = fopen(argv[3], "wb");
+
     if ( dst == NULL ) {
         printf("Error, could not open or create output file: [%s]\n", argv[3]);
         goto DONE;
     }
 
-    int c;
-    int cnt = 0;
-    char b2h[] = {"0123456789ABCDEF"};
+    for ( int i = 0; i < 256; i++ ) {
+        hex[i][0] = "0123456789ABCDEF"[i >> 4];
+        hex[i][1] = "0123456789ABCDEF"[i & 0xF];
+    }
 
-    while ( (c = fgetc(src)) != EOF )
+    switch ( type )
     {
-        if ( type == 'v' ) {
-            fprintf(dst, "x\"%c%c\",", b2h[(c>>4)], b2h[(c&0xF)]);
-        }
-
-        else
-        {
-            if ( (cnt % 2048) == 0 ) {
-                fprintf(dst, "@%04X\n", cnt);
-            }
+        case 'v': vhdl_format(rom, size);               break;
+        case 'h': ihex_format(rom, size);               break;
+        case 'r': readmemh_format(rom, size);           break;
+        case 'c': coe_format(rom, size);                break;
+        case 'p': package_format(rom, size, argv[3]);   break;
+        default:  mem_format(rom, size);                break;
+    }
 
-            fprintf(dst, "%c%c ", b2h[(c>>4)], b2h[(c&0xF)]);
-        }
+    flush();
 
-        cnt++;
-        if ( (cnt % 16) == 0 ) {
-            fputc('\n', dst);
-        }
+    if ( outerr ) {
+        printf("Error, could not write output file: [%s]\n", argv[3]);
+        goto DONE;
     }
 
+    ret = 0;
+
     DONE:
 
+    if ( rom != NULL ) {
+        free(rom);
+    }
+
     if ( src != NULL ) {
         fclose(src);
     }
@@ -82,6 +320,6 @@ main(int argc, char *argv[])
         fclose(dst);
     }
 
-    return 0;
+    return ret;
 }
 // main()
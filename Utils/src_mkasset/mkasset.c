@@ -0,0 +1,519 @@
+/**
+ * Utility to convert boot menu graphics into C source for the Phoenix menu,
+ * compressed with one of the codecs the menu has a Z80 decoder for
+ * (gameMenus/coleco/src/vdp_unpack.c, and vdp_unlz.c for lz).
+ *
+ * Several assets can go into one output file, so newmap2.c and mattfont.c
+ * can both be regenerated with it. Each asset gets the usual HEADERS__
+ * block with an extern and a SIZE_OF_<name><codec> define.
+ *
+ * Input files ending in .pbm (P1 or P4, width a multiple of 8) are cut
+ * into 8x8 tiles left to right, top to bottom, one pattern per tile. Any
+ * other file is taken as raw bytes (a Magellan export, a .bin, etc).
+ *
+ * Codecs:
+ *  raw - straight copy, for vdpmemcpy
+ *  rle - the existing PAT0 RLE, for unrle()
+ *        top two msbits are flags, low 6 bits are the length-1:
+ *        00 - run of zeros, 01 - run of 0xff, 10 - run of next byte,
+ *        11 - inline string
+ *  lz  - byte oriented LZ77 over the last 256 bytes, for unlz()
+ *        0lllllll             - l+1 literal bytes follow
+ *        1lllllll oooooooo    - copy l+3 bytes from o+1 bytes back
+ *        PAT0 is smaller as rle, so unlz() isn't built into the menu
+ *        until an asset uses lz.
+ *
+ * Both encoders do an optimal parse, and every asset is decoded again and
+ * compared before anything is written. The sizes for all codecs are
+ * printed so it's easy to see which one wins.
+ *
+ * Unix/MinGW:
+ * gcc -Wall -O2 -o mkasset mkasset.c
+ */
+#include <stdio.h>              // printf, fopen
+#include <stdlib.h>             // malloc, free
+#include <string.h>             // strcmp, strrchr, memcmp
+
+#define MAX_ASSET   16384       // all of VRAM
+
+#define RLE_MAX     64
+#define LZ_LIT_MAX  128
+#define LZ_MIN      3
+#define LZ_MAX      130
+#define LZ_WINDOW   256
+
+typedef struct {
+    const char *name;           // codec name on the command line
+    const char *suffix;         // appended to SIZE_OF_<name>
+    const char *comment;        // first line of the array
+    int (*encode)(const unsigned char *in, int n, unsigned char *out);
+    int (*decode)(const unsigned char *in, int n, unsigned char *out);
+} CODEC;
+
+// ---- raw ----
+
+static int
+raw_encode(const unsigned char *in, int n, unsigned char *out)
+{
+    memcpy(out, in, n);
+    return n;
+}
+
+static int
+raw_decode(const unsigned char *in, int n, unsigned char *out)
+{
+    memcpy(out, in, n);
+    return n;
+}
+
+// ---- rle ----
+
+// length of the run of in[i] starting at i, capped at max
+static int
+run_length(const unsigned char *in, int n, int i, int max)
+{
+    int r = 1;
+    while ( i + r < n && r < max && in[i + r] == in[i] ) {
+        r++;
+    }
+    return r;
+}
+
+static int
+rle_encode(const unsigned char *in, int n, unsigned char *out)
+{
+    // cost[i] is the smallest encoding of in[i..n), step[i] the token
+    // length used there (negative for an inline string)
+    int *cost = malloc((n + 1) * sizeof(int));
+    int *step = malloc((n + 1) * sizeof(int));
+    int i, k, o = 0;
+
+    cost[n] = 0;
+    for ( i = n - 1 ; i >= 0 ; i-- )
+    {
+        int run = run_length(in, n, i, RLE_MAX);
+        int rc = (in[i] == 0x00 || in[i] == 0xff) ? 1 : 2;
+
+        cost[i] = 0x7fffffff;
+        for ( k = 1 ; k <= run ; k++ ) {
+            if ( rc + cost[i + k] < cost[i] ) {
+                cost[i] = rc + cost[i + k];
+                step[i] = k;
+            }
+        }
+        for ( k = 1 ; k <= RLE_MAX && i + k <= n ; k++ ) {
+            if ( 1 + k + cost[i + k] < cost[i] ) {
+                cost[i] = 1 + k + cost[i + k];
+                step[i] = -k;
+            }
+        }
+    }
+
+    for ( i = 0 ; i < n ; )
+    {
+        if ( step[i] < 0 ) {
+            k = -step[i];
+            out[o++] = 0xc0 | (k - 1);
+            memcpy(out + o, in + i, k);
+            o += k;
+        }
+        else {
+            k = step[i];
+            if ( in[i] == 0x00 ) {
+                out[o++] = 0x00 | (k - 1);
+            } else if ( in[i] == 0xff ) {
+                out[o++] = 0x40 | (k - 1);
+            } else {
+                out[o++] = 0x80 | (k - 1);
+                out[o++] = in[i];
+            }
+        }
+        i += k;
+    }
+
+    free(cost);
+    free(step);
+    return o;
+}
+
+static int
+rle_decode(const unsigned char *in, int n, unsigned char *out)
+{
+    int i = 0, o = 0;
+
+    while ( i < n )
+    {
+        int c = in[i++];
+        int k = (c & 0x3f) + 1;
+
+        if ( (c & 0xc0) == 0xc0 ) {
+            if ( i + k > n || o + k > MAX_ASSET ) return -1;
+            memcpy(out + o, in + i, k);
+            i += k;
+        }
+        else {
+            int b;
+            if ( (c & 0xc0) == 0x80 && i >= n ) return -1;
+            b = (c & 0xc0) == 0x00 ? 0x00 : (c & 0xc0) == 0x40 ? 0xff : in[i++];
+            if ( o + k > MAX_ASSET ) return -1;
+            memset(out + o, b, k);
+        }
+        o += k;
+    }
+    return o;
+}
+
+// ---- lz ----
+
+static int
+lz_encode(const unsigned char *in, int n, unsigned char *out)
+{
+    int *cost = malloc((n + 1) * sizeof(int));
+    int *step = malloc((n + 1) * sizeof(int));
+    int *dist = malloc((n + 1) * sizeof(int));
+    int i, k, d, o = 0;
+
+    cost[n] = 0;
+    for ( i = n - 1 ; i >= 0 ; i-- )
+    {
+        cost[i] = 0x7fffffff;
+
+        for ( k = 1 ; k <= LZ_LIT_MAX && i + k <= n ; k++ ) {
+            if ( 1 + k + cost[i + k] < cost[i] ) {
+                cost[i] = 1 + k + cost[i + k];
+                step[i] = -k;
+            }
+        }
+
+        // the match may overlap the output, so compare byte by byte
+        for ( d = 1 ; d <= LZ_WINDOW && d <= i ; d++ ) {
+            int len = 0;
+            while ( len < LZ_MAX && i + len < n && in[i + len] == in[i + len - d] ) {
+                len++;
+            }
+            for ( k = LZ_MIN ; k <= len ; k++ ) {
+                if ( 2 + cost[i + k] < cost[i] ) {
+                    cost[i] = 2 + cost[i + k];
+                    step[i] = k;
+                    dist[i] = d;
+                }
+            }
+        }
+    }
+
+    for ( i = 0 ; i < n ; )
+    {
+        if ( step[i] < 0 ) {
+            k = -step[i];
+            out[o++] = k - 1;
+            memcpy(out + o, in + i, k);
+            o += k;
+        }
+        else {
+            k = step[i];
+            out[o++] = 0x80 | (k - LZ_MIN);
+            out[o++] = dist[i] - 1;
+        }
+        i += k;
+    }
+
+    free(cost);
+    free(step);
+    free(dist);
+    return o;
+}
+
+static int
+lz_decode(const unsigned char *in, int n, unsigned char *out)
+{
+    int i = 0, o = 0;
+
+    while ( i < n )
+    {
+        int c = in[i++];
+
+        if ( c < 0x80 ) {
+            int k = c + 1;
+            if ( i + k > n || o + k > MAX_ASSET ) return -1;
+            memcpy(out + o, in + i, k);
+            i += k;
+            o += k;
+        }
+        else {
+            int k = (c & 0x7f) + LZ_MIN;
+            int d;
+            if ( i >= n ) return -1;
+            d = in[i++] + 1;
+            if ( d > o || o + k > MAX_ASSET ) return -1;
+            while ( k-- ) {
+                out[o] = out[o - d];
+                o++;
+            }
+        }
+    }
+    return o;
+}
+
+static const CODEC codecs[] = {
+    { "raw", "",    "// raw",         raw_encode, raw_decode },
+    { "rle", "RLE", "// RLE encoded", rle_encode, rle_decode },
+    { "lz",  "LZ",  "// LZ encoded",  lz_encode,  lz_decode  },
+};
+#define NUM_CODECS (int)(sizeof(codecs) / sizeof(codecs[0]))
+
+// ---- input ----
+
+// read one PBM header number, skipping whitespace and comments
+static int
+pbm_number(FILE *f)
+{
+    int c, v = 0;
+
+    for (;;) {
+        c = fgetc(f);
+        if ( c == '#' ) {
+            while ( c != '\n' && c != EOF ) c = fgetc(f);
+        }
+        else if ( c != ' ' && c != '\t' && c != '\r' && c != '\n' ) {
+            break;
+        }
+    }
+    if ( c < '0' || c > '9' ) return -1;
+    while ( c >= '0' && c <= '9' ) {
+        v = v * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return v;
+}
+
+// load a monochrome PBM and cut it into 8x8 patterns, set pixels are 1s
+static int
+load_pbm(FILE *f, unsigned char *out)
+{
+    int magic, w, h, x, y, n;
+    unsigned char *pix;
+
+    if ( fgetc(f) != 'P' ) return -1;
+    magic = fgetc(f);
+    if ( magic != '1' && magic != '4' ) return -1;
+    w = pbm_number(f);
+    h = pbm_number(f);
+    if ( w <= 0 || h <= 0 || (w & 7) || (h & 7) ) return -1;
+    if ( (w / 8) * (h / 8) * 8 > MAX_ASSET ) return -1;
+
+    // one byte per 8 pixels, same as a P4 row
+    pix = calloc((w / 8) * h, 1);
+    for ( y = 0 ; y < h ; y++ )
+    {
+        if ( magic == '4' ) {
+            if ( fread(pix + y * (w / 8), 1, w / 8, f) != (size_t)(w / 8) ) {
+                free(pix);
+                return -1;
+            }
+            continue;
+        }
+
+        for ( x = 0 ; x < w ; x++ ) {
+            int c;
+            do { c = fgetc(f); } while ( c == ' ' || c == '\t' || c == '\r' || c == '\n' );
+            if ( c != '0' && c != '1' ) {
+                free(pix);
+                return -1;
+            }
+            if ( c == '1' ) pix[y * (w / 8) + x / 8] |= 0x80 >> (x & 7);
+        }
+    }
+
+    n = 0;
+    for ( y = 0 ; y < h ; y += 8 ) {
+        for ( x = 0 ; x < w / 8 ; x++ ) {
+            int r;
+            for ( r = 0 ; r < 8 ; r++ ) {
+                out[n++] = pix[(y + r) * (w / 8) + x];
+            }
+        }
+    }
+
+    free(pix);
+    return n;
+}
+
+static int
+load_asset(const char *fn, unsigned char *out)
+{
+    const char *ext = strrchr(fn, '.');
+    FILE *f = fopen(fn, "rb");
+    int n;
+
+    if ( f == NULL ) {
+        printf("Error, could not open input file: [%s]\n", fn);
+        return -1;
+    }
+
+    if ( ext != NULL && (strcmp(ext, ".pbm") == 0 || strcmp(ext, ".PBM") == 0) ) {
+        n = load_pbm(f, out);
+        if ( n < 0 ) printf("Error, [%s] is not a usable PBM\n", fn);
+    }
+    else {
+        n = (int)fread(out, 1, MAX_ASSET, f);
+        if ( !feof(f) ) {
+            printf("Error, [%s] is larger than %d bytes\n", fn, MAX_ASSET);
+            n = -1;
+        }
+    }
+
+    fclose(f);
+    return n;
+}
+
+// ---- output ----
+
+static void
+write_array(FILE *dst, const char *name, const CODEC *cd, const unsigned char *p, int n)
+{
+    char txt[17];
+    int i;
+
+    fprintf(dst, "const unsigned char %s[] = {\n%s\n", name, cd->comment);
+    for ( i = 0 ; i < n ; i++ )
+    {
+        if ( (i % 16) == 0 ) fprintf(dst, "\t ");
+        fprintf(dst, "0x%02X%s", p[i], i + 1 < n ? "," : " ");
+
+        // printable, but nothing that could end or continue the comment
+        txt[i % 16] = (p[i] >= ' ' && p[i] < 0x7f && p[i] != '\\') ? p[i] : '.';
+
+        if ( (i % 16) == 15 || i + 1 == n ) {
+            txt[(i % 16) + 1] = '\0';
+            fprintf(dst, "%*s\t// %08X %-16s //\n", (15 - (i % 16)) * 5, "", i & ~15, txt);
+        }
+    }
+    fprintf(dst, "};\n");
+}
+
+typedef struct {
+    const char *name;
+    const char *file;
+    const CODEC *codec;
+    unsigned char *data;
+    int size;
+} ASSET;
+
+int
+main(int argc, char *argv[])
+{
+    static unsigned char raw[MAX_ASSET], check[MAX_ASSET];
+    ASSET *assets;
+    FILE *dst = NULL;
+    int i, j, ret = 1;
+
+    if ( argc < 3 )
+    {
+        printf(
+        "mkasset, version 1.0\n\n"
+        "Compress boot menu graphics into C source for the Phoenix menu.\n\n"
+        "Use: mkasset <output c file> <name>:<codec>:<input file> [...]\n\n"
+        "codec options:\n"
+        "  raw - uncompressed, for vdpmemcpy\n"
+        "  rle - 2 bit flag RLE, for unrle\n"
+        "  lz  - byte LZ77, for unlz\n\n"
+        "Input files ending in .pbm are cut into 8x8 patterns, anything\n"
+        "else is used as raw bytes.\n"
+        "\n"
+        );
+
+        return 1;
+    }
+
+    assets = calloc(argc - 2, sizeof(ASSET));
+
+    for ( i = 0 ; i < argc - 2 ; i++ )
+    {
+        ASSET *a = &assets[i];
+        char *arg = argv[i + 2];
+        char *c1 = strchr(arg, ':');
+        char *c2 = c1 ? strchr(c1 + 1, ':') : NULL;
+        int n;
+
+        if ( c2 == NULL ) {
+            printf("Error, expected <name>:<codec>:<input file>: [%s]\n", arg);
+            goto DONE;
+        }
+        *c1 = '\0';
+        *c2 = '\0';
+        a->name = arg;
+        a->file = c2 + 1;
+
+        for ( j = 0 ; j < NUM_CODECS ; j++ ) {
+            if ( strcmp(c1 + 1, codecs[j].name) == 0 ) a->codec = &codecs[j];
+        }
+        if ( a->codec == NULL ) {
+            printf("Error, unknown codec: [%s]\n", c1 + 1);
+            goto DONE;
+        }
+
+        n = load_asset(a->file, raw);
+        if ( n <= 0 ) goto DONE;
+
+        // show what every codec would do, then keep the one asked for
+        printf("%-12s %5d bytes:", a->name, n);
+        for ( j = 0 ; j < NUM_CODECS ; j++ )
+        {
+            // worst cases are 1 flag byte per 64 (rle) or 128 (lz) raw bytes
+            unsigned char *out = malloc(n + n / 32 + 2);
+            int sz = codecs[j].encode(raw, n, out);
+
+            if ( codecs[j].decode(out, sz, check) != n || memcmp(raw, check, n) != 0 ) {
+                printf("\nError, %s failed to round trip [%s]\n", codecs[j].name, a->file);
+                free(out);
+                goto DONE;
+            }
+
+            printf(" %s %5d%s", codecs[j].name, sz, &codecs[j] == a->codec ? "*" : " ");
+            if ( &codecs[j] == a->codec ) {
+                a->data = out;
+                a->size = sz;
+            } else {
+                free(out);
+            }
+        }
+        printf("\n");
+    }
+
+    dst = fopen(argv[1], "wb");
+    if ( dst == NULL ) {
+        printf("Error, could not open or create output file: [%s]\n", argv[1]);
+        goto DONE;
+    }
+
+    fprintf(dst, "// Generated by mkasset, edit the source images instead\n//\n");
+    for ( i = 0 ; i < argc - 2 ; i++ ) {
+        fprintf(dst, "// %s: %s from %s\n", assets[i].name, assets[i].codec->name, assets[i].file);
+    }
+
+    fprintf(dst, "\n#ifdef HEADERS__\n");
+    for ( i = 0 ; i < argc - 2 ; i++ ) {
+        fprintf(dst, "extern const unsigned char %s[];\n", assets[i].name);
+        fprintf(dst, "#define SIZE_OF_%s%s %d\n", assets[i].name, assets[i].codec->suffix, assets[i].size);
+    }
+    fprintf(dst, "#else\n");
+    for ( i = 0 ; i < argc - 2 ; i++ ) {
+        if ( i > 0 ) fprintf(dst, "\n");
+        write_array(dst, assets[i].name, assets[i].codec, assets[i].data, assets[i].size);
+    }
+    fprintf(dst, "#endif\n");
+
+    ret = 0;
+
+    DONE:
+
+    if ( dst != NULL ) {
+        fclose(dst);
+    }
+    for ( i = 0 ; i < argc - 2 ; i++ ) {
+        free(assets[i].data);
+    }
+    free(assets);
+
+    return ret;
+}
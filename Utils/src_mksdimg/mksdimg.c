@@ -0,0 +1,823 @@
+/**
+ * Utility to build a FAT32 SD card image for the Phoenix from a folder of
+ * ROMs, laid out so the menu and the loader take their fastest paths.
+ *
+ * - Every directory is written in the menu's collation order (see
+ *   mystrcmp() and sortDir() in gameMenus/coleco/src/menu.c): directories
+ *   first, then files, case-insensitive. mystrcmp() means to sort an
+ *   underscore as a space, but '_' has bit 6 set so it is only uppercased;
+ *   collate() does the same so the orders agree. The insertion sort in
+ *   sortDir() then never has to move an entry.
+ * - Every file and directory is one contiguous run of clusters, so loads
+ *   never seek through the FAT.
+ * - Megacart images (no AA55/55AA at the start, but at EOF-16K) that are
+ *   not a power of two are padded at the front with 0xFF to one, which is
+ *   what the menu wants (the "Megacart images must be padded" error).
+ * - CORE*.PHX, *.BIO and MULTCART.ROM go first in the root directory and
+ *   the data area. The loader only searches the first root cluster.
+ *
+ * Names must be 7-bit ASCII; long names get LFN entries and a short name
+ * with a ~N tail as needed. Files and folders starting with '.' are left
+ * out, since the menu hides them anyway. The menu's own limits (254 entries
+ * per folder, 126 character names, 512 character paths) are warned about.
+ *
+ * The image has an MBR with one FAT32 partition at 1MB. By default it is
+ * just big enough for the files plus 16MB, and has more than the 65525
+ * clusters FAT32 needs. Write it to a card with dd or Win32DiskImager.
+ *
+ * Unix/MinGW:
+ * gcc -Wall -O2 -o mksdimg mksdimg.c
+ */
+#include <stdio.h>              // printf, fopen
+#include <stdlib.h>             // malloc, qsort
+#include <string.h>             // strcmp, memcpy
+#include <time.h>               // localtime
+#include <dirent.h>             // opendir, readdir
+#include <sys/stat.h>           // stat
+
+#ifdef _WIN32
+#define fseek64 _fseeki64
+#else
+#define fseek64 fseeko
+#endif
+
+#define SECTOR          512
+#define PART_START      2048        // 1MB, erase block aligned
+#define RESERVED        32
+#define FAT32_MIN       65526       // fewer clusters than this is FAT16
+#define FAT_EOC         0x0FFFFFFFUL
+#define FREE_SPACE      (16UL * 1024 * 1024)
+
+#define MENU_MAX_FILES  254
+#define MENU_MAX_NAME   126
+#define MENU_MAX_PATH   512
+
+#define PAGE_16K        16384UL
+#define MEGA_MAX_PAGES  32
+
+typedef unsigned long ULONG;
+
+typedef struct NODE {
+    char *name;                 // long name
+    char *path;                 // host path
+    int dir;
+    ULONG size;                 // size in the image, padding included
+    ULONG pad;                  // 0xFF bytes written before the data
+    time_t mtime;
+    unsigned char sname[11];    // 8.3 name, space padded
+    int lfn;                    // number of LFN entries
+    ULONG cluster;              // first cluster, 0 if empty
+    ULONG clusters;
+    struct NODE **kids;
+    int nkids;
+} NODE;
+
+static ULONG clsize;            // bytes per cluster
+static ULONG nextcl = 2;        // next free cluster
+static int warnings;
+
+// ---- helpers ----
+
+static void *
+xalloc(size_t n)
+{
+    void *p = calloc(1, n ? n : 1);
+    if ( p == NULL ) {
+        fprintf(stderr, "Error: out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static char *
+xstrdup(const char *s)
+{
+    char *p = xalloc(strlen(s) + 1);
+    strcpy(p, s);
+    return p;
+}
+
+static void
+put16(unsigned char *p, ULONG v)
+{
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+}
+
+static void
+put32(unsigned char *p, ULONG v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+// the menu's mystrcmp(): uppercase, and underscore is a space
+static int
+collate(const char *s1, const char *s2)
+{
+    unsigned char c1, c2;
+
+    for ( ;; ) {
+        c1 = *s1++;
+        c2 = *s2++;
+        if ( c1 & 0x40 ) {
+            c1 &= 0xDF;
+        } else if ( c1 == '_' ) {
+            c1 = ' ';
+        }
+        if ( c2 & 0x40 ) {
+            c2 &= 0xDF;
+        } else if ( c2 == '_' ) {
+            c2 = ' ';
+        }
+        if ( c1 != c2 || c1 == 0 ) {
+            return (int)c1 - (int)c2;
+        }
+    }
+}
+
+// equal by the menu's compare
+static int
+same(const char *s1, const char *s2)
+{
+    return strlen(s1) == strlen(s2) && collate(s1, s2) == 0;
+}
+
+// loader files that must be in the first root directory cluster
+static int
+is_system(const NODE *n)
+{
+    const char *ext = strrchr(n->name, '.');
+
+    if ( n->dir || ext == NULL ) {
+        return 0;
+    }
+    return same(n->name, "MULTCART.ROM") || same(ext, ".PHX") || same(ext, ".BIO");
+}
+
+static int sort_root;
+
+static int
+node_cmp(const void *a, const void *b)
+{
+    const NODE *n1 = *(const NODE * const *)a;
+    const NODE *n2 = *(const NODE * const *)b;
+    int r;
+
+    if ( sort_root && is_system(n1) != is_system(n2) ) {
+        return is_system(n2) - is_system(n1);
+    }
+    if ( n1->dir != n2->dir ) {
+        return n2->dir - n1->dir;
+    }
+    r = collate(n1->name, n2->name);
+    return r ? r : strcmp(n1->name, n2->name);
+}
+
+// ---- megacarts ----
+
+static int
+is_header(const unsigned char *b)
+{
+    return (b[0] == 0xAA && b[1] == 0x55) || (b[0] == 0x55 && b[1] == 0xAA);
+}
+
+// Same test as the menu: no header at 0, header at (16K pages - 1) * 16K.
+// Returns the front padding for a power of two size.
+static ULONG
+megacart_pad(NODE *n)
+{
+    unsigned char b[2];
+    ULONG pages, want;
+    FILE *f;
+    int mega = 0;
+
+    if ( n->size <= 2 * PAGE_16K || is_system(n) ) {
+        return 0;
+    }
+
+    pages = (n->size + PAGE_16K - 1) / PAGE_16K;
+    f = fopen(n->path, "rb");
+    if ( f == NULL ) {
+        return 0;
+    }
+    if ( fread(b, 1, 2, f) == 2 && !is_header(b) &&
+         fseek(f, (pages - 1) * PAGE_16K, SEEK_SET) == 0 &&
+         fread(b, 1, 2, f) == 2 && is_header(b) ) {
+        mega = 1;
+    }
+    fclose(f);
+
+    if ( !mega ) {
+        return 0;
+    }
+    if ( n->size % PAGE_16K ) {
+        fprintf(stderr, "Warning: %s: megacart is not a multiple of 16K, not padded\n", n->path);
+        warnings++;
+        return 0;
+    }
+    if ( pages > MEGA_MAX_PAGES ) {
+        fprintf(stderr, "Warning: %s: megacart is larger than 512K\n", n->path);
+        warnings++;
+        return 0;
+    }
+
+    for ( want = 2; want < pages; want <<= 1 )
+        ;
+    if ( want != pages ) {
+        printf("%s: megacart padded from %luK to %luK\n", n->path, pages * 16, want * 16);
+    }
+    return (want - pages) * PAGE_16K;
+}
+
+// ---- tree ----
+
+static int
+check_name(const char *path, const char *name)
+{
+    const unsigned char *p;
+
+    for ( p = (const unsigned char *)name; *p; p++ ) {
+        if ( *p < 0x20 || *p > 0x7E ) {
+            fprintf(stderr, "Warning: %s: name is not 7-bit ASCII, skipped\n", path);
+            warnings++;
+            return 0;
+        }
+    }
+    if ( strlen(name) > 255 ) {
+        fprintf(stderr, "Warning: %s: name is too long for FAT, skipped\n", path);
+        warnings++;
+        return 0;
+    }
+    if ( strlen(name) > MENU_MAX_NAME ) {
+        fprintf(stderr, "Warning: %s: the menu shows only %d characters\n", path, MENU_MAX_NAME);
+        warnings++;
+    }
+    return 1;
+}
+
+static NODE *
+scan(const char *path, const char *name, int depth, size_t menulen)
+{
+    NODE *n = xalloc(sizeof(NODE));
+    struct stat st;
+
+    n->name = xstrdup(name);
+    n->path = xstrdup(path);
+    if ( stat(path, &st) != 0 ) {
+        fprintf(stderr, "Error: cannot stat %s\n", path);
+        exit(1);
+    }
+    n->mtime = st.st_mtime;
+    n->dir = S_ISDIR(st.st_mode);
+
+    if ( menulen > MENU_MAX_PATH ) {
+        fprintf(stderr, "Warning: %s: path is longer than the menu's %d characters\n",
+            path, MENU_MAX_PATH);
+        warnings++;
+    }
+
+    if ( !n->dir ) {
+        if ( (unsigned long long)st.st_size > 0xFFFFFFFFULL ) {
+            fprintf(stderr, "Error: %s is larger than 4GB\n", path);
+            exit(1);
+        }
+        n->size = st.st_size;
+        n->pad = megacart_pad(n);
+        n->size += n->pad;
+        return n;
+    }
+
+    {
+        DIR *d = opendir(path);
+        struct dirent *e;
+        int cap = 0;
+
+        if ( d == NULL ) {
+            fprintf(stderr, "Error: cannot open %s\n", path);
+            exit(1);
+        }
+        while ( (e = readdir(d)) != NULL ) {
+            char *sub;
+
+            if ( e->d_name[0] == '.' ) {
+                continue;
+            }
+            sub = xalloc(strlen(path) + strlen(e->d_name) + 2);
+            sprintf(sub, "%s/%s", path, e->d_name);
+            if ( check_name(sub, e->d_name) ) {
+                if ( n->nkids == cap ) {
+                    NODE **k;
+                    cap = cap ? cap * 2 : 64;
+                    k = xalloc(cap * sizeof(NODE *));
+                    if ( n->nkids ) {
+                        memcpy(k, n->kids, n->nkids * sizeof(NODE *));
+                    }
+                    free(n->kids);
+                    n->kids = k;
+                }
+                n->kids[n->nkids++] = scan(sub, e->d_name, depth + 1,
+                    menulen + 1 + strlen(e->d_name));
+            }
+            free(sub);
+        }
+        closedir(d);
+    }
+
+    sort_root = depth == 0;
+    qsort(n->kids, n->nkids, sizeof(NODE *), node_cmp);
+
+    // the menu adds ".." in subfolders
+    if ( n->nkids + (depth ? 1 : 0) > MENU_MAX_FILES ) {
+        fprintf(stderr, "Warning: %s: %d entries, the menu shows only %d\n",
+            path, n->nkids, MENU_MAX_FILES - (depth ? 1 : 0));
+        warnings++;
+    }
+    return n;
+}
+
+// ---- short names ----
+
+static int
+sfn_char(int c)
+{
+    if ( c >= 'a' && c <= 'z' ) {
+        return c - 'a' + 'A';
+    }
+    if ( (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || strchr("!#$%&'()-@^_`{}~", c) ) {
+        return c;
+    }
+    return 0;
+}
+
+// Make the 8.3 name, and say if a long name entry is needed.
+static void
+short_name(NODE *dir, NODE *n)
+{
+    const char *dot = strrchr(n->name, '.');
+    char base[9], ext[4];
+    int nb = 0, ne = 0, lossy = 0, exact = 1, i, tail;
+    const char *p;
+
+    if ( dot == n->name ) {
+        dot = NULL;
+    }
+    for ( p = n->name; *p && p != dot; p++ ) {
+        int c = sfn_char(*p);
+        if ( *p == ' ' || *p == '.' ) {
+            lossy = 1;
+            continue;
+        }
+        if ( c != *p ) {
+            exact = 0;
+        }
+        if ( c == 0 ) {
+            c = '_';
+            lossy = 1;
+        }
+        if ( nb < 8 ) {
+            base[nb++] = c;
+        } else {
+            lossy = 1;
+        }
+    }
+    for ( p = dot ? dot + 1 : ""; *p; p++ ) {
+        int c = sfn_char(*p);
+        if ( *p == ' ' ) {
+            lossy = 1;
+            continue;
+        }
+        if ( c != *p ) {
+            exact = 0;
+        }
+        if ( c == 0 ) {
+            c = '_';
+            lossy = 1;
+        }
+        if ( ne < 3 ) {
+            ext[ne++] = c;
+        } else {
+            lossy = 1;
+        }
+    }
+    if ( nb == 0 ) {
+        base[nb++] = '_';
+        lossy = 1;
+    }
+
+    memset(n->sname, ' ', 11);
+    memcpy(n->sname + 8, ext, ne);
+
+    for ( tail = lossy ? 1 : 0; ; tail++ ) {
+        int dup = 0;
+
+        memset(n->sname, ' ', 8);
+        memcpy(n->sname, base, nb);
+        if ( tail ) {
+            char t[12];
+            int nt = sprintf(t, "~%d", tail);
+            int keep = nb < 8 - nt ? nb : 8 - nt;
+            memcpy(n->sname + keep, t, nt);
+        }
+        for ( i = 0; i < dir->nkids && dir->kids[i] != n; i++ ) {
+            if ( !memcmp(dir->kids[i]->sname, n->sname, 11) ) {
+                dup = 1;
+                break;
+            }
+        }
+        if ( !dup ) {
+            break;
+        }
+    }
+
+    n->lfn = (exact && !lossy && !tail) ? 0 : (int)(strlen(n->name) + 12) / 13;
+}
+
+static unsigned char
+sfn_sum(const unsigned char *s)
+{
+    unsigned char sum = 0;
+    int i;
+
+    for ( i = 0; i < 11; i++ ) {
+        sum = ((sum & 1) << 7) + (sum >> 1) + s[i];
+    }
+    return sum;
+}
+
+// ---- layout ----
+
+static ULONG
+dir_entries(const NODE *d, int root)
+{
+    ULONG e = root ? 1 : 2;     // volume label, or . and ..
+    int i;
+
+    for ( i = 0; i < d->nkids; i++ ) {
+        e += 1 + d->kids[i]->lfn;
+    }
+    return e;
+}
+
+// Directory, then its files, then each subfolder the same way.
+static void
+allocate(NODE *d, int root)
+{
+    int i;
+
+    for ( i = 0; i < d->nkids; i++ ) {
+        short_name(d, d->kids[i]);
+    }
+
+    d->clusters = (dir_entries(d, root) * 32 + clsize - 1) / clsize;
+    d->cluster = nextcl;
+    nextcl += d->clusters;
+
+    for ( i = 0; i < d->nkids; i++ ) {
+        NODE *n = d->kids[i];
+        if ( !n->dir && n->size ) {
+            n->clusters = (n->size + clsize - 1) / clsize;
+            n->cluster = nextcl;
+            nextcl += n->clusters;
+        }
+    }
+    for ( i = 0; i < d->nkids; i++ ) {
+        if ( d->kids[i]->dir ) {
+            allocate(d->kids[i], 0);
+        }
+    }
+}
+
+// ---- image writing ----
+
+static FILE *img;
+static ULONG fat_lba, fat_sectors, data_lba, spc;
+static unsigned char *fat;
+
+static void
+write_at(unsigned long long lba, const void *p, size_t n)
+{
+    if ( fseek64(img, lba * SECTOR, SEEK_SET) != 0 || fwrite(p, 1, n, img) != n ) {
+        fprintf(stderr, "Error: cannot write the image\n");
+        exit(1);
+    }
+}
+
+static unsigned long long
+cluster_lba(ULONG c)
+{
+    return data_lba + (unsigned long long)(c - 2) * spc;
+}
+
+static void
+chain(ULONG first, ULONG count)
+{
+    ULONG c;
+
+    for ( c = first; c < first + count; c++ ) {
+        put32(fat + c * 4, c + 1 == first + count ? FAT_EOC : c + 1);
+    }
+}
+
+static void
+dir_time(unsigned char *e, time_t t)
+{
+    struct tm *tm = localtime(&t);
+    ULONG d = 0x21, tt = 0;     // 1980-01-01
+
+    if ( tm != NULL && tm->tm_year >= 80 ) {
+        d = ((tm->tm_year - 80) << 9) | ((tm->tm_mon + 1) << 5) | tm->tm_mday;
+        tt = (tm->tm_hour << 11) | (tm->tm_min << 5) | (tm->tm_sec / 2);
+    }
+    put16(e + 14, tt);          // created
+    put16(e + 16, d);
+    put16(e + 18, d);           // accessed
+    put16(e + 22, tt);          // modified
+    put16(e + 24, d);
+}
+
+static unsigned char *
+dir_entry(unsigned char *e, const unsigned char *sname, int attr, ULONG cl, ULONG size, time_t t)
+{
+    memcpy(e, sname, 11);
+    e[11] = attr;
+    dir_time(e, t);
+    put16(e + 20, cl >> 16);
+    put16(e + 26, cl & 0xFFFF);
+    put32(e + 28, size);
+    return e + 32;
+}
+
+static unsigned char *
+lfn_entries(unsigned char *e, const NODE *n)
+{
+    static const int pos[13] = { 1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30 };
+    unsigned char sum = sfn_sum(n->sname);
+    size_t len = strlen(n->name);
+    int s, i;
+
+    for ( s = n->lfn; s >= 1; s-- ) {
+        memset(e, 0, 32);
+        e[0] = s | (s == n->lfn ? 0x40 : 0);
+        e[11] = 0x0F;
+        e[13] = sum;
+        for ( i = 0; i < 13; i++ ) {
+            size_t k = (s - 1) * 13 + i;
+            ULONG c = k < len ? (unsigned char)n->name[k] : k == len ? 0 : 0xFFFF;
+            put16(e + pos[i], c);
+        }
+        e += 32;
+    }
+    return e;
+}
+
+static void
+write_file(const NODE *n)
+{
+    unsigned char *buf;
+    FILE *f;
+    ULONG done = 0, chunk = 1024 * 1024;
+
+    if ( n->size == 0 ) {
+        return;
+    }
+    buf = xalloc(chunk);
+    f = fopen(n->path, "rb");
+    if ( f == NULL ) {
+        fprintf(stderr, "Error: cannot open %s\n", n->path);
+        exit(1);
+    }
+    if ( fseek64(img, cluster_lba(n->cluster) * SECTOR, SEEK_SET) != 0 ) {
+        fprintf(stderr, "Error: cannot write the image\n");
+        exit(1);
+    }
+    while ( done < n->size ) {
+        ULONG want = n->size - done < chunk ? n->size - done : chunk;
+        ULONG got;
+
+        if ( done < n->pad ) {
+            got = n->pad - done < want ? n->pad - done : want;
+            memset(buf, 0xFF, got);
+        } else {
+            got = fread(buf, 1, want, f);
+            if ( got == 0 ) {
+                fprintf(stderr, "Error: cannot read %s\n", n->path);
+                exit(1);
+            }
+        }
+        if ( fwrite(buf, 1, got, img) != got ) {
+            fprintf(stderr, "Error: cannot write the image\n");
+            exit(1);
+        }
+        done += got;
+    }
+    fclose(f);
+    free(buf);
+}
+
+static void
+write_dir(const NODE *d, const NODE *parent, const char *label)
+{
+    unsigned char *buf = xalloc(d->clusters * clsize);
+    unsigned char *e = buf;
+    static const unsigned char dot[11]    = ".          ";
+    static const unsigned char dotdot[11] = "..         ";
+    int i;
+
+    if ( parent == NULL ) {
+        unsigned char vol[11];
+        memset(vol, ' ', 11);
+        memcpy(vol, label, strlen(label) < 11 ? strlen(label) : 11);
+        e = dir_entry(e, vol, 0x08, 0, 0, d->mtime);
+    } else {
+        e = dir_entry(e, dot, 0x10, d->cluster, 0, d->mtime);
+        e = dir_entry(e, dotdot, 0x10, parent->cluster == 2 ? 0 : parent->cluster, 0, parent->mtime);
+    }
+
+    for ( i = 0; i < d->nkids; i++ ) {
+        const NODE *n = d->kids[i];
+        e = lfn_entries(e, n);
+        e = dir_entry(e, n->sname, n->dir ? 0x10 : 0x20, n->cluster, n->dir ? 0 : n->size, n->mtime);
+    }
+
+    chain(d->cluster, d->clusters);
+    write_at(cluster_lba(d->cluster), buf, d->clusters * clsize);
+    free(buf);
+
+    for ( i = 0; i < d->nkids; i++ ) {
+        const NODE *n = d->kids[i];
+        if ( n->dir ) {
+            write_dir(n, d, label);
+        } else if ( n->size ) {
+            chain(n->cluster, n->clusters);
+            write_file(n);
+        }
+    }
+}
+
+// ---- main ----
+
+static void
+usage(void)
+{
+    printf(
+    "mksdimg, version 1.0\n\n"
+    "Phoenix SD card image builder.\n\n"
+    "Use: mksdimg [-s size_MB] [-c cluster_KB] [-l label] <folder> <out.img>\n\n"
+    "  -s  image size in MB, default is the files plus 16MB\n"
+    "  -c  cluster size in KB (1, 2, 4 .. 32), default 4\n"
+    "  -l  volume label, default PHOENIX\n"
+    "\n"
+    );
+}
+
+int
+main(int argc, char *argv[])
+{
+    ULONG size_mb = 0, cl_kb = 4, clusters, used, want, total, reserved, volid;
+    const char *label = "PHOENIX";
+    unsigned char sec[SECTOR], mbr[SECTOR];
+    NODE *root;
+    int a;
+
+    for ( a = 1; a < argc && argv[a][0] == '-'; a += 2 ) {
+        if ( a + 1 >= argc ) {
+            usage();
+            return 1;
+        }
+        if ( !strcmp(argv[a], "-s") ) {
+            size_mb = strtoul(argv[a + 1], NULL, 10);
+        } else if ( !strcmp(argv[a], "-c") ) {
+            cl_kb = strtoul(argv[a + 1], NULL, 10);
+        } else if ( !strcmp(argv[a], "-l") ) {
+            label = argv[a + 1];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if ( argc - a != 2 || cl_kb < 1 || cl_kb > 32 || (cl_kb & (cl_kb - 1)) ) {
+        usage();
+        return 1;
+    }
+
+    clsize = cl_kb * 1024;
+    spc = clsize / SECTOR;
+
+    root = scan(argv[a], "", 0, 1);
+    allocate(root, 1);
+    used = nextcl - 2;
+
+    // size the volume, then fit the FATs and align the data area to 1MB
+    want = used + FREE_SPACE / clsize;
+    if ( want < FAT32_MIN ) {
+        want = FAT32_MIN;
+    }
+    if ( size_mb ) {
+        total = size_mb * (1024 * 1024 / SECTOR);
+    } else {
+        total = PART_START + RESERVED + 2 * (((want + 2) * 4 + SECTOR - 1) / SECTOR) + 2048 + want * spc;
+        total = (total + 2047) & ~2047UL;
+    }
+    if ( total <= PART_START + RESERVED + 2048 ) {
+        fprintf(stderr, "Error: image size too small\n");
+        return 1;
+    }
+    clusters = (total - PART_START - RESERVED) / spc;
+    fat_sectors = ((clusters + 2) * 4 + SECTOR - 1) / SECTOR;
+    reserved = RESERVED + (2048 - (PART_START + RESERVED + 2 * fat_sectors) % 2048) % 2048;
+    if ( total <= PART_START + reserved + 2 * fat_sectors ) {
+        fprintf(stderr, "Error: image size too small\n");
+        return 1;
+    }
+    clusters = (total - PART_START - reserved - 2 * fat_sectors) / spc;
+    if ( clusters < FAT32_MIN ) {
+        fprintf(stderr, "Error: %lu clusters is too few for FAT32, use a bigger image or smaller clusters\n",
+            clusters);
+        return 1;
+    }
+    if ( clusters < used ) {
+        fprintf(stderr, "Error: the files need %luMB\n", used / (1024 * 1024 / clsize) + 1);
+        return 1;
+    }
+
+    fat_lba = PART_START + reserved;
+    data_lba = fat_lba + 2 * fat_sectors;
+    fat = xalloc(fat_sectors * SECTOR);
+    put32(fat, 0x0FFFFFF8);
+    put32(fat + 4, FAT_EOC);
+
+    img = fopen(argv[a + 1], "wb+");
+    if ( img == NULL ) {
+        fprintf(stderr, "Error: cannot create %s\n", argv[a + 1]);
+        return 1;
+    }
+
+    write_dir(root, NULL, label);
+
+    // MBR, one FAT32 LBA partition
+    memset(mbr, 0, SECTOR);
+    mbr[446 + 4] = 0x0C;
+    memset(mbr + 446 + 1, 0xFE, 3);
+    memset(mbr + 446 + 5, 0xFE, 3);
+    put32(mbr + 446 + 8, PART_START);
+    put32(mbr + 446 + 12, total - PART_START);
+    mbr[510] = 0x55;
+    mbr[511] = 0xAA;
+    write_at(0, mbr, SECTOR);
+
+    // boot sector, and its backup in sector 6
+    volid = (ULONG)time(NULL);
+    memset(sec, 0, SECTOR);
+    memcpy(sec, "\xEB\x58\x90PHOENIX ", 11);
+    put16(sec + 0x0B, SECTOR);
+    sec[0x0D] = spc;
+    put16(sec + 0x0E, reserved);
+    sec[0x10] = 2;
+    sec[0x15] = 0xF8;
+    put16(sec + 0x18, 63);
+    put16(sec + 0x1A, 255);
+    put32(sec + 0x1C, PART_START);
+    put32(sec + 0x20, total - PART_START);
+    put32(sec + 0x24, fat_sectors);
+    put32(sec + 0x2C, 2);
+    put16(sec + 0x30, 1);
+    put16(sec + 0x32, 6);
+    sec[0x40] = 0x80;
+    sec[0x42] = 0x29;
+    put32(sec + 0x43, volid);
+    memset(sec + 0x47, ' ', 11);
+    memcpy(sec + 0x47, label, strlen(label) < 11 ? strlen(label) : 11);
+    memcpy(sec + 0x52, "FAT32   ", 8);
+    sec[510] = 0x55;
+    sec[511] = 0xAA;
+    write_at(PART_START, sec, SECTOR);
+    write_at(PART_START + 6, sec, SECTOR);
+
+    // FS info
+    memset(sec, 0, SECTOR);
+    put32(sec, 0x41615252);
+    put32(sec + 484, 0x61417272);
+    put32(sec + 488, clusters - used);
+    put32(sec + 492, nextcl);
+    sec[510] = 0x55;
+    sec[511] = 0xAA;
+    write_at(PART_START + 1, sec, SECTOR);
+    write_at(PART_START + 7, sec, SECTOR);
+
+    write_at(fat_lba, fat, fat_sectors * SECTOR);
+    write_at(fat_lba + fat_sectors, fat, fat_sectors * SECTOR);
+
+    // set the image size
+    memset(sec, 0, SECTOR);
+    write_at(total - 1, sec, SECTOR);
+
+    if ( fclose(img) != 0 ) {
+        fprintf(stderr, "Error: cannot write %s\n", argv[a + 1]);
+        return 1;
+    }
+
+    printf("%s: %luMB, %luK clusters, %lu of %lu clusters used, %d warning(s)\n",
+        argv[a + 1], total / 2048, cl_kb, used, clusters, warnings);
+    return 0;
+}
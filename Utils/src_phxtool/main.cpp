@@ -0,0 +1,144 @@
+/**
+ * phxtool: Phoenix core file mastering, one tool for the steps done by
+ * bit2bin, bin2phx and makemem, with the same output, and the boot ROM
+ * merge done by data2mem.
+ *
+ * Unix/MinGW:
+ * g++ -Wall -O2 -o phxtool main.cpp phxtool.cpp
+ */
+#include "phxtool.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace phx;
+
+static void usage()
+{
+    printf(
+    "phxtool, version 1.1\n\n"
+    "Phoenix core file mastering.\n\n"
+    "Use: phxtool <command> <arguments>\n\n"
+    "commands:\n"
+    "  bin    <in.bit> <out.bin>                   strip the .bit header (bit2bin)\n"
+    "  phx    <in.bin> <out.phx> <name> <issue> [extra]\n"
+    "                                              make a core file (bin2phx)\n"
+    "  core   <in.bit> <out.bin> <out.phx> <name> <issue> [extra]\n"
+    "                                              both of the above in one go\n"
+    "  verify <in.phx>                             check the core file checksums\n"
+    "  info   <in.bit>                             show the .bit header fields\n"
+    "  mem    <m|v> <in.rom> <out.mem>             ROM to data2mem MEM or VHDL (makemem)\n"
+    "  merge  <in_bd.bmm> <in.bit> <in.mem> <out.bit> [tag]\n"
+    "                                              put the ROM in the block RAMs (data2mem)\n"
+    "\n"
+    );
+}
+
+static CoreInfo coreInfo(const char *name, const char *issue)
+{
+    char *end;
+    long n = strtol(issue, &end, 10);
+    if (*issue == '\0' || *end != '\0' || n < 0 || n > 65535) throw Error("issue out of range");
+
+    CoreInfo info;
+    info.name = name;
+    info.issue = (unsigned)n;
+    return info;
+}
+
+static void makeCore(const Bytes &bin, const char *out, const char *name, const char *issue,
+                     const char *extraName)
+{
+    Bytes extra;
+    if (extraName) extra = readFile(extraName);
+
+    Bytes phx = makePhx(bin, coreInfo(name, issue), extraName ? &extra : 0);
+    writeFile(out, phx);
+
+    CoreInfo info = verifyPhx(phx);
+    printf("%s: %u bytes, CRC %08X\n", out, (unsigned)info.length, (unsigned)info.crc);
+}
+
+static void merge(const char *bmmName, const char *in, const char *memName, const char *out,
+                  const char *tag)
+{
+    Bytes bmmText = readFile(bmmName);
+    std::vector<BmmSpace> spaces = parseBmm(std::string(bmmText.begin(), bmmText.end()));
+
+    const BmmSpace *sp = 0;
+    for (size_t i = 0; i < spaces.size(); i++)
+        if (!tag || spaces[i].name == tag) {
+            if (sp) throw Error("more than one address space in the BMM file, give a tag");
+            sp = &spaces[i];
+        }
+    if (!sp) throw Error(tag ? std::string("no address space ") + tag + " in the BMM file"
+                             : "no address space in the BMM file");
+
+    Bytes memText = readFile(memName);
+    Bytes rom = readMem(std::string(memText.begin(), memText.end()), sp->start, sp->end - sp->start + 1);
+
+    Bytes bit = readFile(in);
+    size_t changed = mergeBram(bit, *sp, rom);
+    writeFile(out, bit);
+
+    printf("%s: %u bytes in %u RAMB16s, %u bits changed\n", sp->name.c_str(), (unsigned)rom.size(),
+        (unsigned)sp->blocks.size(), (unsigned)changed);
+}
+
+static int run(int argc, char **argv)
+{
+    if (argc < 2) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    const char *cmd = argv[1];
+    argc -= 2;
+    argv += 2;
+
+    if (!strcmp(cmd, "bin") && argc == 2) {
+        writeFile(argv[1], bitToBin(readFile(argv[0])));
+
+    } else if (!strcmp(cmd, "phx") && (argc == 4 || argc == 5)) {
+        makeCore(readFile(argv[0]), argv[1], argv[2], argv[3], argc == 5 ? argv[4] : 0);
+
+    } else if (!strcmp(cmd, "core") && (argc == 5 || argc == 6)) {
+        Bytes bin = bitToBin(readFile(argv[0]));
+        writeFile(argv[1], bin);
+        makeCore(bin, argv[2], argv[3], argv[4], argc == 6 ? argv[5] : 0);
+
+    } else if (!strcmp(cmd, "verify") && argc == 1) {
+        CoreInfo info = verifyPhx(readFile(argv[0]));
+        printf("%s issue %u, %u bytes, CRC %08X OK\n",
+            info.name.c_str(), info.issue, (unsigned)info.length, (unsigned)info.crc);
+
+    } else if (!strcmp(cmd, "info") && argc == 1) {
+        BitFile bf = parseBit(readFile(argv[0]));
+        printf("design: %s\npart:   %s\ndate:   %s %s\ndata:   %u bytes at %u\n",
+            bf.design.c_str(), bf.part.c_str(), bf.date.c_str(), bf.time.c_str(),
+            (unsigned)bf.length, (unsigned)bf.offset);
+
+    } else if (!strcmp(cmd, "mem") && argc == 3) {
+        writeFile(argv[2], makeMem(readFile(argv[1]), argv[0][0]));
+
+    } else if (!strcmp(cmd, "merge") && (argc == 4 || argc == 5)) {
+        merge(argv[0], argv[1], argv[2], argv[3], argc == 5 ? argv[4] : 0);
+
+    } else {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    try {
+        return run(argc, argv);
+    } catch (const Error &e) {
+        fprintf(stderr, "Error: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,652 @@
+/**
+ * phxtool library, see phxtool.h.
+ */
+#include "phxtool.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace phx {
+
+// FILE I/O ////////////////////////////////////////////////////////////////////
+
+Bytes readFile(const std::string &name)
+{
+    FILE *f = fopen(name.c_str(), "rb");
+    if (!f) throw Error("cannot open " + name);
+
+    Bytes data;
+    if (fseek(f, 0, SEEK_END) == 0) {
+        long size = ftell(f);
+        if (size > 0) {
+            data.resize(size);
+            fseek(f, 0, SEEK_SET);
+            if (fread(&data[0], 1, data.size(), f) != data.size()) {
+                fclose(f);
+                throw Error("cannot read " + name);
+            }
+        }
+    }
+    fclose(f);
+    return data;
+}
+
+static void writeData(const std::string &name, const void *p, size_t n)
+{
+    FILE *f = fopen(name.c_str(), "wb");
+    if (!f) throw Error("cannot create " + name);
+
+    bool ok = (n == 0) || (fwrite(p, 1, n, f) == n);
+    if (fclose(f) != 0) ok = false;
+    if (!ok) throw Error("cannot write " + name);
+}
+
+void writeFile(const std::string &name, const Bytes &data)
+{
+    writeData(name, data.empty() ? 0 : &data[0], data.size());
+}
+
+void writeFile(const std::string &name, const std::string &text)
+{
+    writeData(name, text.data(), text.size());
+}
+
+// CRC-32 //////////////////////////////////////////////////////////////////////
+
+uint32_t crc32(const uint8_t *p, size_t n, uint32_t crc)
+{
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? (c >> 1) ^ 0xEDB88320 : c >> 1;
+            table[i] = c;
+        }
+    }
+
+    crc = ~crc;
+    while (n--) crc = table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint32_t get16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | (get16(p + 2) << 16);
+}
+
+// BIT FILES ///////////////////////////////////////////////////////////////////
+
+// A .bit file is a 2-byte length and that many bytes of magic, a 2-byte
+// field count (always 1), then fields of a one letter key and a length:
+// 'a' .. 'd' with a 2-byte length and a NUL terminated string, and 'e' with
+// a 4-byte length and the configuration data.  All big-endian.
+
+namespace {
+
+struct BitReader {
+    const Bytes &bit;
+    size_t pos;
+
+    explicit BitReader(const Bytes &b) : bit(b), pos(0) {}
+
+    void need(size_t n, const char *what)
+    {
+        if (bit.size() - pos < n)
+            throw Error(std::string("bit file truncated in ") + what);
+    }
+
+    uint32_t be(size_t n, const char *what)
+    {
+        need(n, what);
+        uint32_t v = 0;
+        while (n--) v = (v << 8) | bit[pos++];
+        return v;
+    }
+
+    std::string str(const char *what)
+    {
+        size_t n = be(2, what);
+        need(n, what);
+        std::string s(bit.begin() + pos, bit.begin() + pos + n);
+        pos += n;
+        if (!s.empty() && s[s.size() - 1] == '\0') s.erase(s.size() - 1);
+        return s;
+    }
+};
+
+} // namespace
+
+BitFile parseBit(const Bytes &bit)
+{
+    static const uint8_t magic[] = { 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x00 };
+
+    BitReader r(bit);
+    BitFile bf;
+    bf.offset = 0;
+    bf.length = 0;
+
+    size_t n = r.be(2, "header");
+    r.need(n, "header");
+    if (n != sizeof magic || memcmp(&bit[r.pos], magic, n) != 0)
+        throw Error("not a Xilinx bit file");
+    r.pos += n;
+
+    if (r.be(2, "header") != 1) throw Error("bit file header field count is not 1");
+
+    // The order is always a, b, c, d, e, but only the data is required.
+    char last = 0;
+    for (;;) {
+        char key = (char)r.be(1, "field key");
+        if (key <= last) throw Error(std::string("bit file field '") + key + "' out of order");
+        last = key;
+
+        switch (key) {
+        case 'a': bf.design = r.str("design name"); break;
+        case 'b': bf.part   = r.str("part name");   break;
+        case 'c': bf.date   = r.str("date");        break;
+        case 'd': bf.time   = r.str("time");        break;
+
+        case 'e':
+            bf.length = r.be(4, "data length");
+            bf.offset = r.pos;
+            if (bit.size() - r.pos < bf.length)
+                throw Error("bit file data is shorter than its length field");
+            if (bit.size() - r.pos > bf.length)
+                throw Error("bit file has extra bytes after the data");
+            return bf;
+
+        default:
+            throw Error(std::string("bit file has an unknown field '") + key + "'");
+        }
+    }
+}
+
+// The payload padded with zeros to 16K, and to at least 21 blocks.  A
+// payload that is already a multiple of 16K gets one block of padding, the
+// same as bit2bin.
+
+Bytes bitToBin(const Bytes &bit)
+{
+    BitFile bf = parseBit(bit);
+
+    size_t blocks = bf.length / BIN_BLOCK + 1;
+    if (blocks < BIN_MIN_BLOCKS) blocks = BIN_MIN_BLOCKS;
+
+    Bytes bin(blocks * BIN_BLOCK, 0);
+    if (bf.length) memcpy(&bin[0], &bit[bf.offset], bf.length);
+    return bin;
+}
+
+// PHX FILES ///////////////////////////////////////////////////////////////////
+
+static void checkName(const std::string &name)
+{
+    if (name.empty() || name.size() > NAME_SIZE) throw Error("invalid name length");
+
+    for (size_t i = 0; i < name.size(); i++) {
+        char c = name[i];
+        if (!((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || c == ' ' || c == '-'))
+            throw Error("invalid character in name");
+    }
+}
+
+static bool allZero(const Bytes &b, size_t from)
+{
+    for (size_t i = from; i < b.size(); i++)
+        if (b[i]) return false;
+    return true;
+}
+
+Bytes makePhx(const Bytes &bin, const CoreInfo &info, const Bytes *extra)
+{
+    checkName(info.name);
+    if (info.issue > 65535) throw Error("issue out of range");
+
+    // The bin is usually padded past the slot, but only zeros may be cut.
+    if (!allZero(bin, BITSTREAM_SIZE - HEADER_SIZE))
+        throw Error("bitstream does not fit in a core slot");
+
+    // bin2phx reads the extra data a sector at a time until end of file,
+    // which adds a blank sector when the size is a multiple of 4K.
+    size_t extraSectors = 0;
+    if (extra) {
+        if (extra->size() > EXTRA_SIZE) throw Error("extra data is larger than 48K");
+        extraSectors = extra->size() / SECTOR_SIZE + 1;
+        if (extraSectors > EXTRA_SIZE / SECTOR_SIZE) extraSectors = EXTRA_SIZE / SECTOR_SIZE;
+    }
+
+    Bytes phx(BITSTREAM_SIZE + extraSectors * SECTOR_SIZE, 0);
+
+    size_t n = bin.size() < BITSTREAM_SIZE - HEADER_SIZE ? bin.size() : BITSTREAM_SIZE - HEADER_SIZE;
+    if (n) memcpy(&phx[HEADER_SIZE], &bin[0], n);
+    if (extra && !extra->empty()) memcpy(&phx[BITSTREAM_SIZE], &(*extra)[0], extra->size());
+
+    uint8_t *h = &phx[0];
+    memset(h, ' ', NAME_SIZE);
+    memcpy(h, info.name.data(), info.name.size());
+    put16(h + 0x10, info.issue);
+    put16(h + 0x12, HEADER_VERSION);
+    put32(h + 0x14, phx.size() - HEADER_SIZE);
+    put32(h + 0x18, crc32(&phx[HEADER_SIZE], phx.size() - HEADER_SIZE));
+    put32(h + 0x1C, crc32(h, 0x1C));
+
+    return phx;
+}
+
+CoreInfo verifyPhx(const Bytes &phx)
+{
+    if (phx.size() < HEADER_SIZE) throw Error("core file is shorter than the header");
+
+    const uint8_t *h = &phx[0];
+    if (get16(h + 0x12) < HEADER_VERSION) throw Error("no checksum in core file header");
+    if (get32(h + 0x1C) != crc32(h, 0x1C)) throw Error("core file header CRC mismatch");
+
+    CoreInfo info;
+    info.name.assign((const char *)h, NAME_SIZE);
+    info.issue = get16(h + 0x10);
+    info.length = phx.size() - HEADER_SIZE;
+    info.crc = crc32(h + HEADER_SIZE, info.length);
+
+    if (info.length != get32(h + 0x14)) throw Error("core file length mismatch");
+    if (info.crc != get32(h + 0x18)) throw Error("core file CRC mismatch");
+
+    return info;
+}
+
+// MEM FILES ///////////////////////////////////////////////////////////////////
+
+// 16 bytes per line, MEM files get an address line every 2K.
+
+std::string makeMem(const Bytes &rom, char format)
+{
+    static const char b2h[] = "0123456789ABCDEF";
+
+    std::string out;
+    out.reserve(rom.size() * 4 + rom.size() / 16 * 8);
+
+    for (size_t cnt = 0; cnt < rom.size(); ) {
+        uint8_t c = rom[cnt];
+
+        if (format == 'v') {
+            out += "x\"";
+            out += b2h[c >> 4];
+            out += b2h[c & 0xF];
+            out += "\",";
+        } else {
+            if (cnt % 2048 == 0) {
+                char adr[16];
+                snprintf(adr, sizeof adr, "@%04X\n", (unsigned)cnt);
+                out += adr;
+            }
+            out += b2h[c >> 4];
+            out += b2h[c & 0xF];
+            out += ' ';
+        }
+
+        cnt++;
+        if (cnt % 16 == 0) out += '\n';
+    }
+    return out;
+}
+
+// data2mem MEM text: "@addr" sets the address, then one hex byte per token.
+// Comments are "//" to the end of the line.
+
+Bytes readMem(const std::string &text, uint32_t start, size_t size)
+{
+    Bytes rom(size, 0);
+    uint32_t adr = start;
+
+    for (size_t i = 0; i < text.size(); ) {
+        char c = text[i];
+        if (isspace((unsigned char)c)) {
+            i++;
+            continue;
+        }
+        if (c == '/' && i + 1 < text.size() && text[i + 1] == '/') {
+            while (i < text.size() && text[i] != '\n') i++;
+            continue;
+        }
+
+        size_t n = i + (c == '@');
+        size_t e = n;
+        while (e < text.size() && isxdigit((unsigned char)text[e])) e++;
+        if (e == n || (e < text.size() && !isspace((unsigned char)text[e])))
+            throw Error("bad token in MEM file: " + text.substr(i, 16));
+
+        uint32_t v = strtoul(text.substr(n, e - n).c_str(), 0, 16);
+        if (c == '@') {
+            adr = v;
+        } else {
+            if (v > 0xFF) throw Error("MEM file data is not byte wide");
+            if (adr < start || adr - start >= size) throw Error("MEM file data outside the address space");
+            rom[adr++ - start] = v;
+        }
+        i = e;
+    }
+    return rom;
+}
+
+// BMM FILES ///////////////////////////////////////////////////////////////////
+
+// Only what a placed (_bd.bmm) file for a ROM of byte wide RAMB16s needs:
+//
+//   ADDRESS_MAP name PPC405 0
+//     ADDRESS_SPACE name RAMB16 [start:end]
+//       BUS_BLOCK
+//         instance RAMB16 [7:0] [0:2047] PLACED = X0Y30;
+//       END_BUS_BLOCK;
+//     END_ADDRESS_SPACE;
+//   END_ADDRESS_MAP;
+
+namespace {
+
+struct BmmReader {
+    std::vector<std::string> tok;
+    size_t pos;
+
+    explicit BmmReader(const std::string &text) : pos(0)
+    {
+        std::string t;
+        for (size_t i = 0; i < text.size(); i++) {
+            char c = text[i];
+            if (c == '/' && i + 1 < text.size() && text[i + 1] == '/') {
+                while (i < text.size() && text[i] != '\n') i++;
+                c = ' ';
+            } else if (c == '/' && i + 1 < text.size() && text[i + 1] == '*') {
+                size_t e = text.find("*/", i + 2);
+                i = e == std::string::npos ? text.size() : e + 1;
+                c = ' ';
+            }
+
+            if (isspace((unsigned char)c) || strchr("[]:;=", c)) {
+                if (!t.empty()) tok.push_back(t);
+                t.clear();
+                if (c != ' ' && !isspace((unsigned char)c)) tok.push_back(std::string(1, c));
+            } else {
+                t += c;
+            }
+        }
+        if (!t.empty()) tok.push_back(t);
+    }
+
+    bool more() const { return pos < tok.size(); }
+
+    std::string next()
+    {
+        if (!more()) throw Error("BMM file ends early");
+        return tok[pos++];
+    }
+
+    bool is(const char *t) const { return more() && tok[pos] == t; }
+
+    void expect(const char *t)
+    {
+        if (next() != t) throw Error(std::string("BMM file: expected '") + t + "' before '" + tok[pos - 1] + "'");
+    }
+
+    uint32_t number()
+    {
+        std::string t = next();
+        char *end;
+        uint32_t v = strtoul(t.c_str(), &end, 0);
+        if (*end) throw Error("BMM file: bad number '" + t + "'");
+        return v;
+    }
+
+    // [a:b]
+    void range(uint32_t &a, uint32_t &b)
+    {
+        expect("[");
+        a = number();
+        expect(":");
+        b = number();
+        expect("]");
+    }
+};
+
+} // namespace
+
+std::vector<BmmSpace> parseBmm(const std::string &text)
+{
+    BmmReader r(text);
+    std::vector<BmmSpace> spaces;
+
+    while (r.more()) {
+        r.expect("ADDRESS_MAP");
+        std::string map = r.next();
+        r.next();   // processor
+        r.next();   // JTAG id
+
+        while (!r.is("END_ADDRESS_MAP")) {
+            r.expect("ADDRESS_SPACE");
+            BmmSpace sp;
+            sp.name = map + "." + r.next();
+            if (r.next() != "RAMB16") throw Error("BMM file: " + sp.name + " is not RAMB16");
+            r.range(sp.start, sp.end);
+            if (sp.end < sp.start) throw Error("BMM file: " + sp.name + " has a bad address range");
+
+            while (!r.is("END_ADDRESS_SPACE")) {
+                r.expect("BUS_BLOCK");
+                BramBlock b;
+                b.inst = r.next();
+                if (!r.is("[")) r.next();   // RAMB16 in placed files
+                r.range(b.msb, b.lsb);
+                b.x = b.y = -1;
+
+                while (!r.is(";")) {
+                    std::string t = r.next();
+                    if (t == "[") {         // optional address range
+                        r.pos--;
+                        uint32_t a, e;
+                        r.range(a, e);
+                    } else if (t == "PLACED") {
+                        r.expect("=");
+                        std::string site = r.next();
+                        if (sscanf(site.c_str(), "X%dY%d", &b.x, &b.y) != 2)
+                            throw Error("BMM file: bad placement " + site + " for " + b.inst);
+                    } else {
+                        throw Error("BMM file: unexpected '" + t + "' after " + b.inst);
+                    }
+                }
+                r.expect(";");
+
+                if (!r.is("END_BUS_BLOCK"))
+                    throw Error("BMM file: only one RAMB16 per BUS_BLOCK is supported");
+                r.expect("END_BUS_BLOCK");
+                r.expect(";");
+
+                if (b.msb - b.lsb != 7) throw Error("BMM file: " + b.inst + " is not byte wide");
+                sp.blocks.push_back(b);
+            }
+            r.expect("END_ADDRESS_SPACE");
+            r.expect(";");
+
+            if ((sp.end - sp.start + 1) != sp.blocks.size() * RAMB16_BYTES)
+                throw Error("BMM file: " + sp.name + " size does not match its BUS_BLOCKs");
+            spaces.push_back(sp);
+        }
+        r.expect("END_ADDRESS_MAP");
+        r.expect(";");
+    }
+    return spaces;
+}
+
+// BRAM MERGE //////////////////////////////////////////////////////////////////
+
+// Spartan-6 configuration data is 16-bit words after the AA99 5566 sync.
+// Type 1 packets have a 3-bit type, 2-bit opcode, 6-bit register and 5-bit
+// word count; type 2 packets follow with a 32-bit word count.  A type 2
+// FDRI write (frame data) is followed by a 2-word auto CRC.
+//
+// The block RAM contents come after the logic frames in the first FDRI
+// write, as 18 frames of 65 words per RAMB16: 9 zero words, 1152 words with
+// the 18432 data and parity bits, and 9 zero words.  Each pair of
+// addresses takes 18 bits, two parity bits and then the data bits MSB
+// first, odd address first.  The RAMB16s are stored row by row from the top
+// of the device, each row by column, and each column top down, four per
+// row.  With CRC checking on, a changed bitstream needs new CRCs; the CRC
+// is not documented, so instead COR1 CRC_BYPASS is set and the CRC words
+// become 9876 DEFC, as bitgen does with -g CRC:Disable.
+
+namespace {
+
+const size_t FRAME_WORDS  = 65;
+const size_t RAMB16_WORDS = 18 * FRAME_WORDS;
+const size_t RAMB16_PAD   = 9;
+
+const unsigned REG_CRC    = 0;
+const unsigned REG_FAR    = 1;
+const unsigned REG_FDRI   = 3;
+const unsigned REG_CMD    = 5;
+const unsigned REG_COR1   = 10;
+const unsigned REG_IDCODE = 14;
+
+const uint16_t CMD_DESYNC      = 0x000D;
+const uint16_t COR1_CRC_BYPASS = 0x0010;
+const uint32_t CRC_BYPASS      = 0x9876DEFC;
+
+struct Device {
+    uint32_t idcode;
+    const char *name;
+    size_t bramFrame;           // first RAMB16 frame in the first FDRI write
+    int rows, cols;             // RAMB16 rows (4 RAMB16s each) and columns
+};
+
+const Device devices[] = {
+    { 0x04002093, "XC6SLX16", 2976, 4, 2 },
+};
+
+struct Stream {
+    uint8_t *data;
+    size_t words;
+
+    uint16_t get(size_t w) const { return (data[w * 2] << 8) | data[w * 2 + 1]; }
+    void put(size_t w, uint16_t v) { data[w * 2] = v >> 8; data[w * 2 + 1] = v & 0xFF; }
+};
+
+} // namespace
+
+size_t mergeBram(Bytes &bit, const BmmSpace &space, const Bytes &rom)
+{
+    BitFile bf = parseBit(bit);
+
+    size_t sync = 0;
+    while (sync + 4 <= bf.length && memcmp(&bit[bf.offset + sync], "\xAA\x99\x55\x66", 4) != 0)
+        sync++;
+    if (sync + 4 > bf.length) throw Error("no sync word in the bit file");
+
+    Stream s = { &bit[bf.offset + sync + 4], (bf.length - sync - 4) / 2 };
+
+    // Find the device, frame data and CRC words.
+    uint32_t idcode = 0;
+    size_t fdri = 0, fdriWords = 0, cor1 = 0;
+    bool farZero = false;
+    std::vector<size_t> crcs;
+
+    for (size_t w = 0; w < s.words; ) {
+        uint16_t h = s.get(w++);
+        unsigned type = h >> 13, op = (h >> 11) & 3, reg = (h >> 5) & 0x3F;
+        size_t n = h & 0x1F;
+
+        if (type == 2) {
+            if (w + 2 > s.words) break;
+            n = ((size_t)s.get(w) << 16) | s.get(w + 1);
+            w += 2;
+        } else if (type != 1) {
+            throw Error("unknown packet in the bit file");
+        }
+        if (op != 2) continue;     // NOOP, reads have no data
+        if (w + n > s.words) throw Error("bit file packet is cut off");
+
+        if (reg == REG_IDCODE && n == 2) idcode = ((uint32_t)s.get(w) << 16) | s.get(w + 1);
+        if (reg == REG_FAR) farZero = n == 2 && s.get(w) == 0 && s.get(w + 1) == 0;
+        if (reg == REG_COR1 && n == 1) cor1 = w;
+        if (reg == REG_CRC && n == 2) crcs.push_back(w);
+        if (reg == REG_FDRI && type == 2 && farZero && !fdri) {
+            fdri = w;
+            fdriWords = n;
+        }
+        if (reg == REG_CMD && n == 1 && s.get(w) == CMD_DESYNC) break;
+        w += n;
+
+        // a type 2 FDRI write is always followed by the two auto CRC words
+        if (reg == REG_FDRI && type == 2) {
+            if (w + 2 > s.words) throw Error("bit file is cut off after the frame data");
+            crcs.push_back(w);
+            w += 2;
+        }
+    }
+
+    const Device *dev = 0;
+    for (size_t i = 0; i < sizeof devices / sizeof devices[0]; i++)
+        if (devices[i].idcode == idcode) dev = &devices[i];
+    if (!dev) {
+        char id[16];
+        snprintf(id, sizeof id, "%08X", (unsigned)idcode);
+        throw Error(std::string("unsupported device, IDCODE ") + id);
+    }
+
+    size_t bram = fdri + dev->bramFrame * FRAME_WORDS;
+    if (!fdri || fdriWords < dev->bramFrame * FRAME_WORDS + dev->rows * dev->cols * 4 * RAMB16_WORDS)
+        throw Error("no block RAM frames in the bit file");
+    if (!cor1) throw Error("no COR1 write in the bit file");
+    if (rom.size() != space.blocks.size() * RAMB16_BYTES) throw Error("ROM size does not match the BMM");
+
+    size_t changed = 0;
+
+    for (size_t k = 0; k < space.blocks.size(); k++) {
+        const BramBlock &b = space.blocks[k];
+        if (b.x < 0 || b.x >= dev->cols || b.y < 0 || b.y >= dev->rows * 8 || (b.y & 1))
+            throw Error(b.inst + " is not placed on a " + dev->name + " RAMB16 site");
+
+        // rows from the top, then columns, then top down in the row
+        size_t idx = (dev->rows - 1 - b.y / 8) * dev->cols * 4 + b.x * 4 + 3 - (b.y % 8) / 2;
+        size_t base = bram + idx * RAMB16_WORDS + RAMB16_PAD;
+        const uint8_t *src = &rom[k * RAMB16_BYTES];
+
+        for (size_t a = 0; a < RAMB16_BYTES; a++) {
+            for (unsigned d = 0; d < 8; d++) {
+                size_t p = (a >> 1) * 18 + ((a & 1) ? 9 : 17) - d;
+                size_t w = base + p / 16;
+                uint16_t m = 0x8000 >> (p % 16);
+                uint16_t v = s.get(w);
+                uint16_t nv = ((src[a] >> d) & 1) ? v | m : v & ~m;
+                if (nv != v) {
+                    s.put(w, nv);
+                    changed++;
+                }
+            }
+        }
+    }
+
+    if (changed) {
+        s.put(cor1, s.get(cor1) | COR1_CRC_BYPASS);
+        for (size_t i = 0; i < crcs.size(); i++) {
+            s.put(crcs[i], CRC_BYPASS >> 16);
+            s.put(crcs[i] + 1, CRC_BYPASS & 0xFFFF);
+        }
+    }
+    return changed;
+}
+
+} // namespace phx
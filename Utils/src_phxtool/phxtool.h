@@ -0,0 +1,109 @@
+/**
+ * phxtool library: the steps that turn a Xilinx bit-stream and the boot ROM
+ * into the files the Phoenix needs, as used by the phxtool command line.
+ *
+ *   bit -> bin   strip the .bit header and pad to 16K (was bit2bin)
+ *   bin -> PHX   add the core header and checksums (was bin2phx)
+ *   rom -> MEM   data2mem MEM or VHDL BRAM init text (was makemem)
+ *   MEM -> bit   patch the boot ROM into the block RAMs (was data2mem)
+ *
+ * The outputs are byte for byte the same as the C tools they replace,
+ * except that a changed merge turns the bit-stream CRC checks off.
+ * Files are small (under 1MB), so each is read and written with a single
+ * call instead of a byte or sector at a time.
+ *
+ * Errors throw phx::Error with a message for the user.
+ */
+#ifndef PHXTOOL_H
+#define PHXTOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace phx {
+
+typedef std::vector<uint8_t> Bytes;
+
+struct Error : std::runtime_error {
+    explicit Error(const std::string &msg) : std::runtime_error(msg) {}
+};
+
+// PHX core file layout, see src_bin2phx/README.md
+const size_t SLOT_SIZE      = 512 * 1024;
+const size_t BITSTREAM_SIZE = 460 * 1024;
+const size_t EXTRA_SIZE     =  48 * 1024;
+const size_t SECTOR_SIZE    =   4 * 1024;
+const size_t HEADER_SIZE    = 256;
+const size_t NAME_SIZE      = 16;
+const unsigned HEADER_VERSION = 1;
+
+// bit2bin pads the payload to 16K blocks
+const size_t BIN_BLOCK      = 16 * 1024;
+const size_t BIN_MIN_BLOCKS = 21;
+
+// a byte wide RAMB16, 2048 x 8
+const size_t RAMB16_BYTES   = 2048;
+
+// file I/O, whole files at once
+Bytes readFile(const std::string &name);
+void writeFile(const std::string &name, const Bytes &data);
+void writeFile(const std::string &name, const std::string &text);
+
+// CRC-32, IEEE 802.3 (zlib), pass the previous result to continue
+uint32_t crc32(const uint8_t *p, size_t n, uint32_t crc = 0);
+
+// Xilinx .bit file fields
+struct BitFile {
+    std::string design;         // 'a' design name and bitgen options
+    std::string part;           // 'b' device
+    std::string date;           // 'c'
+    std::string time;           // 'd'
+    size_t offset;              // 'e' configuration data, position in the file
+    size_t length;              // and length in bytes
+};
+
+BitFile parseBit(const Bytes &bit);
+Bytes bitToBin(const Bytes &bit);
+
+// PHX core files
+struct CoreInfo {
+    std::string name;           // 16 chars max, A-Z 0-9 space and hyphen
+    unsigned issue;             // 0 .. 65535
+    uint32_t length;            // filled in by verifyPhx()
+    uint32_t crc;
+};
+
+Bytes makePhx(const Bytes &bin, const CoreInfo &info, const Bytes *extra);
+CoreInfo verifyPhx(const Bytes &phx);
+
+// ROM to data2mem MEM ('m') or VHDL BRAM init ('v') text
+std::string makeMem(const Bytes &rom, char format);
+
+// data2mem MEM text to bytes, 'size' bytes from address 'start', zero filled
+Bytes readMem(const std::string &text, uint32_t start, size_t size);
+
+// BMM files, the part data2mem needs for byte wide RAMB16 address spaces
+struct BramBlock {
+    std::string inst;           // instance name
+    unsigned msb, lsb;          // data bits, [7:0]
+    int x, y;                   // PLACED = XnYm, -1 if not placed
+};
+
+struct BmmSpace {
+    std::string name;           // "map.space", the data2mem tag
+    uint32_t start, end;        // address range
+    std::vector<BramBlock> blocks;  // one per BUS_BLOCK, 2K each
+};
+
+std::vector<BmmSpace> parseBmm(const std::string &text);
+
+// Write the ROM into the block RAMs of a Spartan-6 bit file, in place.
+// Returns the number of bits changed; the bit file is untouched if none.
+size_t mergeBram(Bytes &bit, const BmmSpace &space, const Bytes &rom);
+
+} // namespace phx
+
+#endif
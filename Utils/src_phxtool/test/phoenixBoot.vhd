@@ -0,0 +1,1536 @@
+x"31",x"00",x"80",x"C3",x"69",x"00",x"FF",x"FF",x"C3",x"38",x"00",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"C3",x"38",x"00",x"FF",x"FF",x"FF",x"FF",x"FF",x"C3",x"38",x"00",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"C3",x"38",x"00",x"FF",x"FF",x"FF",x"FF",x"FF",x"C3",x"38",x"00",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"C3",x"38",x"00",x"FF",x"FF",x"FF",x"FF",x"FF",x"FB",x"ED",x"4D",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"44",x"65",x"61",x"65",x"20",x"4C",x"75",x"6E",x"61",x"65",x"3A",x"20",x"42",x"65",x"6E",x"65",
+x"64",x"69",x"63",x"69",x"74",x"65",x"20",x"6E",x"6F",x"63",x"74",x"65",x"73",x"20",x"64",x"65",
+x"63",x"6F",x"72",x"61",x"2E",x"2E",x"C3",x"90",x"00",x"21",x"43",x"73",x"36",x"00",x"21",x"00",
+x"70",x"11",x"01",x"70",x"01",x"FF",x"1F",x"36",x"00",x"ED",x"B0",x"31",x"00",x"80",x"CD",x"D8",
+x"5E",x"CD",x"8B",x"2E",x"CD",x"15",x"0B",x"C7",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"F5",x"E5",x"21",x"43",x"73",x"CB",x"46",x"CA",x"A8",x"00",x"C5",x"D5",x"FD",x"E5",x"CD",x"51",
+x"2E",x"FD",x"E1",x"D1",x"C1",x"C3",x"AA",x"00",x"CB",x"FE",x"E1",x"F1",x"ED",x"45",x"21",x"02",
+x"00",x"39",x"F9",x"D1",x"E1",x"C1",x"79",x"B0",x"28",x"02",x"ED",x"B0",x"21",x"F8",x"FF",x"39",
+x"F9",x"C9",x"21",x"02",x"00",x"39",x"F9",x"E1",x"D1",x"C1",x"79",x"E6",x"03",x"28",x"05",x"73",
+x"23",x"0B",x"18",x"F6",x"78",x"B1",x"28",x"12",x"73",x"23",x"73",x"23",x"73",x"23",x"73",x"23",
+x"79",x"C6",x"FC",x"4F",x"78",x"CE",x"FF",x"47",x"18",x"EA",x"21",x"F8",x"FF",x"39",x"F9",x"C9",
+x"21",x"02",x"00",x"39",x"F9",x"D1",x"E1",x"C1",x"79",x"B0",x"CA",x"26",x"01",x"7D",x"93",x"7C",
+x"9A",x"E2",x"06",x"01",x"EE",x"80",x"F2",x"24",x"01",x"E5",x"79",x"85",x"6F",x"78",x"8C",x"67",
+x"7B",x"95",x"7A",x"9C",x"30",x"0D",x"79",x"83",x"5F",x"78",x"8A",x"57",x"1B",x"2B",x"ED",x"B8",
+x"E1",x"18",x"03",x"E1",x"ED",x"B0",x"21",x"F8",x"FF",x"39",x"F9",x"C9",x"3E",x"80",x"D3",x"BF",
+x"3E",x"81",x"D3",x"BF",x"3E",x"00",x"D3",x"BF",x"3E",x"80",x"D3",x"BF",x"3E",x"00",x"D3",x"BF",
+x"3E",x"82",x"D3",x"BF",x"3E",x"40",x"D3",x"BF",x"3E",x"83",x"D3",x"BF",x"3E",x"01",x"D3",x"BF",
+x"3E",x"84",x"D3",x"BF",x"3E",x"0E",x"D3",x"BF",x"3E",x"85",x"D3",x"BF",x"3E",x"03",x"D3",x"BF",
+x"3E",x"86",x"D3",x"BF",x"3E",x"E1",x"D3",x"BF",x"3E",x"87",x"D3",x"BF",x"21",x"45",x"73",x"36",
+x"20",x"21",x"02",x"00",x"39",x"7E",x"F6",x"E0",x"6F",x"C9",x"F0",x"F0",x"F0",x"F0",x"F0",x"F0",
+x"F0",x"F0",x"F0",x"D0",x"80",x"90",x"B0",x"30",x"40",x"00",x"1B",x"00",x"38",x"00",x"18",x"00",
+x"00",x"00",x"20",x"DB",x"55",x"31",x"B9",x"73",x"2A",x"0A",x"80",x"E9",x"CD",x"3D",x"3E",x"F5",
+x"F5",x"DD",x"7E",x"04",x"DD",x"4E",x"05",x"D3",x"BF",x"79",x"F6",x"40",x"D3",x"BF",x"DD",x"7E",
+x"06",x"DD",x"86",x"08",x"4F",x"DD",x"7E",x"07",x"DD",x"8E",x"09",x"47",x"33",x"33",x"C5",x"DD",
+x"7E",x"06",x"DD",x"96",x"FC",x"DD",x"7E",x"07",x"DD",x"9E",x"FD",x"D2",x"4B",x"02",x"DD",x"6E",
+x"06",x"DD",x"66",x"07",x"4E",x"23",x"DD",x"75",x"06",x"DD",x"74",x"07",x"1E",x"00",x"79",x"E6",
+x"C0",x"DD",x"77",x"FE",x"DD",x"36",x"FF",x"00",x"79",x"E6",x"3F",x"4F",x"0C",x"DD",x"7E",x"FE",
+x"B7",x"DD",x"B6",x"FF",x"28",x"26",x"DD",x"7E",x"FE",x"D6",x"40",x"DD",x"B6",x"FF",x"28",x"20",
+x"DD",x"6E",x"06",x"DD",x"66",x"07",x"DD",x"7E",x"FE",x"D6",x"80",x"DD",x"B6",x"FF",x"28",x"14",
+x"DD",x"7E",x"FE",x"D6",x"C0",x"DD",x"B6",x"FF",x"28",x"14",x"18",x"24",x"1E",x"00",x"18",x"20",
+x"1E",x"FF",x"18",x"1C",x"5E",x"23",x"DD",x"75",x"06",x"DD",x"74",x"07",x"18",x"12",x"EB",x"79",
+x"0D",x"B7",x"28",x"8B",x"1A",x"D3",x"BE",x"13",x"DD",x"73",x"06",x"DD",x"72",x"07",x"18",x"EF",
+x"79",x"0D",x"B7",x"CA",x"BF",x"01",x"7B",x"D3",x"BE",x"18",x"F5",x"DD",x"F9",x"DD",x"E1",x"C9",
+x"21",x"43",x"73",x"36",x"00",x"DB",x"BF",x"32",x"54",x"73",x"21",x"02",x"00",x"39",x"4E",x"79",
+x"0D",x"B7",x"C8",x"3A",x"43",x"73",x"07",x"30",x"FA",x"21",x"43",x"73",x"36",x"00",x"DB",x"BF",
+x"32",x"54",x"73",x"18",x"EA",x"CD",x"3D",x"3E",x"F5",x"F5",x"0E",x"FF",x"21",x"40",x"01",x"E3",
+x"AF",x"DD",x"77",x"FE",x"AF",x"DD",x"77",x"FF",x"3A",x"45",x"73",x"D6",x"20",x"20",x"3C",x"C5",
+x"21",x"00",x"02",x"E5",x"21",x"41",x"64",x"E5",x"21",x"00",x"01",x"E5",x"CD",x"55",x"2D",x"F1",
+x"F1",x"F1",x"21",x"00",x"02",x"E5",x"3E",x"18",x"F5",x"33",x"26",x"01",x"E5",x"CD",x"70",x"36",
+x"F1",x"33",x"21",x"C8",x"01",x"E3",x"21",x"8C",x"13",x"E5",x"21",x"00",x"09",x"E5",x"CD",x"43",
+x"28",x"F1",x"F1",x"F1",x"C1",x"21",x"00",x"01",x"E3",x"18",x"25",x"C5",x"21",x"40",x"01",x"E5",
+x"21",x"41",x"64",x"E5",x"21",x"40",x"01",x"E5",x"CD",x"55",x"2D",x"F1",x"F1",x"F1",x"21",x"40",
+x"01",x"E5",x"3E",x"20",x"F5",x"33",x"2E",x"40",x"E5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"C1",
+x"21",x"45",x"73",x"5E",x"16",x"00",x"13",x"13",x"13",x"42",x"DD",x"7E",x"FC",x"83",x"5F",x"DD",
+x"7E",x"FD",x"88",x"57",x"C5",x"D5",x"21",x"06",x"00",x"E5",x"21",x"78",x"04",x"E5",x"D5",x"CD",
+x"43",x"28",x"F1",x"F1",x"F1",x"D1",x"C1",x"FD",x"21",x"45",x"73",x"FD",x"6E",x"00",x"26",x"00",
+x"23",x"23",x"19",x"EB",x"C5",x"D5",x"21",x"12",x"00",x"E5",x"21",x"7F",x"04",x"E5",x"D5",x"CD",
+x"43",x"28",x"F1",x"F1",x"F1",x"D1",x"C1",x"FD",x"21",x"45",x"73",x"FD",x"6E",x"00",x"26",x"00",
+x"19",x"EB",x"C5",x"D5",x"21",x"16",x"00",x"E5",x"21",x"92",x"04",x"E5",x"D5",x"CD",x"43",x"28",
+x"F1",x"F1",x"F1",x"D1",x"C1",x"21",x"12",x"00",x"19",x"E3",x"FD",x"21",x"45",x"73",x"FD",x"6E",
+x"00",x"26",x"00",x"29",x"19",x"EB",x"C5",x"21",x"0B",x"00",x"E5",x"21",x"A9",x"04",x"E5",x"D5",
+x"CD",x"43",x"28",x"F1",x"F1",x"F1",x"C1",x"C5",x"3E",x"01",x"F5",x"33",x"CD",x"50",x"02",x"33",
+x"C1",x"3A",x"44",x"73",x"B7",x"28",x"19",x"C5",x"21",x"03",x"00",x"E5",x"21",x"B5",x"04",x"E5",
+x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"E5",x"CD",x"43",x"28",x"F1",x"F1",x"F1",x"C1",x"18",x"17",
+x"C5",x"21",x"03",x"00",x"E5",x"21",x"B9",x"04",x"E5",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"E5",
+x"CD",x"43",x"28",x"F1",x"F1",x"F1",x"C1",x"DD",x"7E",x"FE",x"B7",x"28",x"03",x"DD",x"35",x"FE",
+x"DD",x"7E",x"FF",x"B7",x"28",x"03",x"DD",x"35",x"FF",x"C5",x"CD",x"BD",x"04",x"C1",x"FD",x"21",
+x"39",x"72",x"FD",x"7E",x"00",x"91",x"28",x"9F",x"FD",x"4E",x"00",x"79",x"FE",x"39",x"28",x"45",
+x"D6",x"31",x"20",x"22",x"DD",x"7E",x"FE",x"B7",x"20",x"8D",x"FD",x"21",x"46",x"73",x"FD",x"7E",
+x"00",x"EE",x"04",x"FD",x"77",x"00",x"FD",x"7E",x"00",x"D3",x"BF",x"3E",x"B2",x"D3",x"BF",x"DD",
+x"36",x"FE",x"0F",x"C3",x"77",x"03",x"79",x"D6",x"32",x"C2",x"77",x"03",x"DD",x"7E",x"FF",x"B7",
+x"C2",x"77",x"03",x"3A",x"44",x"73",x"D6",x"01",x"3E",x"00",x"17",x"32",x"44",x"73",x"DD",x"36",
+x"FF",x"0F",x"C3",x"77",x"03",x"3A",x"45",x"73",x"D6",x"20",x"20",x"35",x"21",x"00",x"02",x"E5",
+x"3E",x"18",x"F5",x"33",x"26",x"01",x"E5",x"CD",x"70",x"36",x"F1",x"33",x"21",x"13",x"05",x"E3",
+x"21",x"EF",x"0B",x"E5",x"21",x"00",x"08",x"E5",x"CD",x"9C",x"01",x"F1",x"F1",x"21",x"00",x"02",
+x"E3",x"21",x"41",x"64",x"E5",x"21",x"00",x"01",x"E5",x"CD",x"43",x"28",x"F1",x"F1",x"F1",x"18",
+x"12",x"21",x"40",x"01",x"E5",x"21",x"41",x"64",x"E5",x"21",x"40",x"01",x"E5",x"CD",x"43",x"28",
+x"F1",x"F1",x"F1",x"DD",x"F9",x"DD",x"E1",x"C9",x"50",x"52",x"45",x"53",x"53",x"3A",x"00",x"31",
+x"20",x"54",x"4F",x"47",x"47",x"4C",x"45",x"20",x"53",x"43",x"41",x"4E",x"4C",x"49",x"4E",x"45",
+x"53",x"00",x"32",x"20",x"54",x"4F",x"47",x"47",x"4C",x"45",x"20",x"46",x"4C",x"49",x"43",x"4B",
+x"45",x"52",x"20",x"28",x"20",x"20",x"20",x"29",x"00",x"39",x"20",x"45",x"58",x"49",x"54",x"20",
+x"4D",x"45",x"4E",x"55",x"00",x"4F",x"4E",x"20",x"00",x"4F",x"46",x"46",x"00",x"3E",x"01",x"F5",
+x"33",x"CD",x"75",x"28",x"33",x"3A",x"39",x"72",x"3C",x"20",x"14",x"3A",x"3B",x"72",x"B7",x"20",
+x"0E",x"3A",x"3A",x"72",x"B7",x"20",x"08",x"3E",x"02",x"F5",x"33",x"CD",x"75",x"28",x"33",x"3A",
+x"C2",x"66",x"B7",x"C0",x"3A",x"C1",x"66",x"FD",x"21",x"39",x"72",x"FD",x"96",x"00",x"C8",x"FD",
+x"7E",x"00",x"FD",x"21",x"C1",x"66",x"FD",x"77",x"00",x"FD",x"21",x"39",x"72",x"FD",x"7E",x"00",
+x"D6",x"2A",x"28",x"07",x"FD",x"7E",x"00",x"D6",x"23",x"20",x"0E",x"21",x"C2",x"66",x"36",x"01",
+x"CD",x"75",x"02",x"21",x"C2",x"66",x"36",x"00",x"C9",x"FD",x"21",x"39",x"72",x"FD",x"7E",x"00",
+x"D6",x"30",x"CA",x"80",x"23",x"C9",x"C3",x"80",x"23",x"CD",x"3D",x"3E",x"F5",x"DD",x"4E",x"06",
+x"DD",x"46",x"07",x"DD",x"5E",x"04",x"DD",x"56",x"05",x"0A",x"B7",x"28",x"2F",x"03",x"C6",x"E3",
+x"6F",x"26",x"00",x"29",x"29",x"29",x"D5",x"11",x"74",x"13",x"19",x"D1",x"33",x"33",x"E5",x"C5",
+x"D5",x"21",x"08",x"00",x"E5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"D5",x"CD",x"43",x"28",
+x"F1",x"F1",x"F1",x"D1",x"C1",x"21",x"10",x"00",x"19",x"EB",x"18",x"CD",x"F1",x"DD",x"E1",x"C9",
+x"CD",x"3D",x"3E",x"21",x"F1",x"FF",x"39",x"F9",x"DD",x"36",x"F1",x"01",x"DD",x"7E",x"04",x"DD",
+x"77",x"FD",x"DD",x"7E",x"05",x"DD",x"77",x"FE",x"DD",x"5E",x"06",x"DD",x"56",x"07",x"1A",x"B7",
+x"CA",x"6A",x"06",x"DD",x"7E",x"FD",x"D3",x"BF",x"DD",x"7E",x"FE",x"F6",x"40",x"D3",x"BF",x"DD",
+x"73",x"F2",x"DD",x"72",x"F3",x"21",x"01",x"00",x"19",x"DD",x"75",x"F4",x"DD",x"74",x"F5",x"DD",
+x"7E",x"F4",x"DD",x"77",x"F6",x"DD",x"7E",x"F5",x"DD",x"77",x"F7",x"DD",x"73",x"F8",x"DD",x"72",
+x"F9",x"AF",x"DD",x"77",x"FF",x"DD",x"7E",x"F1",x"B7",x"28",x"10",x"0E",x"03",x"DD",x"6E",x"F8",
+x"DD",x"66",x"F9",x"7E",x"C6",x"E3",x"DD",x"77",x"FA",x"18",x"1F",x"DD",x"6E",x"F2",x"DD",x"66",
+x"F3",x"7E",x"C6",x"E3",x"4F",x"DD",x"6E",x"F6",x"DD",x"66",x"F7",x"7E",x"B7",x"20",x"06",x"DD",
+x"36",x"FA",x"03",x"18",x"05",x"C6",x"E3",x"DD",x"77",x"FA",x"26",x"00",x"69",x"29",x"29",x"29",
+x"DD",x"4E",x"FF",x"06",x"00",x"09",x"DD",x"75",x"FB",x"DD",x"74",x"FC",x"DD",x"6E",x"FA",x"26",
+x"00",x"29",x"29",x"29",x"09",x"4D",x"44",x"DD",x"7E",x"FB",x"C6",x"74",x"6F",x"DD",x"7E",x"FC",
+x"CE",x"13",x"67",x"7E",x"87",x"87",x"87",x"87",x"DD",x"77",x"FC",x"21",x"74",x"13",x"09",x"7E",
+x"07",x"07",x"07",x"07",x"E6",x"0F",x"DD",x"4E",x"FC",x"B1",x"D3",x"BE",x"DD",x"34",x"FF",x"DD",
+x"7E",x"FF",x"D6",x"08",x"DA",x"C5",x"05",x"DD",x"7E",x"FD",x"C6",x"10",x"DD",x"77",x"FD",x"30",
+x"03",x"DD",x"34",x"FE",x"DD",x"7E",x"F1",x"B7",x"28",x"07",x"AF",x"DD",x"77",x"F1",x"C3",x"8E",
+x"05",x"DD",x"5E",x"F4",x"DD",x"56",x"F5",x"C3",x"8E",x"05",x"DD",x"F9",x"DD",x"E1",x"C9",x"3E",
+x"8F",x"D3",x"BF",x"3E",x"AF",x"D3",x"BF",x"3E",x"00",x"D3",x"BE",x"3E",x"00",x"D3",x"BE",x"21",
+x"0A",x"00",x"E5",x"3E",x"F0",x"F5",x"33",x"21",x"03",x"10",x"E5",x"CD",x"70",x"36",x"F1",x"33",
+x"21",x"80",x"00",x"E3",x"21",x"0F",x"12",x"E5",x"21",x"40",x"02",x"E5",x"CD",x"43",x"28",x"F1",
+x"F1",x"F1",x"0E",x"01",x"3E",x"8F",x"D3",x"BF",x"3E",x"AF",x"D3",x"BF",x"79",x"D3",x"BE",x"79",
+x"87",x"87",x"87",x"87",x"B1",x"D3",x"BE",x"C5",x"3E",x"03",x"F5",x"33",x"CD",x"50",x"02",x"33",
+x"C1",x"0C",x"79",x"D6",x"10",x"38",x"DD",x"C9",x"CD",x"3D",x"3E",x"F5",x"21",x"13",x"00",x"E5",
+x"3E",x"60",x"F5",x"33",x"21",x"0D",x"10",x"E5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"01",x"02",
+x"11",x"DD",x"36",x"FF",x"10",x"C5",x"3E",x"02",x"F5",x"33",x"CD",x"50",x"02",x"33",x"C1",x"DD",
+x"6E",x"FF",x"26",x"00",x"2B",x"29",x"29",x"29",x"29",x"29",x"EB",x"0A",x"03",x"6F",x"26",x"00",
+x"19",x"EB",x"0A",x"DD",x"77",x"FE",x"03",x"DD",x"6E",x"FE",x"26",x"00",x"C5",x"E5",x"C5",x"D5",
+x"CD",x"43",x"28",x"F1",x"F1",x"F1",x"C1",x"79",x"DD",x"86",x"FE",x"4F",x"30",x"01",x"04",x"DD",
+x"35",x"FF",x"DD",x"7E",x"FF",x"B7",x"20",x"BD",x"F1",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",
+x"DD",x"6E",x"04",x"26",x"00",x"29",x"29",x"29",x"DD",x"75",x"FE",x"7C",x"C6",x"18",x"DD",x"77",
+x"FF",x"DD",x"4E",x"05",x"DD",x"46",x"06",x"59",x"50",x"1A",x"B7",x"28",x"1C",x"13",x"7B",x"4F",
+x"DD",x"96",x"05",x"6F",x"7A",x"DD",x"9E",x"06",x"67",x"3E",x"1F",x"BD",x"3E",x"00",x"9C",x"E2",
+x"64",x"07",x"EE",x"80",x"F2",x"49",x"07",x"AF",x"12",x"79",x"DD",x"4E",x"05",x"91",x"4F",x"41",
+x"2E",x"00",x"58",x"55",x"CB",x"7D",x"28",x"03",x"58",x"55",x"13",x"CB",x"2A",x"CB",x"1B",x"21",
+x"10",x"00",x"BF",x"ED",x"52",x"29",x"29",x"29",x"29",x"D1",x"D5",x"19",x"CB",x"41",x"28",x"15",
+x"01",x"F0",x"FF",x"09",x"4D",x"44",x"DD",x"6E",x"05",x"DD",x"66",x"06",x"E5",x"C5",x"CD",x"70",
+x"05",x"F1",x"F1",x"18",x"0D",x"DD",x"4E",x"05",x"DD",x"46",x"06",x"C5",x"E5",x"CD",x"29",x"05",
+x"F1",x"F1",x"F1",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"3B",x"3A",x"46",x"73",x"E6",x"04",x"32",
+x"46",x"73",x"CD",x"E2",x"12",x"01",x"00",x"60",x"69",x"60",x"36",x"FF",x"23",x"36",x"00",x"03",
+x"03",x"78",x"D6",x"64",x"38",x"F2",x"3A",x"00",x"80",x"D6",x"AA",x"C2",x"C3",x"08",x"21",x"C8",
+x"63",x"36",x"33",x"3E",x"FF",x"D3",x"C0",x"21",x"08",x"80",x"4E",x"23",x"46",x"03",x"03",x"21",
+x"0A",x"00",x"E5",x"2E",x"00",x"E5",x"C5",x"CD",x"C2",x"00",x"F1",x"F1",x"F1",x"21",x"14",x"00",
+x"E5",x"2E",x"00",x"E5",x"21",x"07",x"73",x"E5",x"CD",x"C2",x"00",x"F1",x"F1",x"F1",x"21",x"06",
+x"00",x"E5",x"2E",x"00",x"E5",x"21",x"EB",x"73",x"E5",x"CD",x"C2",x"00",x"F1",x"F1",x"F1",x"21",
+x"C6",x"63",x"36",x"00",x"2E",x"C7",x"36",x"00",x"21",x"00",x"40",x"E5",x"AF",x"F5",x"33",x"26",
+x"00",x"E5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"DB",x"BF",x"DD",x"77",x"FF",x"3E",x"00",x"D3",
+x"BF",x"3E",x"80",x"D3",x"BF",x"21",x"C3",x"63",x"36",x"00",x"3E",x"80",x"D3",x"BF",x"3E",x"81",
+x"D3",x"BF",x"2E",x"C4",x"36",x"80",x"3E",x"06",x"D3",x"BF",x"3E",x"82",x"D3",x"BF",x"3E",x"80",
+x"D3",x"BF",x"3E",x"83",x"D3",x"BF",x"3E",x"00",x"D3",x"BF",x"3E",x"84",x"D3",x"BF",x"3E",x"36",
+x"D3",x"BF",x"3E",x"85",x"D3",x"BF",x"3E",x"07",x"D3",x"BF",x"3E",x"86",x"D3",x"BF",x"21",x"0A",
+x"00",x"E5",x"21",x"89",x"01",x"E5",x"21",x"F2",x"63",x"E5",x"CD",x"AE",x"00",x"F1",x"F1",x"21",
+x"00",x"03",x"E3",x"21",x"74",x"13",x"E5",x"21",x"E8",x"00",x"E5",x"CD",x"43",x"28",x"F1",x"F1",
+x"21",x"08",x"00",x"E3",x"21",x"8C",x"13",x"E5",x"21",x"00",x"00",x"E5",x"CD",x"43",x"28",x"F1",
+x"F1",x"21",x"0F",x"00",x"E3",x"21",x"7A",x"01",x"E5",x"21",x"03",x"20",x"E5",x"CD",x"43",x"28",
+x"F1",x"F1",x"F1",x"21",x"09",x"00",x"E5",x"21",x"93",x"01",x"E5",x"21",x"00",x"60",x"E5",x"CD",
+x"AE",x"00",x"F1",x"F1",x"F1",x"CD",x"00",x"60",x"33",x"DD",x"E1",x"C9",x"3E",x"30",x"D3",x"55",
+x"C3",x"B6",x"07",x"CD",x"3D",x"3E",x"F5",x"F5",x"CD",x"BD",x"04",x"3A",x"39",x"72",x"D6",x"12",
+x"20",x"03",x"CD",x"DC",x"08",x"21",x"41",x"00",x"E5",x"2E",x"00",x"E5",x"21",x"00",x"64",x"E5",
+x"CD",x"C2",x"00",x"F1",x"F1",x"F1",x"1E",x"20",x"01",x"24",x"80",x"0A",x"D6",x"2F",x"28",x"06",
+x"1D",x"28",x"03",x"03",x"18",x"F5",x"7B",x"B7",x"20",x"05",x"C5",x"CD",x"DC",x"08",x"C1",x"03",
+x"1E",x"20",x"0A",x"D6",x"20",x"20",x"06",x"1D",x"28",x"03",x"03",x"18",x"F5",x"11",x"0C",x"0B",
+x"1A",x"DD",x"77",x"FE",x"B7",x"28",x"10",x"0A",x"DD",x"77",x"FF",x"DD",x"7E",x"FE",x"DD",x"96",
+x"FF",x"20",x"04",x"03",x"13",x"18",x"E9",x"1E",x"20",x"0A",x"D6",x"20",x"20",x"06",x"1D",x"28",
+x"03",x"03",x"18",x"F5",x"DD",x"36",x"FD",x"20",x"11",x"00",x"64",x"0A",x"6F",x"7B",x"C6",x"01",
+x"DD",x"77",x"FE",x"7A",x"CE",x"00",x"DD",x"77",x"FF",x"7D",x"D6",x"2F",x"28",x"14",x"DD",x"35",
+x"FD",x"DD",x"7E",x"FD",x"B7",x"28",x"0B",x"7D",x"03",x"12",x"DD",x"5E",x"FE",x"DD",x"56",x"FF",
+x"18",x"D9",x"33",x"33",x"C5",x"3E",x"20",x"12",x"0E",x"20",x"11",x"24",x"80",x"1A",x"D6",x"20",
+x"20",x"06",x"0D",x"28",x"03",x"13",x"18",x"F5",x"DD",x"7E",x"FE",x"0E",x"00",x"91",x"4F",x"3E",
+x"39",x"91",x"4F",x"1A",x"47",x"D6",x"2F",x"28",x"15",x"0D",x"28",x"12",x"13",x"DD",x"6E",x"FE",
+x"DD",x"66",x"FF",x"70",x"DD",x"34",x"FE",x"20",x"EA",x"DD",x"34",x"FF",x"18",x"E5",x"D1",x"C1",
+x"C5",x"D5",x"DD",x"36",x"FF",x"20",x"D1",x"D5",x"1A",x"13",x"D6",x"2F",x"3E",x"01",x"28",x"01",
+x"AF",x"6F",x"CB",x"45",x"20",x"09",x"DD",x"35",x"FF",x"DD",x"7E",x"FF",x"B7",x"20",x"E9",x"7D",
+x"B7",x"28",x"19",x"3E",x"20",x"02",x"03",x"3E",x"1D",x"02",x"03",x"1A",x"13",x"02",x"03",x"1A",
+x"13",x"02",x"03",x"1A",x"13",x"02",x"03",x"1A",x"02",x"03",x"AF",x"02",x"0B",x"59",x"50",x"7B",
+x"D6",x"00",x"7A",x"DE",x"64",x"38",x"09",x"0A",x"B7",x"20",x"F1",x"3E",x"20",x"02",x"18",x"EC",
+x"21",x"40",x"64",x"36",x"00",x"3A",x"00",x"64",x"D6",x"20",x"20",x"14",x"21",x"40",x"00",x"E5",
+x"21",x"01",x"64",x"E5",x"21",x"00",x"64",x"E5",x"CD",x"F0",x"00",x"F1",x"F1",x"F1",x"18",x"E5",
+x"01",x"00",x"64",x"0A",x"B7",x"28",x"39",x"59",x"50",x"13",x"D6",x"20",x"20",x"2E",x"1A",x"D6",
+x"20",x"20",x"29",x"79",x"D6",x"00",x"6F",x"78",x"DE",x"64",x"67",x"3E",x"40",x"95",x"6F",x"3E",
+x"00",x"9C",x"67",x"DD",x"71",x"FE",x"DD",x"70",x"FF",x"C5",x"E5",x"D5",x"DD",x"6E",x"FE",x"DD",
+x"66",x"FF",x"E5",x"CD",x"F0",x"00",x"F1",x"F1",x"F1",x"C1",x"18",x"C7",x"4B",x"42",x"18",x"C3",
+x"11",x"40",x"64",x"4B",x"42",x"79",x"D6",x"00",x"78",x"DE",x"64",x"38",x"07",x"1A",x"B7",x"20",
+x"03",x"1B",x"18",x"EF",x"7B",x"D6",x"00",x"4F",x"7A",x"DE",x"64",x"47",x"3E",x"1F",x"B9",x"3E",
+x"00",x"98",x"E2",x"97",x"0A",x"EE",x"80",x"F2",x"D8",x"0A",x"11",x"1E",x"64",x"4B",x"42",x"1A",
+x"D6",x"20",x"3E",x"01",x"28",x"01",x"AF",x"6F",x"3E",x"00",x"91",x"3E",x"64",x"98",x"30",x"07",
+x"CB",x"45",x"20",x"03",x"1B",x"18",x"E6",x"7D",x"B7",x"28",x"2A",x"AF",x"12",x"D5",x"21",x"00",
+x"64",x"E5",x"AF",x"F5",x"33",x"CD",x"2C",x"07",x"F1",x"33",x"D1",x"13",x"D5",x"3E",x"01",x"F5",
+x"33",x"CD",x"2C",x"07",x"F1",x"33",x"18",x"0D",x"21",x"00",x"64",x"E5",x"3E",x"01",x"F5",x"33",
+x"CD",x"2C",x"07",x"F1",x"33",x"0E",x"FF",x"79",x"0D",x"B7",x"28",x"18",x"C5",x"CD",x"BD",x"04",
+x"C1",x"3A",x"39",x"72",x"D6",x"12",x"28",x"0C",x"C5",x"3E",x"01",x"F5",x"33",x"CD",x"50",x"02",
+x"33",x"C1",x"18",x"E3",x"CD",x"DC",x"08",x"DD",x"F9",x"DD",x"E1",x"C9",x"50",x"52",x"45",x"53",
+x"45",x"4E",x"54",x"53",x"00",x"3B",x"E5",x"21",x"43",x"73",x"CB",x"86",x"E1",x"21",x"00",x"40",
+x"E5",x"AF",x"F5",x"33",x"26",x"00",x"E5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"CD",x"C0",x"12",
+x"CD",x"8F",x"12",x"3E",x"20",x"D3",x"BF",x"3E",x"9E",x"D3",x"BF",x"3E",x"02",x"F5",x"33",x"CD",
+x"2C",x"01",x"33",x"FD",x"21",x"00",x"00",x"FD",x"39",x"FD",x"75",x"00",x"3E",x"00",x"D3",x"BF",
+x"3E",x"07",x"F6",x"40",x"D3",x"BF",x"0E",x"00",x"3E",x"AF",x"D3",x"BE",x"79",x"87",x"87",x"87",
+x"87",x"D3",x"BE",x"79",x"87",x"87",x"D3",x"BE",x"3E",x"0F",x"D3",x"BE",x"0C",x"79",x"D6",x"10",
+x"38",x"E6",x"3E",x"D0",x"D3",x"BE",x"21",x"00",x"03",x"E5",x"3E",x"18",x"F5",x"33",x"26",x"00",
+x"E5",x"CD",x"70",x"36",x"F1",x"33",x"21",x"20",x"00",x"E3",x"3E",x"F0",x"F5",x"33",x"21",x"00",
+x"10",x"E5",x"CD",x"70",x"36",x"F1",x"33",x"21",x"13",x"05",x"E3",x"21",x"EF",x"0B",x"E5",x"21",
+x"00",x"08",x"E5",x"CD",x"9C",x"01",x"F1",x"F1",x"F1",x"21",x"00",x"00",x"39",x"7E",x"D3",x"BF",
+x"3E",x"81",x"D3",x"BF",x"3E",x"02",x"F5",x"33",x"CD",x"50",x"02",x"33",x"3A",x"00",x"80",x"D6",
+x"55",x"20",x"0D",x"3A",x"01",x"80",x"D6",x"AA",x"20",x"06",x"CD",x"BD",x"04",x"CD",x"DC",x"08",
+x"CD",x"6F",x"06",x"CD",x"C8",x"06",x"21",x"00",x"80",x"7E",x"D6",x"AA",x"20",x"0B",x"21",x"01",
+x"80",x"7E",x"D6",x"55",x"20",x"03",x"CD",x"E3",x"08",x"33",x"C3",x"96",x"23",x"33",x"C9",x"C0",
+x"7E",x"85",x"18",x"00",x"85",x"C6",x"C2",x"7C",x"00",x"FC",x"82",x"C6",x"CB",x"FC",x"CC",x"C6",
+x"00",x"7C",x"C6",x"C0",x"7C",x"06",x"C6",x"7C",x"00",x"86",x"18",x"08",x"82",x"C6",x"C5",x"D6",
+x"FE",x"EE",x"C6",x"00",x"7C",x"82",x"C6",x"CA",x"FE",x"C6",x"C6",x"00",x"7C",x"C6",x"C0",x"7C",
+x"06",x"C6",x"7C",x"08",x"82",x"C6",x"C0",x"FE",x"82",x"C6",x"C9",x"00",x"FE",x"C0",x"C0",x"FC",
+x"C0",x"C0",x"FE",x"00",x"FC",x"82",x"C6",x"CD",x"FC",x"CC",x"C6",x"00",x"FE",x"C0",x"C0",x"FC",
+x"C0",x"C0",x"FE",x"00",x"07",x"01",x"02",x"C4",x"11",x"0F",x"07",x"C0",x"E0",x"83",x"F0",x"C5",
+x"E0",x"C0",x"FE",x"C0",x"C0",x"FC",x"82",x"C0",x"C1",x"00",x"7C",x"84",x"C6",x"C2",x"7C",x"00",
+x"FC",x"82",x"C6",x"C2",x"FC",x"CC",x"C6",x"08",x"85",x"60",x"C1",x"7E",x"00",x"85",x"C6",x"CA",
+x"7C",x"00",x"C6",x"E6",x"F6",x"DE",x"CE",x"C6",x"C6",x"00",x"7C",x"82",x"C6",x"C2",x"FE",x"C6",
+x"C6",x"08",x"46",x"C0",x"80",x"46",x"C1",x"00",x"FE",x"45",x"C5",x"7F",x"07",x"07",x"87",x"C7",
+x"C7",x"82",x"E7",x"87",x"FE",x"88",x"01",x"C2",x"87",x"87",x"8F",x"83",x"9F",x"4E",x"C2",x"F0",
+x"F8",x"FE",x"45",x"82",x"0F",x"C1",x"8F",x"8F",x"82",x"CF",x"46",x"86",x"FC",x"C1",x"F8",x"00",
+x"46",x"C4",x"0F",x"81",x"E1",x"F1",x"F1",x"83",x"F9",x"C4",x"8F",x"87",x"83",x"81",x"81",x"82",
+x"80",x"C0",x"FE",x"44",x"CF",x"7F",x"3F",x"00",x"00",x"80",x"80",x"C0",x"E0",x"F0",x"F9",x"07",
+x"0F",x"1F",x"3F",x"7F",x"7F",x"42",x"C6",x"FE",x"FC",x"F8",x"F0",x"E0",x"E0",x"C0",x"42",x"84",
+x"80",x"42",x"04",x"C2",x"FF",x"FF",x"FC",x"04",x"C0",x"87",x"86",x"07",x"42",x"84",x"FE",x"42",
+x"84",x"01",x"87",x"9F",x"85",x"F0",x"41",x"05",x"41",x"85",x"7F",x"41",x"87",x"CF",x"41",x"83",
+x"FC",x"43",x"03",x"C3",x"FF",x"FF",x"F0",x"F0",x"03",x"C1",x"F8",x"FC",x"87",x"80",x"87",x"0F",
+x"87",x"F9",x"86",x"80",x"C6",x"81",x"07",x"0F",x"1F",x"1F",x"3F",x"7F",x"45",x"C3",x"F9",x"F1",
+x"F0",x"E0",x"02",x"C4",x"80",x"C0",x"E0",x"E0",x"F0",x"83",x"80",x"43",x"03",x"43",x"83",x"7F",
+x"43",x"85",x"E7",x"C1",x"C7",x"C7",x"83",x"FE",x"43",x"83",x"01",x"43",x"87",x"F0",x"87",x"7F",
+x"82",x"FC",x"44",x"02",x"44",x"02",x"C0",x"E0",x"83",x"F0",x"CB",x"1F",x"0F",x"07",x"07",x"03",
+x"01",x"01",x"03",x"FF",x"FF",x"FE",x"FC",x"82",x"F8",x"C1",x"FC",x"80",x"06",x"44",x"02",x"84",
+x"80",x"02",x"84",x"07",x"02",x"83",x"FE",x"C0",x"FC",x"02",x"84",x"01",x"02",x"C4",x"9F",x"8F",
+x"8F",x"87",x"01",x"02",x"42",x"C1",x"FE",x"FC",x"02",x"C3",x"87",x"87",x"03",x"01",x"03",x"43",
+x"C0",x"7F",x"02",x"83",x"FC",x"C0",x"F8",x"02",x"84",x"0F",x"02",x"84",x"F9",x"02",x"C4",x"81",
+x"83",x"87",x"8F",x"8F",x"02",x"43",x"C0",x"FE",x"02",x"C2",x"C0",x"80",x"80",x"04",x"C4",x"3F",
+x"3F",x"1F",x"0F",x"07",x"02",x"C4",x"F8",x"FC",x"FE",x"FE",x"FF",x"02",x"77",x"07",x"C2",x"3F",
+x"7F",x"7F",x"84",x"3F",x"C1",x"FE",x"FE",x"45",x"03",x"C3",x"80",x"F0",x"FC",x"FC",x"04",x"C2",
+x"01",x"01",x"07",x"4A",x"84",x"FE",x"C0",x"80",x"06",x"C0",x"7F",x"86",x"3F",x"C7",x"83",x"81",
+x"C1",x"C1",x"A0",x"A0",x"80",x"C0",x"84",x"F8",x"C2",x"FC",x"7C",x"7C",x"05",x"C1",x"01",x"01",
+x"02",x"C5",x"01",x"03",x"8F",x"FF",x"FF",x"7F",x"46",x"C2",x"F0",x"F8",x"FC",x"44",x"C2",x"00",
+x"00",x"7E",x"44",x"04",x"C2",x"80",x"C0",x"C0",x"03",x"C5",x"01",x"03",x"0F",x"1F",x"3F",x"7F",
+x"42",x"CA",x"FE",x"FC",x"F8",x"F0",x"E0",x"C0",x"C1",x"80",x"00",x"01",x"01",x"02",x"C4",x"80",
+x"F0",x"F0",x"E0",x"E0",x"83",x"0F",x"83",x"07",x"D1",x"F0",x"F8",x"F8",x"FC",x"FE",x"F9",x"E1",
+x"E0",x"F0",x"78",x"28",x"14",x"08",x"04",x"80",x"C0",x"03",x"01",x"05",x"42",x"C5",x"1F",x"0F",
+x"03",x"01",x"00",x"8F",x"4D",x"CB",x"FE",x"FE",x"F8",x"F0",x"E0",x"C0",x"80",x"00",x"00",x"03",
+x"07",x"07",x"03",x"CB",x"01",x"F0",x"C1",x"03",x"07",x"0F",x"3F",x"FF",x"FF",x"F8",x"F9",x"F9",
+x"49",x"C7",x"FE",x"FE",x"FC",x"FE",x"FE",x"FC",x"98",x"10",x"02",x"C7",x"33",x"40",x"80",x"00",
+x"00",x"01",x"03",x"07",x"83",x"7F",x"43",x"C1",x"F0",x"FC",x"45",x"C2",x"1F",x"1F",x"0F",x"82",
+x"1F",x"C5",x"01",x"00",x"FE",x"FF",x"FE",x"FE",x"43",x"C8",x"60",x"30",x"98",x"4C",x"22",x"80",
+x"C0",x"80",x"07",x"06",x"C0",x"10",x"06",x"C1",x"1F",x"1C",x"05",x"C0",x"E0",x"0B",x"C7",x"01",
+x"07",x"1F",x"05",x"03",x"07",x"1F",x"7F",x"42",x"C1",x"C0",x"C0",x"82",x"80",x"02",x"86",x"01",
+x"C8",x"00",x"FE",x"FC",x"FE",x"FC",x"FE",x"FF",x"FF",x"1F",x"02",x"C4",x"08",x"01",x"80",x"C0",
+x"F8",x"04",x"C0",x"20",x"06",x"CA",x"07",x"00",x"00",x"1E",x"78",x"07",x"1F",x"FF",x"8F",x"1F",
+x"E7",x"44",x"C6",x"FE",x"FC",x"F8",x"80",x"C0",x"80",x"80",x"03",x"83",x"07",x"C4",x"0F",x"0F",
+x"06",x"00",x"FC",x"44",x"C3",x"7F",x"7F",x"00",x"00",x"45",x"02",x"C4",x"F8",x"F8",x"F0",x"F8",
+x"F8",x"02",x"C4",x"04",x"06",x"07",x"07",x"03",x"04",x"C6",x"81",x"F1",x"FF",x"00",x"00",x"F0",
+x"FE",x"43",x"C3",x"0F",x"0F",x"7F",x"3F",x"48",x"C2",x"F1",x"C0",x"80",x"43",x"CC",x"F1",x"E0",
+x"00",x"00",x"FE",x"FE",x"FC",x"F8",x"F8",x"F0",x"00",x"00",x"3C",x"06",x"82",x"07",x"84",x"03",
+x"87",x"F0",x"03",x"C5",x"70",x"70",x"78",x"78",x"00",x"01",x"05",x"CA",x"C0",x"C0",x"D0",x"D0",
+x"D3",x"F3",x"FB",x"7B",x"FF",x"7F",x"7F",x"44",x"C0",x"C0",x"82",x"80",x"83",x"C0",x"C0",x"01",
+x"06",x"C7",x"FF",x"CF",x"0F",x"07",x"07",x"03",x"01",x"00",x"42",x"C7",x"FE",x"FC",x"F8",x"E0",
+x"00",x"FF",x"8F",x"07",x"04",x"C4",x"FF",x"FF",x"3F",x"1F",x"0F",x"03",x"82",x"80",x"08",x"C2",
+x"0F",x"0F",x"1F",x"03",x"C3",x"06",x"1E",x"FE",x"FE",x"02",x"C4",x"18",x"3E",x"7F",x"7F",x"FF",
+x"02",x"C1",x"04",x"0E",x"42",x"05",x"C3",x"C0",x"C0",x"3F",x"3F",x"84",x"7F",x"C4",x"3F",x"FF",
+x"FF",x"CF",x"8F",x"82",x"C7",x"C0",x"C3",x"84",x"FC",x"CA",x"FE",x"FE",x"FF",x"00",x"00",x"08",
+x"0C",x"1C",x"3C",x"7E",x"7F",x"06",x"C0",x"E0",x"82",x"3F",x"82",x"1F",x"C1",x"3F",x"3F",x"45",
+x"C3",x"FC",x"F0",x"FE",x"FE",x"83",x"FC",x"C2",x"7E",x"7E",x"0F",x"86",x"1F",x"45",x"D5",x"F1",
+x"F0",x"C0",x"E0",x"E0",x"D0",x"C0",x"E0",x"E0",x"F0",x"3E",x"3F",x"1F",x"1F",x"0F",x"0F",x"07",
+x"07",x"00",x"00",x"FC",x"FC",x"82",x"FE",x"40",x"05",x"C0",x"01",x"84",x"03",x"C2",x"07",x"07",
+x"0F",x"44",x"C7",x"FC",x"F0",x"C0",x"00",x"FF",x"FF",x"FE",x"B8",x"02",x"C8",x"01",x"FF",x"87",
+x"03",x"0F",x"1F",x"7F",x"FF",x"FD",x"82",x"E0",x"83",x"F0",x"C0",x"F8",x"02",x"C7",x"01",x"1F",
+x"7F",x"FF",x"FF",x"1F",x"3F",x"7F",x"44",x"CF",x"F8",x"F0",x"F0",x"E0",x"C0",x"80",x"80",x"00",
+x"03",x"03",x"07",x"07",x"0F",x"0F",x"1F",x"3F",x"87",x"E0",x"C0",x"3F",x"44",x"EC",x"7F",x"3F",
+x"E0",x"F0",x"F8",x"FC",x"FE",x"FF",x"F9",x"FC",x"60",x"30",x"18",x"0C",x"06",x"00",x"80",x"C0",
+x"7F",x"3F",x"1F",x"0F",x"03",x"01",x"00",x"00",x"FC",x"F8",x"F9",x"FB",x"FF",x"3F",x"3F",x"0F",
+x"00",x"40",x"E0",x"F4",x"FC",x"FC",x"F8",x"F8",x"07",x"1F",x"7F",x"42",x"C1",x"DF",x"1F",x"45",
+x"C1",x"FE",x"F8",x"43",x"C7",x"FE",x"FC",x"F0",x"00",x"F8",x"E0",x"C0",x"80",x"03",x"CF",x"07",
+x"0F",x"1E",x"3C",x"78",x"01",x"01",x"02",x"FF",x"FF",x"7F",x"7F",x"FF",x"FF",x"BF",x"7F",x"44",
+x"C2",x"F3",x"F1",x"E1",x"82",x"80",x"82",x"C0",x"C4",x"80",x"80",x"FF",x"FF",x"03",x"84",x"01",
+x"82",x"80",x"C7",x"C0",x"E0",x"F8",x"FC",x"FE",x"00",x"01",x"01",x"04",x"C2",x"FF",x"FF",x"81",
+x"02",x"CC",x"01",x"07",x"EF",x"DF",x"3F",x"7F",x"7F",x"FF",x"BF",x"3F",x"FF",x"FE",x"FE",x"44",
+x"06",x"C2",x"80",x"1F",x"1F",x"82",x"0F",x"82",x"07",x"C3",x"FE",x"F7",x"F0",x"F0",x"82",x"F8",
+x"C5",x"FC",x"30",x"86",x"00",x"00",x"04",x"07",x"CC",x"06",x"00",x"07",x"1F",x"38",x"03",x"3F",
+x"7F",x"3F",x"1F",x"FF",x"87",x"1F",x"45",x"C1",x"F0",x"F0",x"82",x"E0",x"C2",x"E3",x"FF",x"FF",
+x"83",x"3F",x"C3",x"3E",x"3E",x"7E",x"7E",x"42",x"C5",x"7F",x"3F",x"1F",x"0F",x"0F",x"E1",x"46",
+x"86",x"F8",x"C5",x"F0",x"03",x"03",x"01",x"81",x"81",x"82",x"80",x"45",x"C5",x"E6",x"C6",x"FF",
+x"F1",x"C0",x"80",x"03",x"42",x"C1",x"FE",x"3C",x"02",x"82",x"03",x"C1",x"01",x"01",x"02",x"45",
+x"C5",x"3F",x"03",x"E0",x"E0",x"F8",x"F8",x"43",x"C4",x"78",x"F8",x"F9",x"FD",x"FD",x"42",x"C9",
+x"00",x"00",x"20",x"30",x"90",x"9C",x"FD",x"FF",x"7F",x"7F",x"46",x"82",x"FE",x"C3",x"FC",x"F8",
+x"F0",x"C0",x"0C",x"06",x"B2",x"B3",x"B4",x"B5",x"B6",x"B7",x"0B",x"07",x"F9",x"FA",x"FB",x"FC",
+x"FD",x"FE",x"FF",x"0A",x"09",x"AA",x"AB",x"6D",x"AC",x"AD",x"AE",x"AF",x"B0",x"B1",x"0A",x"0B",
+x"F1",x"F2",x"F3",x"F4",x"68",x"68",x"F5",x"6D",x"F6",x"F7",x"F8",x"09",x"0F",x"9F",x"A0",x"A1",
+x"A2",x"68",x"68",x"68",x"A3",x"A4",x"A5",x"A6",x"6D",x"A7",x"A8",x"A9",x"09",x"0F",x"EA",x"EB",
+x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"ED",x"EE",x"EF",x"6D",x"F0",x"08",x"11",x"97",
+x"98",x"99",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"9B",x"9C",x"75",x"9D",x"9E",
+x"08",x"11",x"E3",x"E4",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"E5",x"E6",
+x"E7",x"E8",x"E9",x"07",x"12",x"8D",x"8E",x"8F",x"68",x"68",x"68",x"90",x"91",x"68",x"92",x"93",
+x"68",x"68",x"68",x"94",x"95",x"6D",x"96",x"07",x"13",x"D5",x"D6",x"D7",x"68",x"68",x"D8",x"D9",
+x"DA",x"68",x"DB",x"DC",x"DD",x"DE",x"68",x"68",x"DF",x"E0",x"E1",x"E2",x"07",x"12",x"7D",x"7E",
+x"7F",x"80",x"81",x"82",x"83",x"84",x"68",x"85",x"86",x"87",x"88",x"89",x"68",x"8A",x"8B",x"8C",
+x"07",x"12",x"C5",x"C6",x"C7",x"C8",x"C9",x"CA",x"CB",x"6D",x"CC",x"CD",x"CE",x"CF",x"D0",x"D1",
+x"D2",x"D3",x"6D",x"D4",x"08",x"11",x"70",x"71",x"72",x"68",x"68",x"73",x"74",x"75",x"76",x"77",
+x"78",x"68",x"79",x"7A",x"7B",x"6A",x"7C",x"08",x"10",x"BD",x"BE",x"BF",x"68",x"68",x"68",x"68",
+x"C0",x"C1",x"68",x"68",x"68",x"68",x"C2",x"C3",x"C4",x"08",x"11",x"69",x"6A",x"6B",x"68",x"68",
+x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"6C",x"6D",x"6E",x"6F",x"08",x"11",x"B8",x"B9",
+x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"68",x"BA",x"BB",x"BC",x"18",
+x"20",x"19",x"1A",x"1B",x"1C",x"1D",x"18",x"1E",x"20",x"1F",x"21",x"1A",x"1A",x"22",x"23",x"24",
+x"1A",x"1A",x"25",x"20",x"19",x"1A",x"26",x"27",x"20",x"28",x"29",x"2A",x"2B",x"2C",x"18",x"18",
+x"20",x"42",x"43",x"44",x"45",x"46",x"43",x"47",x"20",x"33",x"48",x"18",x"18",x"49",x"37",x"4A",
+x"4B",x"4B",x"4C",x"20",x"3B",x"18",x"3C",x"3D",x"20",x"3B",x"4D",x"20",x"4E",x"4F",x"18",x"18",
+x"20",x"2D",x"2E",x"2F",x"30",x"31",x"2E",x"32",x"20",x"33",x"34",x"35",x"35",x"36",x"37",x"38",
+x"39",x"39",x"3A",x"20",x"3B",x"18",x"3C",x"3D",x"20",x"3E",x"3F",x"40",x"1B",x"41",x"18",x"18",
+x"50",x"51",x"18",x"18",x"52",x"53",x"18",x"54",x"50",x"55",x"50",x"50",x"50",x"56",x"57",x"58",
+x"50",x"50",x"59",x"50",x"51",x"18",x"5A",x"5B",x"50",x"5C",x"5D",x"5E",x"5F",x"60",x"18",x"3E",
+x"1C",x"D3",x"BF",x"3E",x"B9",x"D3",x"BF",x"3E",x"1C",x"D3",x"BF",x"3E",x"B9",x"D3",x"BF",x"C9",
+x"00",x"00",x"00",x"00",x"C3",x"02",x"D6",x"05",x"4F",x"05",x"6F",x"07",x"54",x"0D",x"EF",x"04",
+x"54",x"0F",x"76",x"0F",x"C3",x"0D",x"D6",x"0E",x"B2",x"02",x"5C",x"0C",x"CC",x"0C",x"FF",x"0F",
+x"3E",x"80",x"D3",x"BF",x"3E",x"B2",x"D3",x"BF",x"3E",x"00",x"D3",x"BF",x"3E",x"87",x"D3",x"BF",
+x"3E",x"80",x"D3",x"BF",x"3E",x"81",x"D3",x"BF",x"C9",x"3E",x"00",x"D3",x"BF",x"3E",x"B9",x"D3",
+x"BF",x"C9",x"CD",x"C0",x"12",x"CD",x"8F",x"12",x"3E",x"00",x"D3",x"BF",x"3E",x"B8",x"D3",x"BF",
+x"3E",x"00",x"D3",x"BF",x"3E",x"98",x"D3",x"BF",x"3E",x"10",x"F5",x"33",x"21",x"A0",x"12",x"E5",
+x"CD",x"42",x"13",x"F1",x"33",x"3E",x"00",x"D3",x"BF",x"3E",x"8F",x"D3",x"BF",x"3A",x"44",x"73",
+x"B7",x"28",x"0A",x"3E",x"04",x"D3",x"BF",x"3E",x"9E",x"D3",x"BF",x"18",x"08",x"3E",x"20",x"D3",
+x"BF",x"3E",x"9E",x"D3",x"BF",x"FD",x"21",x"46",x"73",x"FD",x"7E",x"00",x"D3",x"BF",x"3E",x"B2",
+x"D3",x"BF",x"DB",x"BF",x"07",x"D2",x"D9",x"12",x"00",x"00",x"00",x"00",x"00",x"18",x"F3",x"C3",
+x"D9",x"12",x"CD",x"3D",x"3E",x"3E",x"C0",x"D3",x"BF",x"3E",x"AF",x"D3",x"BF",x"DD",x"4E",x"04",
+x"DD",x"46",x"05",x"DD",x"5E",x"06",x"7B",x"1D",x"B7",x"28",x"0E",x"69",x"60",x"56",x"23",x"7E",
+x"D3",x"BE",x"0A",x"D3",x"BE",x"03",x"03",x"18",x"ED",x"3E",x"00",x"D3",x"BF",x"3E",x"AF",x"D3",
+x"BF",x"DD",x"E1",x"C9",x"78",x"84",x"B4",x"A4",x"B4",x"84",x"78",x"00",x"1F",x"04",x"04",x"04",
+x"00",x"00",x"00",x"00",x"44",x"6C",x"54",x"54",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",
+x"00",x"00",x"00",x"00",x"20",x"20",x"20",x"20",x"00",x"00",x"20",x"00",x"50",x"50",x"50",x"00",
+x"00",x"00",x"00",x"00",x"50",x"50",x"F8",x"50",x"F8",x"50",x"50",x"00",x"20",x"78",x"A0",x"70",
+x"28",x"F0",x"20",x"00",x"C0",x"C8",x"10",x"20",x"40",x"98",x"18",x"00",x"40",x"A0",x"40",x"A8",
+x"90",x"98",x"60",x"00",x"10",x"20",x"40",x"00",x"00",x"00",x"00",x"00",x"10",x"20",x"40",x"40",
+x"40",x"20",x"10",x"00",x"40",x"20",x"10",x"10",x"10",x"20",x"40",x"00",x"20",x"A8",x"70",x"20",
+x"70",x"A8",x"20",x"00",x"00",x"20",x"20",x"F8",x"20",x"20",x"00",x"00",x"00",x"00",x"00",x"00",
+x"00",x"20",x"20",x"40",x"00",x"00",x"00",x"78",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",
+x"00",x"60",x"60",x"00",x"00",x"00",x"08",x"10",x"20",x"40",x"80",x"00",x"70",x"88",x"98",x"A8",
+x"C8",x"88",x"70",x"00",x"20",x"60",x"20",x"20",x"20",x"20",x"70",x"00",x"70",x"88",x"08",x"10",
+x"60",x"80",x"F8",x"00",x"70",x"88",x"08",x"30",x"08",x"88",x"70",x"00",x"10",x"30",x"50",x"90",
+x"F8",x"10",x"10",x"00",x"F8",x"80",x"E0",x"10",x"08",x"10",x"E0",x"00",x"30",x"40",x"80",x"F0",
+x"88",x"88",x"70",x"00",x"F8",x"88",x"10",x"20",x"20",x"20",x"20",x"00",x"70",x"88",x"88",x"70",
+x"88",x"88",x"70",x"00",x"70",x"88",x"88",x"78",x"08",x"10",x"60",x"00",x"00",x"00",x"20",x"00",
+x"00",x"20",x"00",x"00",x"00",x"00",x"20",x"00",x"00",x"20",x"20",x"40",x"18",x"30",x"60",x"C0",
+x"60",x"30",x"18",x"00",x"00",x"00",x"F8",x"00",x"F8",x"00",x"00",x"00",x"C0",x"60",x"30",x"18",
+x"30",x"60",x"C0",x"00",x"70",x"88",x"08",x"10",x"20",x"00",x"20",x"00",x"70",x"88",x"08",x"48",
+x"A8",x"A8",x"70",x"00",x"20",x"50",x"88",x"88",x"F8",x"88",x"88",x"00",x"F0",x"48",x"48",x"70",
+x"48",x"48",x"F0",x"00",x"30",x"48",x"80",x"80",x"80",x"48",x"30",x"00",x"E0",x"50",x"48",x"48",
+x"48",x"50",x"E0",x"00",x"F8",x"80",x"80",x"F0",x"80",x"80",x"F8",x"00",x"F8",x"80",x"80",x"F0",
+x"80",x"80",x"80",x"00",x"70",x"88",x"80",x"B8",x"88",x"88",x"70",x"00",x"88",x"88",x"88",x"F8",
+x"88",x"88",x"88",x"00",x"70",x"20",x"20",x"20",x"20",x"20",x"70",x"00",x"38",x"10",x"10",x"10",
+x"90",x"90",x"60",x"00",x"88",x"90",x"A0",x"C0",x"A0",x"90",x"88",x"00",x"80",x"80",x"80",x"80",
+x"80",x"80",x"F8",x"00",x"88",x"D8",x"A8",x"A8",x"88",x"88",x"88",x"00",x"88",x"C8",x"C8",x"A8",
+x"98",x"98",x"88",x"00",x"70",x"88",x"88",x"88",x"88",x"88",x"70",x"00",x"F0",x"88",x"88",x"F0",
+x"80",x"80",x"80",x"00",x"70",x"88",x"88",x"88",x"A8",x"90",x"68",x"00",x"F0",x"88",x"88",x"F0",
+x"A0",x"90",x"88",x"00",x"70",x"88",x"80",x"70",x"08",x"88",x"70",x"00",x"F8",x"20",x"20",x"20",
+x"20",x"20",x"20",x"00",x"88",x"88",x"88",x"88",x"88",x"88",x"70",x"00",x"88",x"88",x"88",x"88",
+x"50",x"50",x"20",x"00",x"88",x"88",x"88",x"A8",x"A8",x"D8",x"88",x"00",x"88",x"88",x"50",x"20",
+x"50",x"88",x"88",x"00",x"88",x"88",x"88",x"70",x"20",x"20",x"20",x"00",x"F8",x"08",x"10",x"20",
+x"40",x"80",x"F8",x"00",x"70",x"40",x"40",x"40",x"40",x"40",x"70",x"00",x"00",x"00",x"80",x"40",
+x"20",x"10",x"08",x"00",x"70",x"10",x"10",x"10",x"10",x"10",x"70",x"00",x"20",x"50",x"88",x"00",
+x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"F8",x"00",x"80",x"40",x"20",x"00",
+x"00",x"00",x"00",x"00",x"00",x"00",x"70",x"08",x"78",x"88",x"78",x"00",x"80",x"80",x"B0",x"C8",
+x"88",x"C8",x"B0",x"00",x"00",x"00",x"70",x"88",x"80",x"88",x"70",x"00",x"08",x"08",x"68",x"98",
+x"88",x"98",x"68",x"00",x"00",x"00",x"70",x"88",x"F8",x"80",x"70",x"00",x"10",x"28",x"20",x"F8",
+x"20",x"20",x"20",x"00",x"00",x"00",x"68",x"98",x"98",x"68",x"08",x"70",x"80",x"80",x"F0",x"88",
+x"88",x"88",x"88",x"00",x"20",x"00",x"60",x"20",x"20",x"20",x"70",x"00",x"10",x"00",x"30",x"10",
+x"10",x"10",x"90",x"60",x"40",x"40",x"48",x"50",x"60",x"50",x"48",x"00",x"60",x"20",x"20",x"20",
+x"20",x"20",x"70",x"00",x"00",x"00",x"D0",x"A8",x"A8",x"A8",x"A8",x"00",x"00",x"00",x"B0",x"C8",
+x"88",x"88",x"88",x"00",x"00",x"00",x"70",x"88",x"88",x"88",x"70",x"00",x"00",x"00",x"B0",x"C8",
+x"C8",x"B0",x"80",x"80",x"00",x"00",x"68",x"98",x"98",x"68",x"08",x"08",x"00",x"00",x"B0",x"C8",
+x"80",x"80",x"80",x"00",x"00",x"00",x"78",x"80",x"70",x"08",x"F0",x"00",x"40",x"40",x"F0",x"40",
+x"40",x"48",x"30",x"00",x"00",x"00",x"90",x"90",x"90",x"90",x"68",x"00",x"00",x"00",x"88",x"88",
+x"88",x"50",x"20",x"00",x"00",x"00",x"88",x"A8",x"A8",x"A8",x"50",x"00",x"00",x"00",x"88",x"50",
+x"20",x"50",x"88",x"00",x"00",x"00",x"88",x"88",x"98",x"68",x"08",x"70",x"00",x"00",x"F8",x"10",
+x"20",x"40",x"F8",x"00",x"FD",x"21",x"02",x"00",x"FD",x"39",x"FD",x"4E",x"00",x"79",x"0D",x"B7",
+x"C8",x"E3",x"E3",x"E3",x"E3",x"E3",x"E3",x"E3",x"E3",x"18",x"F2",x"43",x"4F",x"4C",x"45",x"43",
+x"4F",x"00",x"07",x"00",x"00",x"00",x"00",x"00",x"00",x"10",x"00",x"EE",x"0E",x"4E",x"04",x"00",
+x"00",x"00",x"09",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"EE",x"0E",x"AA",x"0A",x"00",
+x"00",x"22",x"02",x"EE",x"0E",x"EE",x"0E",x"EE",x"0E",x"EE",x"0E",x"00",x"00",x"44",x"04",x"EE",
+x"0E",x"CC",x"0C",x"30",x"31",x"32",x"33",x"34",x"35",x"36",x"37",x"38",x"39",x"41",x"42",x"43",
+x"44",x"45",x"46",x"21",x"00",x"02",x"E5",x"AF",x"F5",x"33",x"26",x"18",x"E5",x"CD",x"70",x"36",
+x"F1",x"F1",x"33",x"C9",x"21",x"C0",x"03",x"E5",x"3E",x"20",x"F5",x"33",x"21",x"00",x"00",x"E5",
+x"CD",x"70",x"36",x"F1",x"F1",x"33",x"C9",x"21",x"78",x"00",x"E5",x"3E",x"20",x"F5",x"33",x"21",
+x"48",x"03",x"E5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"C3",x"C3",x"16",x"FD",x"21",x"04",x"00",
+x"FD",x"39",x"FD",x"34",x"00",x"FD",x"4E",x"00",x"FD",x"2B",x"FD",x"2B",x"FD",x"5E",x"00",x"FD",
+x"56",x"01",x"1A",x"47",x"EE",x"80",x"D6",x"A0",x"38",x"09",x"0D",x"28",x"06",x"78",x"D3",x"BE",
+x"13",x"18",x"EF",x"79",x"B7",x"C8",x"0D",x"C8",x"3E",x"20",x"D3",x"BE",x"18",x"F8",x"CD",x"3D",
+x"3E",x"3B",x"DD",x"36",x"FF",x"7E",x"DD",x"5E",x"06",x"DD",x"56",x"07",x"DD",x"4E",x"04",x"DD",
+x"46",x"05",x"1A",x"6F",x"B7",x"28",x"10",x"DD",x"66",x"FF",x"DD",x"35",x"FF",x"7C",x"B7",x"28",
+x"06",x"7D",x"13",x"02",x"03",x"18",x"EB",x"AF",x"02",x"33",x"DD",x"E1",x"C9",x"CD",x"BD",x"04",
+x"3A",x"39",x"72",x"3C",x"20",x"F7",x"C9",x"CD",x"BD",x"04",x"3A",x"39",x"72",x"D6",x"12",x"20",
+x"F6",x"C9",x"CD",x"B6",x"2E",x"4D",x"21",x"02",x"00",x"39",x"7E",x"E6",x"BF",x"D3",x"BF",x"3E",
+x"81",x"D3",x"BF",x"C5",x"CD",x"BD",x"04",x"C1",x"3A",x"39",x"72",x"3C",x"20",x"15",x"3A",x"3A",
+x"72",x"B7",x"20",x"0F",x"3A",x"3B",x"72",x"B7",x"20",x"09",x"C5",x"CD",x"B6",x"2E",x"7D",x"C1",
+x"91",x"28",x"E0",x"21",x"02",x"00",x"39",x"7E",x"D3",x"BF",x"3E",x"81",x"D3",x"BF",x"C9",x"CD",
+x"3D",x"3E",x"CD",x"E7",x"16",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"E5",x"AF",x"F5",x"33",x"CD",
+x"2C",x"07",x"33",x"21",x"23",x"18",x"E3",x"3E",x"01",x"F5",x"33",x"CD",x"2C",x"07",x"F1",x"33",
+x"DD",x"4E",x"06",x"CB",x"39",x"CB",x"39",x"CB",x"39",x"CB",x"39",x"3A",x"4D",x"73",x"B7",x"28",
+x"15",x"3E",x"1E",x"D3",x"BF",x"AF",x"F6",x"40",x"D3",x"BF",x"79",x"D3",x"BE",x"DD",x"7E",x"06",
+x"E6",x"0F",x"D3",x"BE",x"18",x"1F",x"3E",x"26",x"D3",x"BF",x"AF",x"F6",x"40",x"D3",x"BF",x"11",
+x"B3",x"16",x"69",x"26",x"00",x"19",x"7E",x"D3",x"BE",x"DD",x"7E",x"06",x"E6",x"0F",x"26",x"00",
+x"6F",x"19",x"7E",x"D3",x"BE",x"CD",x"5D",x"17",x"CD",x"67",x"17",x"CD",x"C3",x"16",x"DD",x"E1",
+x"C3",x"5D",x"17",x"50",x"72",x"65",x"73",x"73",x"20",x"66",x"69",x"72",x"65",x"2E",x"2E",x"2E",
+x"00",x"CD",x"3D",x"3E",x"F5",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"DD",x"7E",x"06",x"DD",x"77",
+x"FE",x"DD",x"7E",x"07",x"DD",x"77",x"FF",x"0A",x"5F",x"E1",x"E5",x"56",x"CB",x"73",x"28",x"04",
+x"CB",x"AB",x"18",x"07",x"7B",x"D6",x"5F",x"20",x"02",x"1E",x"20",x"CB",x"72",x"28",x"04",x"CB",
+x"AA",x"18",x"07",x"7A",x"D6",x"5F",x"20",x"02",x"16",x"20",x"7B",x"BA",x"20",x"0E",x"B7",x"28",
+x"0B",x"03",x"DD",x"34",x"FE",x"20",x"D0",x"DD",x"34",x"FF",x"18",x"CB",x"7B",x"92",x"6F",x"F1",
+x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",x"F5",x"21",x"00",x"80",x"22",x"47",x"73",x"21",x"C3",
+x"66",x"E5",x"21",x"08",x"71",x"E5",x"CD",x"C6",x"2E",x"F1",x"F1",x"7D",x"B7",x"C2",x"19",x"1A",
+x"21",x"C3",x"66",x"E5",x"21",x"C3",x"68",x"E5",x"CD",x"2E",x"17",x"F1",x"21",x"C3",x"68",x"E3",
+x"3E",x"01",x"F5",x"33",x"CD",x"2C",x"07",x"F1",x"33",x"3A",x"C4",x"66",x"B7",x"28",x"45",x"2A",
+x"47",x"73",x"DD",x"75",x"FE",x"DD",x"74",x"FF",x"21",x"80",x"00",x"E5",x"2E",x"00",x"E5",x"DD",
+x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"CD",x"C2",x"00",x"F1",x"F1",x"F1",x"2A",x"47",x"73",x"36",
+x"2E",x"2A",x"47",x"73",x"23",x"36",x"2E",x"FD",x"21",x"47",x"73",x"FD",x"7E",x"00",x"C6",x"7F",
+x"4F",x"FD",x"7E",x"01",x"CE",x"00",x"47",x"AF",x"02",x"21",x"47",x"73",x"7E",x"C6",x"80",x"77",
+x"30",x"02",x"23",x"34",x"11",x"34",x"71",x"01",x"08",x"71",x"D5",x"C5",x"CD",x"1E",x"4A",x"F1",
+x"F1",x"7D",x"B7",x"C2",x"0C",x"1A",x"CD",x"B6",x"2E",x"7D",x"D6",x"02",x"20",x"0B",x"01",x"08",
+x"71",x"C5",x"CD",x"7F",x"45",x"F1",x"C3",x"19",x"1A",x"3A",x"39",x"71",x"FE",x"2E",x"28",x"D4",
+x"B7",x"CA",x"0C",x"1A",x"3A",x"4C",x"73",x"B7",x"28",x"3D",x"3A",x"38",x"71",x"CB",x"67",x"28",
+x"36",x"21",x"7B",x"16",x"E5",x"21",x"39",x"71",x"E5",x"CD",x"31",x"18",x"F1",x"F1",x"7D",x"B7",
+x"20",x"25",x"21",x"08",x"71",x"E5",x"CD",x"7F",x"45",x"F1",x"21",x"82",x"16",x"4E",x"06",x"00",
+x"C5",x"21",x"7B",x"16",x"E5",x"21",x"C4",x"66",x"E5",x"CD",x"AE",x"00",x"F1",x"F1",x"F1",x"21",
+x"4C",x"73",x"36",x"00",x"C3",x"88",x"18",x"21",x"39",x"71",x"E5",x"2A",x"47",x"73",x"E5",x"CD",
+x"2E",x"17",x"F1",x"F1",x"21",x"38",x"71",x"5E",x"FD",x"21",x"47",x"73",x"FD",x"7E",x"00",x"C6",
+x"7F",x"4F",x"FD",x"7E",x"01",x"CE",x"00",x"47",x"CB",x"63",x"28",x"04",x"AF",x"02",x"18",x"33",
+x"C5",x"11",x"34",x"71",x"21",x"02",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"DD",
+x"5E",x"FD",x"DD",x"56",x"FE",x"DD",x"6E",x"FF",x"3E",x"06",x"CB",x"3D",x"CB",x"1A",x"CB",x"1B",
+x"3D",x"20",x"F7",x"DD",x"7E",x"FC",x"B7",x"20",x"07",x"DD",x"7E",x"FD",x"E6",x"3F",x"28",x"01",
+x"1C",x"7B",x"02",x"21",x"47",x"73",x"7E",x"C6",x"80",x"77",x"30",x"02",x"23",x"34",x"FD",x"21",
+x"47",x"73",x"FD",x"7E",x"00",x"D6",x"80",x"FD",x"7E",x"01",x"DE",x"FF",x"DA",x"04",x"19",x"ED",
+x"4B",x"47",x"73",x"59",x"78",x"C6",x"80",x"57",x"06",x"07",x"CB",x"3A",x"CB",x"1B",x"10",x"FA",
+x"7B",x"F5",x"33",x"21",x"1E",x"1A",x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"21",x"08",x"71",x"E5",
+x"CD",x"7F",x"45",x"F1",x"21",x"4C",x"73",x"36",x"00",x"DD",x"F9",x"DD",x"E1",x"C9",x"4D",x"61",
+x"78",x"20",x"64",x"69",x"72",x"65",x"63",x"74",x"6F",x"72",x"79",x"20",x"63",x"6F",x"75",x"6E",
+x"74",x"20",x"72",x"65",x"61",x"63",x"68",x"65",x"64",x"00",x"CD",x"BD",x"04",x"3A",x"3A",x"72",
+x"B7",x"20",x"0C",x"3A",x"3B",x"72",x"B7",x"20",x"06",x"21",x"C3",x"6C",x"36",x"2D",x"C9",x"FD",
+x"21",x"C3",x"6C",x"FD",x"35",x"00",x"FD",x"7E",x"00",x"B7",x"20",x"05",x"FD",x"36",x"00",x"05",
+x"C9",x"3E",x"01",x"F5",x"33",x"CD",x"50",x"02",x"33",x"18",x"CF",x"CD",x"3D",x"3E",x"21",x"F5",
+x"FF",x"39",x"F9",x"21",x"00",x"00",x"E3",x"01",x"00",x"10",x"3A",x"4A",x"73",x"DD",x"77",x"FF",
+x"21",x"4A",x"73",x"5E",x"16",x"00",x"21",x"18",x"00",x"19",x"DD",x"7E",x"FF",x"DD",x"77",x"FD",
+x"AF",x"DD",x"77",x"FE",x"DD",x"7E",x"FD",x"95",x"DD",x"7E",x"FE",x"9C",x"E2",x"A1",x"1A",x"EE",
+x"80",x"F2",x"EC",x"1B",x"DD",x"7E",x"FF",x"E6",x"01",x"5F",x"16",x"00",x"21",x"28",x"00",x"09",
+x"DD",x"75",x"F7",x"DD",x"74",x"F8",x"DD",x"6E",x"F6",x"DD",x"7E",x"F5",x"C6",x"28",x"DD",x"77",
+x"F9",x"DD",x"7E",x"F6",x"CE",x"00",x"DD",x"77",x"FA",x"DD",x"7E",x"F5",x"DD",x"77",x"FB",x"7D",
+x"F6",x"40",x"DD",x"77",x"FC",x"21",x"49",x"73",x"DD",x"7E",x"FF",x"96",x"38",x"6A",x"7A",x"B3",
+x"28",x"11",x"21",x"28",x"00",x"E5",x"3E",x"43",x"F5",x"33",x"C5",x"CD",x"70",x"36",x"F1",x"F1",
+x"33",x"18",x"0F",x"21",x"28",x"00",x"E5",x"3E",x"42",x"F5",x"33",x"C5",x"CD",x"70",x"36",x"F1",
+x"F1",x"33",x"D1",x"C1",x"C5",x"D5",x"DD",x"7E",x"FB",x"D3",x"BF",x"DD",x"7E",x"FC",x"D3",x"BF",
+x"DD",x"7E",x"F9",x"DD",x"77",x"F5",x"DD",x"7E",x"FA",x"DD",x"77",x"F6",x"C5",x"3E",x"28",x"F5",
+x"33",x"21",x"F1",x"1B",x"E5",x"CD",x"FC",x"16",x"F1",x"33",x"C1",x"DD",x"7E",x"FF",x"3C",x"C2",
+x"E6",x"1B",x"DD",x"35",x"FF",x"DD",x"7E",x"F5",x"D6",x"C0",x"C2",x"E6",x"1B",x"DD",x"7E",x"F6",
+x"D6",x"03",x"CA",x"EC",x"1B",x"C3",x"E6",x"1B",x"DD",x"6E",x"FD",x"DD",x"66",x"FE",x"29",x"3E",
+x"C3",x"85",x"6F",x"3E",x"6A",x"8C",x"67",x"7E",x"DD",x"77",x"FD",x"23",x"7E",x"DD",x"77",x"FE",
+x"DD",x"6E",x"FD",x"DD",x"66",x"FE",x"C5",x"01",x"7F",x"00",x"09",x"C1",x"7E",x"B7",x"20",x"26",
+x"7A",x"B3",x"28",x"11",x"21",x"28",x"00",x"E5",x"3E",x"53",x"F5",x"33",x"C5",x"CD",x"70",x"36",
+x"F1",x"F1",x"33",x"18",x"35",x"21",x"28",x"00",x"E5",x"3E",x"52",x"F5",x"33",x"C5",x"CD",x"70",
+x"36",x"F1",x"F1",x"33",x"18",x"24",x"7A",x"B3",x"28",x"11",x"21",x"28",x"00",x"E5",x"3E",x"43",
+x"F5",x"33",x"C5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"18",x"0F",x"21",x"28",x"00",x"E5",x"3E",
+x"42",x"F5",x"33",x"C5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"D1",x"C1",x"C5",x"D5",x"DD",x"7E",
+x"FB",x"D3",x"BF",x"DD",x"7E",x"FC",x"D3",x"BF",x"DD",x"7E",x"F9",x"DD",x"77",x"F5",x"DD",x"7E",
+x"FA",x"DD",x"77",x"F6",x"C5",x"3E",x"28",x"F5",x"33",x"DD",x"6E",x"FD",x"DD",x"66",x"FE",x"E5",
+x"CD",x"FC",x"16",x"F1",x"33",x"C1",x"DD",x"34",x"FF",x"C3",x"80",x"1A",x"DD",x"F9",x"DD",x"E1",
+x"C9",x"00",x"CD",x"3D",x"3E",x"F5",x"F5",x"21",x"49",x"73",x"36",x"00",x"DD",x"36",x"FE",x"00",
+x"DD",x"36",x"FF",x"80",x"21",x"47",x"73",x"DD",x"7E",x"FE",x"96",x"DD",x"7E",x"FF",x"23",x"9E",
+x"D2",x"FE",x"1C",x"C1",x"E1",x"E5",x"C5",x"11",x"7F",x"00",x"19",x"7E",x"B7",x"20",x"35",x"4F",
+x"21",x"49",x"73",x"79",x"96",x"30",x"66",x"69",x"26",x"00",x"29",x"11",x"C3",x"6A",x"19",x"5E",
+x"23",x"56",x"6B",x"62",x"C5",x"01",x"7F",x"00",x"09",x"C1",x"7E",x"B7",x"20",x"4F",x"C5",x"D5",
+x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"CD",x"31",x"18",x"F1",x"F1",x"C1",x"CB",x"7D",x"20",
+x"3C",x"0C",x"18",x"CC",x"21",x"49",x"73",x"4E",x"0D",x"41",x"78",x"3C",x"28",x"2F",x"68",x"26",
+x"00",x"29",x"11",x"C3",x"6A",x"19",x"5E",x"23",x"56",x"6B",x"62",x"C5",x"01",x"7F",x"00",x"09",
+x"C1",x"7E",x"0C",x"B7",x"28",x"17",x"C5",x"D5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"CD",
+x"31",x"18",x"F1",x"F1",x"C1",x"CB",x"7D",x"28",x"04",x"05",x"48",x"18",x"CD",x"59",x"16",x"00",
+x"DD",x"73",x"FC",x"DD",x"72",x"FD",x"DD",x"CB",x"FC",x"26",x"DD",x"CB",x"FD",x"16",x"21",x"49",
+x"73",x"79",x"96",x"30",x"2F",x"FD",x"21",x"49",x"73",x"FD",x"6E",x"00",x"26",x"00",x"BF",x"ED",
+x"52",x"29",x"3E",x"C3",x"DD",x"86",x"FC",x"4F",x"3E",x"6A",x"DD",x"8E",x"FD",x"47",x"13",x"CB",
+x"23",x"CB",x"12",x"7B",x"C6",x"C3",x"5F",x"7A",x"CE",x"6A",x"57",x"E5",x"C5",x"D5",x"CD",x"F0",
+x"00",x"F1",x"F1",x"F1",x"DD",x"7E",x"FC",x"C6",x"C3",x"4F",x"DD",x"7E",x"FD",x"CE",x"6A",x"47",
+x"DD",x"7E",x"FE",x"02",x"03",x"DD",x"7E",x"FF",x"02",x"21",x"49",x"73",x"34",x"DD",x"7E",x"FE",
+x"C6",x"80",x"DD",x"77",x"FE",x"D2",x"04",x"1C",x"DD",x"34",x"FF",x"C3",x"04",x"1C",x"DD",x"F9",
+x"DD",x"E1",x"C9",x"3B",x"CD",x"C3",x"16",x"21",x"86",x"1D",x"E5",x"21",x"40",x"18",x"E5",x"CD",
+x"29",x"05",x"F1",x"21",x"9F",x"1D",x"E3",x"21",x"18",x"18",x"E5",x"CD",x"29",x"05",x"F1",x"F1",
+x"01",x"18",x"15",x"AF",x"FD",x"21",x"00",x"00",x"FD",x"39",x"FD",x"77",x"00",x"21",x"00",x"00",
+x"39",x"7E",x"D6",x"02",x"30",x"4E",x"C5",x"3E",x"02",x"F5",x"33",x"CD",x"50",x"02",x"33",x"C1",
+x"59",x"50",x"1B",x"4B",x"7A",x"47",x"B3",x"20",x"15",x"3E",x"E2",x"F5",x"33",x"CD",x"72",x"17",
+x"33",x"01",x"18",x"15",x"AF",x"FD",x"21",x"00",x"00",x"FD",x"39",x"FD",x"77",x"00",x"C5",x"CD",
+x"B6",x"2E",x"7D",x"C1",x"D6",x"02",x"20",x"0C",x"AF",x"FD",x"21",x"00",x"00",x"FD",x"39",x"FD",
+x"77",x"00",x"18",x"09",x"FD",x"21",x"00",x"00",x"FD",x"39",x"FD",x"34",x"00",x"C5",x"CD",x"BD",
+x"04",x"C1",x"18",x"A9",x"33",x"C9",x"49",x"6E",x"73",x"65",x"72",x"74",x"20",x"53",x"44",x"20",
+x"6F",x"72",x"20",x"74",x"75",x"72",x"6E",x"20",x"73",x"79",x"73",x"74",x"65",x"6D",x"00",x"6F",
+x"66",x"66",x"20",x"62",x"65",x"66",x"6F",x"72",x"65",x"20",x"69",x"6E",x"73",x"65",x"72",x"74",
+x"69",x"6E",x"67",x"20",x"63",x"61",x"72",x"74",x"72",x"69",x"64",x"67",x"65",x"00",x"CD",x"3D",
+x"3E",x"F5",x"F5",x"F5",x"CD",x"E7",x"16",x"21",x"6F",x"1E",x"E5",x"AF",x"F5",x"33",x"CD",x"2C",
+x"07",x"F1",x"33",x"11",x"00",x"82",x"21",x"00",x"00",x"39",x"4B",x"42",x"D5",x"E5",x"21",x"00",
+x"02",x"E5",x"C5",x"21",x"EC",x"6E",x"E5",x"CD",x"06",x"29",x"F1",x"F1",x"F1",x"F1",x"7D",x"D1",
+x"47",x"B7",x"28",x"14",x"C5",x"21",x"EC",x"6E",x"E5",x"CD",x"A5",x"45",x"33",x"21",x"7F",x"1E",
+x"E3",x"CD",x"AF",x"17",x"F1",x"33",x"18",x"62",x"DD",x"7E",x"FB",x"D6",x"02",x"38",x"4C",x"21",
+x"00",x"02",x"19",x"EB",x"7A",x"D6",x"80",x"30",x"BD",x"11",x"FC",x"6E",x"21",x"02",x"00",x"39",
+x"EB",x"01",x"04",x"00",x"ED",x"B0",x"ED",x"4B",x"F6",x"6E",x"ED",x"5B",x"F8",x"6E",x"DD",x"7E",
+x"FC",x"91",x"20",x"11",x"DD",x"7E",x"FD",x"90",x"20",x"0B",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",
+x"BF",x"ED",x"52",x"28",x"16",x"21",x"EC",x"6E",x"E5",x"CD",x"A5",x"45",x"26",x"01",x"E3",x"33",
+x"21",x"96",x"1E",x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"18",x"0F",x"21",x"EC",x"6E",x"E5",x"CD",
+x"A5",x"45",x"F1",x"3E",x"31",x"D3",x"55",x"CD",x"B6",x"07",x"DD",x"F9",x"DD",x"E1",x"C9",x"72",
+x"65",x"61",x"64",x"69",x"6E",x"67",x"20",x"63",x"61",x"72",x"74",x"2E",x"2E",x"2E",x"00",x"43",
+x"61",x"72",x"74",x"72",x"69",x"64",x"67",x"65",x"20",x"6C",x"6F",x"61",x"64",x"20",x"66",x"61",
+x"69",x"6C",x"65",x"64",x"2E",x"00",x"55",x"6E",x"72",x"65",x"63",x"6F",x"67",x"6E",x"69",x"7A",
+x"65",x"64",x"20",x"3E",x"33",x"32",x"6B",x"20",x"43",x"61",x"72",x"74",x"00",x"CD",x"3D",x"3E",
+x"01",x"80",x"00",x"79",x"B0",x"28",x"36",x"DD",x"7E",x"04",x"D3",x"54",x"58",x"51",x"C5",x"D5",
+x"21",x"00",x"02",x"E5",x"D5",x"21",x"C3",x"68",x"E5",x"CD",x"AE",x"00",x"F1",x"F1",x"F1",x"D1",
+x"C1",x"DD",x"7E",x"05",x"D3",x"54",x"C5",x"21",x"00",x"02",x"E5",x"21",x"C3",x"68",x"E5",x"D5",
+x"CD",x"AE",x"00",x"F1",x"F1",x"F1",x"C1",x"79",x"C6",x"02",x"4F",x"18",x"C6",x"DD",x"E1",x"C9",
+x"CD",x"3D",x"3E",x"21",x"F6",x"FF",x"39",x"F9",x"CD",x"E7",x"16",x"21",x"AA",x"20",x"E5",x"AF",
+x"F5",x"33",x"CD",x"2C",x"07",x"F1",x"33",x"11",x"00",x"00",x"01",x"00",x"00",x"DD",x"7E",x"04",
+x"D6",x"20",x"20",x"0E",x"11",x"00",x"80",x"01",x"00",x"00",x"DD",x"7E",x"04",x"C6",x"FE",x"DD",
+x"77",x"04",x"DD",x"6E",x"04",x"26",x"00",x"2B",x"CB",x"2C",x"CB",x"1D",x"3E",x"0F",x"95",x"DD",
+x"77",x"FC",x"D3",x"54",x"DD",x"7E",x"04",x"0F",x"30",x"05",x"21",x"00",x"40",x"18",x"03",x"21",
+x"00",x"00",x"DD",x"75",x"FD",x"7C",x"C6",x"80",x"DD",x"77",x"FE",x"C5",x"D5",x"21",x"EC",x"6E",
+x"E5",x"CD",x"70",x"3E",x"F1",x"F1",x"F1",x"7D",x"B7",x"28",x"1A",x"21",x"EC",x"6E",x"E5",x"CD",
+x"A5",x"45",x"26",x"02",x"E3",x"33",x"21",x"BE",x"20",x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"DD",
+x"6E",x"FC",x"C3",x"A5",x"20",x"DD",x"7E",x"FC",x"DD",x"77",x"FF",x"21",x"04",x"00",x"39",x"DD",
+x"4E",x"FD",x"DD",x"46",x"FE",x"E5",x"21",x"00",x"02",x"E5",x"C5",x"21",x"EC",x"6E",x"E5",x"CD",
+x"06",x"29",x"F1",x"F1",x"F1",x"F1",x"7D",x"47",x"B7",x"28",x"18",x"C5",x"21",x"EC",x"6E",x"E5",
+x"CD",x"A5",x"45",x"33",x"21",x"D3",x"20",x"E3",x"CD",x"AF",x"17",x"F1",x"33",x"DD",x"6E",x"FC",
+x"C3",x"A5",x"20",x"DD",x"7E",x"FB",x"D6",x"02",x"38",x"78",x"DD",x"7E",x"FD",x"DD",x"77",x"FD",
+x"DD",x"7E",x"FE",x"C6",x"02",x"DD",x"77",x"FE",x"D6",x"80",x"30",x"AF",x"DD",x"34",x"FF",x"DD",
+x"7E",x"FF",x"DD",x"77",x"FC",x"3E",x"0F",x"DD",x"96",x"FF",x"30",x"46",x"11",x"FC",x"6E",x"21",
+x"00",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"ED",x"4B",x"F6",x"6E",x"ED",x"5B",x"F8",
+x"6E",x"DD",x"7E",x"F6",x"91",x"20",x"11",x"DD",x"7E",x"F7",x"90",x"20",x"0B",x"DD",x"6E",x"F8",
+x"DD",x"66",x"F9",x"BF",x"ED",x"52",x"28",x"2A",x"21",x"EC",x"6E",x"E5",x"CD",x"A5",x"45",x"F1",
+x"AF",x"F5",x"33",x"21",x"EA",x"20",x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"DD",x"6E",x"FF",x"C3",
+x"A5",x"20",x"DD",x"36",x"FD",x"00",x"DD",x"36",x"FE",x"80",x"DD",x"7E",x"FF",x"D3",x"54",x"C3",
+x"7B",x"1F",x"21",x"EC",x"6E",x"E5",x"CD",x"A5",x"45",x"F1",x"DD",x"7E",x"04",x"D6",x"02",x"28",
+x"1E",x"DD",x"7E",x"04",x"D6",x"04",x"28",x"1D",x"DD",x"7E",x"04",x"D6",x"08",x"28",x"1C",x"DD",
+x"7E",x"04",x"D6",x"10",x"28",x"1B",x"DD",x"7E",x"04",x"D6",x"1E",x"28",x"1A",x"18",x"1E",x"3E",
+x"01",x"D3",x"59",x"18",x"33",x"3E",x"03",x"D3",x"59",x"18",x"2D",x"3E",x"07",x"D3",x"59",x"18",
+x"27",x"3E",x"0F",x"D3",x"59",x"18",x"21",x"3E",x"1F",x"D3",x"59",x"18",x"1B",x"21",x"EC",x"6E",
+x"E5",x"CD",x"A5",x"45",x"F1",x"DD",x"7E",x"04",x"F5",x"33",x"21",x"01",x"21",x"E5",x"CD",x"AF",
+x"17",x"F1",x"33",x"DD",x"6E",x"FC",x"18",x"0D",x"3E",x"11",x"D3",x"55",x"3E",x"01",x"D3",x"54",
+x"CD",x"B6",x"07",x"2E",x"00",x"DD",x"F9",x"DD",x"E1",x"C9",x"72",x"65",x"61",x"64",x"69",x"6E",
+x"67",x"20",x"6D",x"65",x"67",x"61",x"63",x"61",x"72",x"74",x"2E",x"2E",x"2E",x"00",x"46",x"61",
+x"69",x"6C",x"65",x"64",x"20",x"74",x"6F",x"20",x"73",x"65",x"65",x"6B",x"20",x"66",x"69",x"6C",
+x"65",x"2E",x"00",x"43",x"61",x"72",x"74",x"72",x"69",x"64",x"67",x"65",x"20",x"6C",x"6F",x"61",
+x"64",x"20",x"66",x"61",x"69",x"6C",x"65",x"64",x"2E",x"00",x"4D",x"65",x"67",x"61",x"63",x"61",
+x"72",x"74",x"20",x"52",x"4F",x"4D",x"20",x"74",x"6F",x"6F",x"20",x"6C",x"61",x"72",x"67",x"65",
+x"00",x"4D",x"65",x"67",x"61",x"63",x"61",x"72",x"74",x"20",x"69",x"6D",x"61",x"67",x"65",x"73",
+x"20",x"6D",x"75",x"73",x"74",x"20",x"62",x"65",x"20",x"70",x"61",x"64",x"64",x"65",x"64",x"00",
+x"21",x"49",x"73",x"4E",x"06",x"00",x"0B",x"21",x"4B",x"73",x"5E",x"16",x"00",x"79",x"93",x"78",
+x"9A",x"E2",x"36",x"21",x"EE",x"80",x"F2",x"42",x"21",x"3A",x"49",x"73",x"21",x"4B",x"73",x"C6",
+x"FF",x"77",x"21",x"4B",x"73",x"4E",x"06",x"00",x"21",x"4A",x"73",x"5E",x"16",x"00",x"79",x"93",
+x"4F",x"78",x"9A",x"47",x"69",x"60",x"29",x"29",x"09",x"29",x"29",x"29",x"4D",x"7C",x"C6",x"10",
+x"47",x"C5",x"C5",x"CD",x"06",x"33",x"F1",x"7D",x"C1",x"E6",x"F0",x"F6",x"07",x"57",x"21",x"28",
+x"00",x"E5",x"D5",x"33",x"C5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"C9",x"21",x"4B",x"73",x"4E",
+x"06",x"00",x"21",x"4A",x"73",x"5E",x"16",x"00",x"79",x"93",x"4F",x"78",x"9A",x"47",x"CB",x"41",
+x"1E",x"03",x"20",x"02",x"1E",x"02",x"69",x"60",x"29",x"29",x"09",x"29",x"29",x"29",x"4D",x"7C",
+x"C6",x"10",x"47",x"C5",x"D5",x"C5",x"CD",x"06",x"33",x"F1",x"7D",x"D1",x"C1",x"E6",x"F0",x"B3",
+x"57",x"21",x"28",x"00",x"E5",x"D5",x"33",x"C5",x"CD",x"70",x"36",x"F1",x"F1",x"33",x"C9",x"CD",
+x"3D",x"3E",x"F5",x"3B",x"21",x"18",x"15",x"E3",x"CD",x"20",x"21",x"CD",x"B6",x"2E",x"7D",x"D6",
+x"02",x"20",x"04",x"6F",x"C3",x"5F",x"23",x"3E",x"01",x"F5",x"33",x"CD",x"50",x"02",x"33",x"3A",
+x"4B",x"73",x"DD",x"77",x"FF",x"CD",x"BD",x"04",x"3A",x"3A",x"72",x"D6",x"04",x"20",x"2E",x"3A",
+x"4B",x"73",x"B7",x"28",x"1F",x"CD",x"7C",x"21",x"FD",x"21",x"4B",x"73",x"FD",x"35",x"00",x"21",
+x"4A",x"73",x"FD",x"7E",x"00",x"96",x"30",x"09",x"21",x"4A",x"73",x"35",x"2E",x"FF",x"C3",x"5F",
+x"23",x"CD",x"20",x"21",x"CD",x"3A",x"1A",x"21",x"18",x"15",x"E3",x"18",x"AE",x"21",x"49",x"73",
+x"5E",x"16",x"00",x"1B",x"3A",x"3A",x"72",x"D6",x"FC",x"20",x"4A",x"3A",x"4B",x"73",x"06",x"00",
+x"93",x"78",x"9A",x"E2",x"38",x"22",x"EE",x"80",x"F2",x"6B",x"22",x"CD",x"7C",x"21",x"21",x"4B",
+x"73",x"34",x"21",x"4A",x"73",x"4E",x"06",x"00",x"21",x"17",x"00",x"09",x"EB",x"21",x"4B",x"73",
+x"4E",x"06",x"00",x"7B",x"91",x"7A",x"98",x"E2",x"5C",x"22",x"EE",x"80",x"F2",x"68",x"22",x"21",
+x"4A",x"73",x"34",x"2E",x"FF",x"C3",x"5F",x"23",x"CD",x"20",x"21",x"CD",x"3A",x"1A",x"21",x"18",
+x"15",x"E3",x"C3",x"CB",x"21",x"21",x"4A",x"73",x"4E",x"21",x"4B",x"73",x"46",x"3A",x"3B",x"72",
+x"D6",x"04",x"20",x"5B",x"FD",x"21",x"4A",x"73",x"FD",x"6E",x"00",x"26",x"00",x"D5",x"11",x"17",
+x"00",x"19",x"D1",x"7D",x"93",x"7C",x"9A",x"E2",x"9C",x"22",x"EE",x"80",x"F2",x"C6",x"22",x"3A",
+x"49",x"73",x"3D",x"91",x"FE",x"18",x"30",x"0D",x"21",x"4A",x"73",x"86",x"77",x"3A",x"4A",x"73",
+x"32",x"4B",x"73",x"18",x"0C",x"79",x"C6",x"18",x"32",x"4A",x"73",x"78",x"C6",x"18",x"32",x"4B",
+x"73",x"2E",x"FF",x"C3",x"5F",x"23",x"CD",x"7C",x"21",x"3A",x"49",x"73",x"21",x"4B",x"73",x"C6",
+x"FF",x"77",x"CD",x"20",x"21",x"CD",x"3A",x"1A",x"21",x"18",x"15",x"E3",x"C3",x"CB",x"21",x"3A",
+x"3B",x"72",x"D6",x"FC",x"20",x"43",x"FD",x"21",x"4A",x"73",x"FD",x"7E",x"00",x"B7",x"28",x"24",
+x"FD",x"7E",x"00",x"D6",x"18",x"30",x"0B",x"FD",x"36",x"00",x"00",x"21",x"4B",x"73",x"36",x"00",
+x"18",x"0E",x"21",x"4A",x"73",x"79",x"C6",x"E8",x"77",x"21",x"4B",x"73",x"78",x"C6",x"E8",x"77",
+x"2E",x"FF",x"18",x"4B",x"CD",x"7C",x"21",x"21",x"4B",x"73",x"36",x"00",x"CD",x"20",x"21",x"CD",
+x"3A",x"1A",x"21",x"18",x"15",x"E3",x"C3",x"CB",x"21",x"3A",x"39",x"72",x"D6",x"12",x"20",x"04",
+x"2E",x"01",x"18",x"2B",x"DD",x"7E",x"FF",x"FD",x"21",x"4B",x"73",x"FD",x"96",x"00",x"20",x"05",
+x"21",x"C3",x"6C",x"36",x"2D",x"C1",x"C5",x"0B",x"33",x"33",x"C5",x"78",x"B1",x"C2",x"CB",x"21",
+x"3E",x"F2",x"F5",x"33",x"CD",x"72",x"17",x"33",x"21",x"18",x"15",x"E3",x"C3",x"CB",x"21",x"DD",
+x"F9",x"DD",x"E1",x"C9",x"01",x"4E",x"73",x"FD",x"21",x"38",x"72",x"FD",x"6E",x"00",x"26",x"00",
+x"29",x"09",x"4E",x"23",x"46",x"3E",x"08",x"F5",x"33",x"C5",x"CD",x"42",x"13",x"F1",x"33",x"C9",
+x"FD",x"21",x"38",x"72",x"FD",x"34",x"00",x"FD",x"7E",x"00",x"D6",x"03",x"DA",x"64",x"23",x"FD",
+x"36",x"00",x"00",x"C3",x"64",x"23",x"CD",x"3D",x"3E",x"F5",x"F5",x"F5",x"CD",x"C3",x"16",x"CD",
+x"B6",x"2E",x"7D",x"D6",x"02",x"20",x"03",x"CD",x"03",x"1D",x"21",x"C3",x"66",x"36",x"2F",x"21",
+x"C4",x"66",x"36",x"00",x"3E",x"01",x"F5",x"33",x"21",x"86",x"27",x"E5",x"21",x"C4",x"6C",x"E5",
+x"CD",x"1C",x"31",x"F1",x"F1",x"33",x"7D",x"B7",x"28",x"0E",x"AF",x"F5",x"33",x"21",x"87",x"27",
+x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"18",x"C4",x"21",x"4C",x"73",x"36",x"01",x"21",x"4D",x"73",
+x"36",x"01",x"CD",x"C3",x"16",x"21",x"9A",x"27",x"E5",x"21",x"C0",x"18",x"E5",x"CD",x"70",x"05",
+x"F1",x"F1",x"3E",x"01",x"D3",x"55",x"3E",x"0E",x"D3",x"54",x"CD",x"83",x"18",x"CD",x"B6",x"2E",
+x"7D",x"D6",x"02",x"28",x"97",x"FD",x"21",x"47",x"73",x"FD",x"7E",x"00",x"B7",x"20",x"16",x"FD",
+x"7E",x"01",x"D6",x"80",x"20",x"0F",x"AF",x"F5",x"33",x"21",x"A2",x"27",x"E5",x"CD",x"AF",x"17",
+x"F1",x"33",x"C3",x"9C",x"23",x"CD",x"F2",x"1B",x"3A",x"49",x"73",x"B7",x"20",x"10",x"21",x"BB",
+x"27",x"E5",x"3E",x"01",x"F5",x"33",x"CD",x"2C",x"07",x"F1",x"33",x"C3",x"9C",x"23",x"CD",x"C3",
+x"16",x"21",x"4A",x"73",x"36",x"00",x"21",x"4B",x"73",x"36",x"00",x"FD",x"21",x"4D",x"73",x"FD",
+x"7E",x"00",x"B7",x"28",x"55",x"FD",x"36",x"00",x"00",x"3E",x"80",x"D3",x"BF",x"3E",x"81",x"D3",
+x"BF",x"21",x"F0",x"02",x"E5",x"21",x"74",x"13",x"E5",x"21",x"E8",x"08",x"E5",x"CD",x"43",x"28",
+x"F1",x"F1",x"F1",x"FD",x"21",x"46",x"73",x"FD",x"7E",x"00",x"F6",x"02",x"32",x"46",x"73",x"FD",
+x"7E",x"00",x"D3",x"BF",x"3E",x"B2",x"D3",x"BF",x"3E",x"06",x"D3",x"BF",x"3E",x"87",x"D3",x"BF",
+x"CD",x"D4",x"16",x"21",x"38",x"72",x"36",x"00",x"CD",x"64",x"23",x"3E",x"F2",x"D3",x"BF",x"3E",
+x"81",x"D3",x"BF",x"21",x"45",x"73",x"36",x"28",x"18",x"03",x"CD",x"D4",x"16",x"3E",x"0E",x"D3",
+x"54",x"CD",x"6B",x"1A",x"CD",x"BF",x"21",x"CB",x"7D",x"28",x"08",x"CD",x"6B",x"1A",x"CD",x"3A",
+x"1A",x"18",x"F1",x"CD",x"B6",x"2E",x"7D",x"D6",x"02",x"20",x"06",x"CD",x"D4",x"16",x"C3",x"9C",
+x"23",x"FD",x"21",x"4B",x"73",x"FD",x"6E",x"00",x"26",x"00",x"29",x"11",x"C3",x"6A",x"19",x"4E",
+x"23",x"46",x"69",x"60",x"11",x"7F",x"00",x"19",x"7E",x"B7",x"C2",x"AE",x"25",x"11",x"C3",x"66",
+x"1A",x"B7",x"28",x"03",x"13",x"18",x"F9",x"DD",x"73",x"FE",x"DD",x"72",x"FF",x"DD",x"73",x"FC",
+x"DD",x"72",x"FD",x"0A",x"D6",x"2E",x"20",x"33",x"69",x"60",x"23",x"7E",x"D6",x"2E",x"20",x"2B",
+x"4B",x"42",x"0A",x"D6",x"2F",x"28",x"0D",x"59",x"50",x"3E",x"C3",x"93",x"3E",x"66",x"9A",x"30",
+x"03",x"0B",x"18",x"EE",x"59",x"50",x"21",x"C3",x"66",x"BF",x"ED",x"52",x"20",x"09",x"36",x"2F",
+x"21",x"C4",x"66",x"36",x"00",x"18",x"71",x"AF",x"02",x"18",x"6D",x"DD",x"5E",x"FE",x"DD",x"56",
+x"FF",x"3E",x"C4",x"93",x"3E",x"66",x"9A",x"30",x"10",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"36",
+x"2F",x"DD",x"34",x"FE",x"20",x"03",x"DD",x"34",x"FF",x"0A",x"5F",x"B7",x"28",x"29",x"DD",x"7E",
+x"FE",x"D6",x"C3",x"57",x"DD",x"7E",x"FF",x"DE",x"66",x"6F",x"7A",x"D6",x"FE",x"7D",x"17",x"3F",
+x"1F",x"DE",x"81",x"30",x"12",x"03",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"73",x"DD",x"34",x"FE",
+x"20",x"D7",x"DD",x"34",x"FF",x"18",x"D2",x"0A",x"B7",x"28",x"15",x"C1",x"E1",x"E5",x"C5",x"36",
+x"00",x"AF",x"F5",x"33",x"21",x"CA",x"27",x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"C3",x"AD",x"24",
+x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"36",x"00",x"CD",x"D4",x"16",x"C3",x"E2",x"23",x"DD",x"77",
+x"FD",x"DD",x"36",x"FE",x"C3",x"DD",x"36",x"FF",x"68",x"11",x"C3",x"66",x"1A",x"B7",x"28",x"12",
+x"13",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"77",x"DD",x"34",x"FE",x"20",x"EF",x"DD",x"34",x"FF",
+x"18",x"EA",x"DD",x"5E",x"FE",x"DD",x"56",x"FF",x"3A",x"C4",x"66",x"B7",x"28",x"0F",x"DD",x"6E",
+x"FE",x"DD",x"66",x"FF",x"36",x"2F",x"DD",x"5E",x"FE",x"DD",x"56",x"FF",x"13",x"0A",x"DD",x"77",
+x"FF",x"B7",x"28",x"1B",x"7B",x"D6",x"C3",x"6F",x"7A",x"DE",x"68",x"67",x"7D",x"D6",x"7F",x"7C",
+x"17",x"3F",x"1F",x"DE",x"80",x"30",x"08",x"DD",x"7E",x"FF",x"03",x"12",x"13",x"18",x"DE",x"AF",
+x"12",x"0A",x"B7",x"28",x"10",x"3E",x"01",x"F5",x"33",x"21",x"CA",x"27",x"E5",x"CD",x"AF",x"17",
+x"F1",x"33",x"C3",x"AD",x"24",x"CD",x"E7",x"16",x"21",x"DB",x"27",x"E5",x"AF",x"F5",x"33",x"CD",
+x"2C",x"07",x"33",x"21",x"C3",x"68",x"E3",x"21",x"EC",x"6E",x"E5",x"CD",x"B7",x"2F",x"F1",x"F1",
+x"45",x"78",x"B7",x"28",x"0E",x"C5",x"33",x"21",x"E7",x"27",x"E5",x"CD",x"AF",x"17",x"F1",x"33",
+x"C3",x"AD",x"24",x"3E",x"01",x"D3",x"54",x"21",x"00",x"00",x"39",x"4D",x"44",x"59",x"50",x"C5",
+x"D5",x"21",x"00",x"02",x"E5",x"26",x"80",x"E5",x"21",x"EC",x"6E",x"E5",x"CD",x"06",x"29",x"F1",
+x"F1",x"F1",x"F1",x"C1",x"DD",x"75",x"FF",x"7D",x"B7",x"20",x"0D",x"DD",x"7E",x"FA",x"B7",x"20",
+x"07",x"DD",x"7E",x"FB",x"D6",x"02",x"28",x"19",x"21",x"EC",x"6E",x"E5",x"CD",x"A5",x"45",x"F1",
+x"DD",x"7E",x"FF",x"F5",x"33",x"21",x"FC",x"27",x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"C3",x"AD",
+x"24",x"3A",x"00",x"80",x"D6",x"AA",x"20",x"07",x"3A",x"01",x"80",x"D6",x"55",x"28",x"0E",x"3A",
+x"00",x"80",x"D6",x"55",x"20",x"0D",x"3A",x"01",x"80",x"D6",x"AA",x"20",x"06",x"CD",x"BE",x"1D",
+x"C3",x"AD",x"24",x"DD",x"6E",x"FD",x"26",x"00",x"2B",x"7C",x"17",x"9F",x"5F",x"57",x"3E",x"0E",
+x"29",x"CB",x"13",x"CB",x"12",x"3D",x"20",x"F8",x"C5",x"D5",x"E5",x"21",x"EC",x"6E",x"E5",x"CD",
+x"70",x"3E",x"F1",x"F1",x"F1",x"7D",x"C1",x"B7",x"28",x"19",x"21",x"EC",x"6E",x"E5",x"CD",x"A5",
+x"45",x"F1",x"DD",x"7E",x"FF",x"F5",x"33",x"21",x"14",x"28",x"E5",x"CD",x"AF",x"17",x"F1",x"33",
+x"C3",x"AD",x"24",x"C5",x"21",x"00",x"02",x"E5",x"26",x"82",x"E5",x"21",x"EC",x"6E",x"E5",x"CD",
+x"06",x"29",x"F1",x"F1",x"F1",x"F1",x"4D",x"79",x"B7",x"20",x"0D",x"DD",x"7E",x"FA",x"B7",x"20",
+x"07",x"DD",x"7E",x"FB",x"D6",x"02",x"28",x"19",x"C5",x"21",x"EC",x"6E",x"E5",x"CD",x"A5",x"45",
+x"F1",x"C1",x"79",x"F5",x"33",x"21",x"2D",x"28",x"E5",x"CD",x"AF",x"17",x"F1",x"33",x"C3",x"AD",
+x"24",x"3A",x"00",x"82",x"D6",x"AA",x"20",x"07",x"3A",x"01",x"82",x"D6",x"55",x"28",x"0E",x"3A",
+x"00",x"82",x"D6",x"55",x"20",x"19",x"3A",x"01",x"82",x"D6",x"AA",x"20",x"12",x"DD",x"7E",x"FD",
+x"F5",x"33",x"CD",x"F0",x"1E",x"33",x"7D",x"D6",x"0E",x"DA",x"AD",x"24",x"C3",x"E2",x"23",x"21",
+x"EC",x"6E",x"E5",x"CD",x"A5",x"45",x"F1",x"AF",x"F5",x"33",x"21",x"FC",x"27",x"E5",x"CD",x"AF",
+x"17",x"F1",x"33",x"C3",x"AD",x"24",x"00",x"46",x"61",x"69",x"6C",x"65",x"64",x"20",x"74",x"6F",
+x"20",x"6D",x"6F",x"75",x"6E",x"74",x"20",x"53",x"44",x"00",x"52",x"45",x"41",x"44",x"49",x"4E",
+x"47",x"00",x"46",x"61",x"69",x"6C",x"65",x"64",x"20",x"74",x"6F",x"20",x"6F",x"70",x"65",x"6E",
+x"20",x"64",x"69",x"72",x"65",x"63",x"74",x"6F",x"72",x"79",x"00",x"4E",x"6F",x"20",x"66",x"69",
+x"6C",x"65",x"73",x"20",x"66",x"6F",x"75",x"6E",x"64",x"00",x"50",x"61",x"74",x"68",x"20",x"74",
+x"6F",x"6F",x"20",x"6C",x"6F",x"6E",x"67",x"2E",x"2E",x"2E",x"00",x"63",x"68",x"65",x"63",x"6B",
+x"69",x"6E",x"67",x"2E",x"2E",x"2E",x"00",x"46",x"61",x"69",x"6C",x"65",x"64",x"20",x"74",x"6F",
+x"20",x"6F",x"70",x"65",x"6E",x"20",x"66",x"69",x"6C",x"65",x"2E",x"00",x"55",x"6E",x"72",x"65",
+x"63",x"6F",x"67",x"6E",x"69",x"7A",x"65",x"64",x"20",x"66",x"69",x"6C",x"65",x"20",x"74",x"79",
+x"70",x"65",x"2E",x"00",x"46",x"61",x"69",x"6C",x"65",x"64",x"20",x"74",x"6F",x"20",x"69",x"64",
+x"65",x"6E",x"74",x"69",x"66",x"79",x"20",x"66",x"69",x"6C",x"65",x"2E",x"00",x"46",x"61",x"69",
+x"6C",x"65",x"64",x"20",x"74",x"6F",x"20",x"72",x"65",x"61",x"64",x"20",x"62",x"6C",x"6F",x"63",
+x"6B",x"2E",x"00",x"E5",x"C5",x"D5",x"F5",x"21",x"0A",x"00",x"39",x"F9",x"D1",x"7B",x"D3",x"BF",
+x"7A",x"CB",x"F7",x"D3",x"BF",x"E1",x"D1",x"0E",x"BE",x"14",x"15",x"28",x"07",x"AF",x"47",x"ED",
+x"B3",x"15",x"18",x"F5",x"1C",x"1D",x"28",x"03",x"43",x"ED",x"B3",x"21",x"F0",x"FF",x"39",x"F9",
+x"F1",x"D1",x"C1",x"E1",x"C9",x"CD",x"3D",x"3E",x"3E",x"2A",x"D3",x"80",x"DD",x"7E",x"04",x"D6",
+x"02",x"3E",x"01",x"28",x"01",x"AF",x"4F",x"B7",x"28",x"05",x"DB",x"FF",x"5F",x"18",x"03",x"DB",
+x"FC",x"5F",x"CB",x"73",x"20",x"07",x"21",x"39",x"72",x"36",x"12",x"18",x"0F",x"7B",x"E6",x"0F",
+x"5F",x"16",x"00",x"21",x"F6",x"28",x"19",x"EB",x"1A",x"32",x"39",x"72",x"21",x"3B",x"72",x"36",
+x"00",x"21",x"3A",x"72",x"36",x"00",x"3E",x"2A",x"D3",x"C0",x"79",x"B7",x"28",x"05",x"DB",x"FF",
+x"4F",x"18",x"03",x"DB",x"FC",x"4F",x"CB",x"71",x"20",x"05",x"21",x"39",x"72",x"36",x"12",x"CB",
+x"59",x"20",x"05",x"21",x"3B",x"72",x"36",x"FC",x"CB",x"51",x"20",x"05",x"21",x"3A",x"72",x"36",
+x"FC",x"CB",x"49",x"20",x"05",x"21",x"3B",x"72",x"36",x"04",x"CB",x"41",x"20",x"05",x"21",x"3A",
+x"72",x"36",x"04",x"DD",x"E1",x"C9",x"FF",x"38",x"34",x"35",x"FF",x"37",x"23",x"32",x"FF",x"2A",
+x"30",x"39",x"33",x"31",x"36",x"FF",x"CD",x"3D",x"3E",x"21",x"E0",x"FF",x"39",x"F9",x"DD",x"7E",
+x"06",x"DD",x"77",x"FE",x"DD",x"7E",x"07",x"DD",x"77",x"FF",x"DD",x"7E",x"0A",x"DD",x"77",x"E2",
+x"DD",x"7E",x"0B",x"DD",x"77",x"E3",x"C1",x"E1",x"E5",x"C5",x"AF",x"77",x"23",x"77",x"21",x"00",
+x"00",x"39",x"DD",x"7E",x"04",x"DD",x"77",x"E4",x"DD",x"7E",x"05",x"DD",x"77",x"E5",x"E5",x"DD",
+x"6E",x"E4",x"DD",x"66",x"E5",x"E5",x"CD",x"CF",x"34",x"F1",x"F1",x"4D",x"DD",x"71",x"FD",x"79",
+x"B7",x"20",x"1D",x"DD",x"7E",x"E4",x"C6",x"0F",x"DD",x"77",x"E6",x"DD",x"7E",x"E5",x"CE",x"00",
+x"DD",x"77",x"E7",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"7E",x"DD",x"77",x"FD",x"B7",x"28",x"06",
+x"DD",x"6E",x"FD",x"C3",x"50",x"2D",x"DD",x"7E",x"E4",x"DD",x"77",x"E8",x"DD",x"7E",x"E5",x"DD",
+x"77",x"E9",x"DD",x"6E",x"E4",x"DD",x"66",x"E5",x"11",x"0E",x"00",x"19",x"7E",x"0F",x"38",x"05",
+x"2E",x"07",x"C3",x"50",x"2D",x"DD",x"6E",x"E4",x"DD",x"66",x"E5",x"11",x"0A",x"00",x"19",x"4E",
+x"23",x"46",x"23",x"5E",x"23",x"56",x"DD",x"7E",x"E4",x"C6",x"10",x"DD",x"77",x"EA",x"DD",x"7E",
+x"E5",x"CE",x"00",x"DD",x"77",x"EB",x"D5",x"C5",x"DD",x"5E",x"EA",x"DD",x"56",x"EB",x"21",x"1E",
+x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"D1",x"79",x"DD",x"96",x"FA",x"4F",x"78",
+x"DD",x"9E",x"FB",x"47",x"7B",x"DD",x"9E",x"FC",x"5F",x"7A",x"DD",x"9E",x"FD",x"57",x"DD",x"7E",
+x"08",x"DD",x"77",x"FA",x"DD",x"7E",x"09",x"DD",x"77",x"FB",x"AF",x"DD",x"77",x"FC",x"DD",x"77",
+x"FD",x"79",x"DD",x"96",x"FA",x"78",x"DD",x"9E",x"FB",x"7B",x"DD",x"9E",x"FC",x"7A",x"DD",x"9E",
+x"FD",x"30",x"06",x"DD",x"71",x"08",x"DD",x"70",x"09",x"DD",x"7E",x"E4",x"DD",x"77",x"EC",x"DD",
+x"7E",x"E5",x"DD",x"77",x"ED",x"DD",x"7E",x"E4",x"DD",x"77",x"EE",x"DD",x"7E",x"E5",x"DD",x"77",
+x"EF",x"DD",x"7E",x"EA",x"DD",x"77",x"F0",x"DD",x"7E",x"EB",x"DD",x"77",x"F1",x"DD",x"7E",x"E4",
+x"C6",x"1C",x"DD",x"77",x"F2",x"DD",x"7E",x"E5",x"CE",x"00",x"DD",x"77",x"F3",x"DD",x"7E",x"E4",
+x"DD",x"77",x"F4",x"DD",x"7E",x"E5",x"DD",x"77",x"F5",x"DD",x"7E",x"09",x"DD",x"B6",x"08",x"CA",
+x"4E",x"2D",x"DD",x"6E",x"EA",x"DD",x"66",x"EB",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"79",
+x"B7",x"C2",x"84",x"2C",x"CB",x"40",x"C2",x"84",x"2C",x"DD",x"70",x"FA",x"DD",x"73",x"FB",x"DD",
+x"72",x"FC",x"AF",x"DD",x"77",x"FD",x"DD",x"CB",x"FC",x"3E",x"DD",x"CB",x"FB",x"1E",x"DD",x"CB",
+x"FA",x"1E",x"E1",x"E5",x"C5",x"01",x"09",x"00",x"09",x"C1",x"7E",x"2B",x"6E",x"67",x"2B",x"DD",
+x"7E",x"FA",x"DD",x"77",x"FC",x"DD",x"7E",x"FB",x"DD",x"77",x"FD",x"7D",x"DD",x"A6",x"FC",x"6F",
+x"7C",x"DD",x"A6",x"FD",x"67",x"DD",x"75",x"FC",x"DD",x"74",x"FD",x"7C",x"DD",x"B6",x"FC",x"C2",
+x"3B",x"2B",x"7A",x"B3",x"B0",x"B1",x"20",x"13",x"DD",x"6E",x"EC",x"DD",x"66",x"ED",x"11",x"06",
+x"00",x"19",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"18",x"2E",x"DD",x"7E",x"E8",x"DD",x"77",
+x"FA",x"DD",x"7E",x"E9",x"DD",x"77",x"FB",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"11",x"14",x"00",
+x"19",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"D5",x"C5",x"DD",x"6E",x"E8",x"DD",x"66",x"E9",
+x"E5",x"CD",x"EB",x"43",x"F1",x"F1",x"F1",x"4D",x"44",x"79",x"D6",x"02",x"78",x"DE",x"00",x"7B",
+x"DE",x"00",x"7A",x"DE",x"00",x"30",x"0D",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"36",x"02",x"2E",
+x"02",x"C3",x"50",x"2D",x"79",x"A0",x"A3",x"A2",x"3C",x"20",x"0D",x"DD",x"6E",x"E6",x"DD",x"66",
+x"E7",x"36",x"01",x"2E",x"01",x"C3",x"50",x"2D",x"DD",x"7E",x"EE",x"C6",x"14",x"6F",x"DD",x"7E",
+x"EF",x"CE",x"00",x"67",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"6E",x"E4",x"DD",x"66",
+x"E5",x"11",x"14",x"00",x"19",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"D5",x"C5",x"DD",x"6E",
+x"E0",x"DD",x"66",x"E1",x"E5",x"CD",x"92",x"36",x"F1",x"F1",x"F1",x"7A",x"B3",x"B4",x"B5",x"20",
+x"0D",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"36",x"02",x"2E",x"02",x"C3",x"50",x"2D",x"DD",x"7E",
+x"FC",x"DD",x"77",x"F8",x"DD",x"7E",x"FD",x"DD",x"77",x"F9",x"AF",x"DD",x"77",x"FA",x"DD",x"77",
+x"FB",x"7D",x"DD",x"86",x"F8",x"4F",x"7C",x"DD",x"8E",x"F9",x"47",x"7B",x"DD",x"8E",x"FA",x"5F",
+x"7A",x"DD",x"8E",x"FB",x"57",x"DD",x"71",x"F8",x"DD",x"70",x"F9",x"DD",x"73",x"FA",x"DD",x"72",
+x"FB",x"DD",x"7E",x"09",x"CB",x"3F",x"4F",x"06",x"00",x"78",x"B1",x"28",x"5D",x"DD",x"7E",x"FC",
+x"81",x"5F",x"DD",x"7E",x"FD",x"88",x"57",x"E1",x"E5",x"C5",x"01",x"08",x"00",x"09",x"C1",x"7E",
+x"23",x"66",x"6F",x"93",x"7C",x"9A",x"30",x"0A",x"7D",x"DD",x"96",x"FC",x"4F",x"7C",x"DD",x"9E",
+x"FD",x"47",x"C5",x"C5",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"E5",x"DD",x"6E",x"F8",x"DD",x"66",
+x"F9",x"E5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"CD",x"8B",x"2D",x"F1",x"F1",x"F1",x"F1",
+x"7D",x"C1",x"B7",x"28",x"0D",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"36",x"01",x"2E",x"01",x"C3",
+x"50",x"2D",x"79",x"87",x"47",x"0E",x"00",x"C3",x"D8",x"2C",x"DD",x"7E",x"E4",x"C6",x"18",x"DD",
+x"77",x"FC",x"DD",x"7E",x"E5",x"CE",x"00",x"DD",x"77",x"FD",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",
+x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"DD",x"7E",x"F8",x"91",x"20",x"11",x"DD",x"7E",x"F9",
+x"90",x"20",x"0B",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"BF",x"ED",x"52",x"28",x"37",x"DD",x"7E",
+x"E4",x"C6",x"1C",x"4F",x"DD",x"7E",x"E5",x"CE",x"00",x"47",x"21",x"01",x"00",x"E5",x"DD",x"6E",
+x"FA",x"DD",x"66",x"FB",x"E5",x"DD",x"6E",x"F8",x"DD",x"66",x"F9",x"E5",x"C5",x"CD",x"8B",x"2D",
+x"F1",x"F1",x"F1",x"F1",x"7D",x"B7",x"28",x"0D",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"36",x"01",
+x"2E",x"01",x"C3",x"50",x"2D",x"DD",x"5E",x"FC",x"DD",x"56",x"FD",x"21",x"18",x"00",x"39",x"01",
+x"04",x"00",x"ED",x"B0",x"DD",x"5E",x"F0",x"DD",x"56",x"F1",x"21",x"1A",x"00",x"39",x"EB",x"01",
+x"04",x"00",x"ED",x"B0",x"DD",x"4E",x"FA",x"DD",x"7E",x"FB",x"E6",x"01",x"47",x"AF",x"91",x"4F",
+x"3E",x"02",x"98",x"47",x"DD",x"7E",x"08",x"91",x"DD",x"7E",x"09",x"98",x"30",x"06",x"DD",x"4E",
+x"08",x"DD",x"46",x"09",x"DD",x"5E",x"FA",x"DD",x"7E",x"FB",x"E6",x"01",x"57",x"7B",x"DD",x"86",
+x"F2",x"5F",x"7A",x"DD",x"8E",x"F3",x"57",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"C5",x"C5",x"D5",
+x"E5",x"CD",x"AE",x"00",x"F1",x"F1",x"F1",x"C1",x"DD",x"7E",x"08",x"91",x"DD",x"77",x"08",x"DD",
+x"7E",x"09",x"98",x"DD",x"77",x"09",x"DD",x"6E",x"E2",x"DD",x"66",x"E3",x"7E",x"23",x"66",x"6F",
+x"09",x"EB",x"DD",x"6E",x"E2",x"DD",x"66",x"E3",x"73",x"23",x"72",x"DD",x"7E",x"FE",x"81",x"DD",
+x"77",x"FE",x"DD",x"7E",x"FF",x"88",x"DD",x"77",x"FF",x"DD",x"7E",x"F4",x"C6",x"10",x"5F",x"DD",
+x"7E",x"F5",x"CE",x"00",x"57",x"D5",x"C5",x"21",x"1A",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",
+x"B0",x"C1",x"D1",x"21",x"00",x"00",x"79",x"DD",x"86",x"F6",x"DD",x"77",x"FA",x"78",x"DD",x"8E",
+x"F7",x"DD",x"77",x"FB",x"7D",x"DD",x"8E",x"F8",x"DD",x"77",x"FC",x"7C",x"DD",x"8E",x"F9",x"DD",
+x"77",x"FD",x"21",x"1A",x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"C3",x"49",x"2A",x"2E",x"00",
+x"DD",x"F9",x"DD",x"E1",x"C9",x"DD",x"E5",x"DD",x"21",x"00",x"00",x"DD",x"39",x"DD",x"7E",x"04",
+x"DD",x"4E",x"05",x"D3",x"BF",x"06",x"00",x"79",x"D3",x"BF",x"00",x"00",x"00",x"00",x"00",x"DD",
+x"4E",x"06",x"DD",x"46",x"07",x"DD",x"5E",x"08",x"DD",x"56",x"09",x"6B",x"62",x"1B",x"7C",x"B5",
+x"28",x"06",x"DB",x"BE",x"02",x"03",x"18",x"F3",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",x"3B",
+x"CD",x"B6",x"2E",x"7D",x"0F",x"30",x"05",x"2E",x"03",x"C3",x"4C",x"2E",x"3A",x"3E",x"72",x"CB",
+x"5F",x"20",x"14",x"06",x"09",x"DD",x"CB",x"06",x"26",x"DD",x"CB",x"07",x"16",x"DD",x"CB",x"08",
+x"16",x"DD",x"CB",x"09",x"16",x"10",x"EE",x"3E",x"01",x"DD",x"BE",x"0A",x"3E",x"00",x"DD",x"9E",
+x"0B",x"30",x"04",x"3E",x"12",x"18",x"02",x"3E",x"11",x"DD",x"77",x"FD",x"DD",x"6E",x"08",x"DD",
+x"66",x"09",x"E5",x"DD",x"6E",x"06",x"DD",x"66",x"07",x"E5",x"DD",x"7E",x"FD",x"F5",x"33",x"CD",
+x"5B",x"31",x"F1",x"F1",x"33",x"7D",x"B7",x"20",x"50",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"DD",
+x"4E",x"0A",x"DD",x"46",x"0B",x"E5",x"C5",x"11",x"00",x"02",x"D5",x"E5",x"CD",x"A0",x"32",x"F1",
+x"F1",x"DD",x"75",x"FE",x"DD",x"74",x"FF",x"C1",x"E1",x"DD",x"7E",x"FF",x"DD",x"B6",x"FE",x"28",
+x"09",x"11",x"00",x"02",x"19",x"0B",x"78",x"B1",x"20",x"DB",x"DD",x"71",x"0A",x"DD",x"70",x"0B",
+x"DD",x"7E",x"FD",x"D6",x"12",x"20",x"12",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"3E",
+x"0C",x"F5",x"33",x"CD",x"5B",x"31",x"F1",x"F1",x"33",x"CD",x"B9",x"34",x"DD",x"7E",x"0B",x"DD",
+x"B6",x"0A",x"28",x"05",x"21",x"01",x"00",x"18",x"03",x"21",x"00",x"00",x"DD",x"F9",x"DD",x"E1",
+x"C9",x"21",x"43",x"73",x"36",x"00",x"DB",x"BF",x"32",x"54",x"73",x"3A",x"57",x"73",x"3C",x"32",
+x"57",x"73",x"FD",x"21",x"55",x"73",x"FD",x"7E",x"01",x"FD",x"B6",x"00",x"C8",x"2A",x"55",x"73",
+x"E9",x"FD",x"21",x"02",x"00",x"FD",x"39",x"FD",x"7E",x"00",x"32",x"55",x"73",x"FD",x"7E",x"01",
+x"32",x"56",x"73",x"C9",x"21",x"00",x"00",x"22",x"55",x"73",x"C9",x"F5",x"3E",x"9F",x"D3",x"FF",
+x"3E",x"BF",x"D3",x"FF",x"3E",x"DF",x"D3",x"FF",x"3E",x"FF",x"D3",x"FF",x"21",x"43",x"73",x"36",
+x"00",x"21",x"60",x"EA",x"E3",x"C1",x"C5",x"03",x"33",x"33",x"C5",x"78",x"B1",x"20",x"F6",x"DB",
+x"BF",x"32",x"54",x"73",x"F1",x"C9",x"DB",x"56",x"07",x"30",x"08",x"FD",x"21",x"58",x"73",x"FD",
+x"6E",x"00",x"C9",x"2E",x"02",x"C9",x"CD",x"3D",x"3E",x"F5",x"F5",x"F5",x"F5",x"DD",x"7E",x"05",
+x"DD",x"B6",x"04",x"20",x"05",x"2E",x"09",x"C3",x"B2",x"2F",x"21",x"00",x"00",x"39",x"E5",x"CD",
+x"4A",x"37",x"F1",x"4D",x"DD",x"5E",x"04",x"DD",x"56",x"05",x"79",x"B7",x"C2",x"A9",x"2F",x"6B",
+x"62",x"DD",x"7E",x"F8",x"77",x"23",x"DD",x"7E",x"F9",x"77",x"D5",x"DD",x"6E",x"06",x"DD",x"66",
+x"07",x"E5",x"D5",x"CD",x"F4",x"48",x"F1",x"F1",x"7D",x"D1",x"4F",x"B7",x"C2",x"A2",x"2F",x"6B",
+x"62",x"C5",x"01",x"27",x"00",x"09",x"C1",x"7E",x"07",x"38",x"54",x"6B",x"62",x"23",x"23",x"23",
+x"23",x"CB",x"66",x"28",x"48",x"21",x"06",x"00",x"19",x"DD",x"75",x"FA",x"DD",x"74",x"FB",x"6B",
+x"62",x"C5",x"01",x"1A",x"00",x"09",x"C1",x"46",x"23",x"66",x"C5",x"D5",x"68",x"E5",x"DD",x"6E",
+x"F8",x"DD",x"66",x"F9",x"E5",x"CD",x"62",x"43",x"F1",x"F1",x"DD",x"75",x"FC",x"DD",x"74",x"FD",
+x"DD",x"73",x"FE",x"DD",x"72",x"FF",x"D1",x"C1",x"D5",x"C5",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",
+x"21",x"08",x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"D1",x"18",x"02",x"0E",x"05",x"79",
+x"B7",x"20",x"2F",x"21",x"02",x"00",x"19",x"DD",x"75",x"FE",x"DD",x"74",x"FF",x"E1",x"E5",x"01",
+x"04",x"00",x"09",x"4E",x"23",x"46",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"71",x"23",x"70",x"D5",
+x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"D5",x"CD",x"E0",x"45",x"F1",x"F1",x"F1",x"7D",
+x"D1",x"4F",x"79",x"D6",x"04",x"20",x"02",x"0E",x"05",x"79",x"B7",x"28",x"04",x"AF",x"12",x"13",
+x"12",x"69",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"21",x"CB",x"FF",x"39",x"F9",x"DD",
+x"7E",x"05",x"DD",x"B6",x"04",x"20",x"05",x"2E",x"09",x"C3",x"17",x"31",x"21",x"2C",x"00",x"39",
+x"E5",x"CD",x"4A",x"37",x"F1",x"DD",x"75",x"F9",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"DD",x"7E",
+x"F9",x"B7",x"C2",x"0A",x"31",x"21",x"00",x"00",x"39",x"DD",x"7E",x"F7",x"77",x"23",x"DD",x"7E",
+x"F8",x"77",x"21",x"00",x"00",x"39",x"EB",x"DD",x"73",x"FE",x"DD",x"72",x"FF",x"C5",x"D5",x"DD",
+x"6E",x"06",x"DD",x"66",x"07",x"E5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"CD",x"F4",x"48",
+x"F1",x"F1",x"D1",x"C1",x"DD",x"75",x"F9",x"7D",x"B7",x"20",x"20",x"6B",x"62",x"C5",x"01",x"27",
+x"00",x"09",x"C1",x"7E",x"07",x"30",x"06",x"DD",x"36",x"F9",x"06",x"18",x"0E",x"6B",x"62",x"23",
+x"23",x"23",x"23",x"CB",x"66",x"28",x"04",x"DD",x"36",x"F9",x"04",x"DD",x"7E",x"F9",x"B7",x"C2",
+x"0A",x"31",x"21",x"06",x"00",x"09",x"DD",x"75",x"FA",x"DD",x"74",x"FB",x"21",x"1A",x"00",x"19",
+x"EB",x"6B",x"62",x"7E",x"23",x"66",x"6F",x"C5",x"D5",x"E5",x"DD",x"6E",x"F7",x"DD",x"66",x"F8",
+x"E5",x"CD",x"62",x"43",x"F1",x"F1",x"DD",x"75",x"FC",x"DD",x"74",x"FD",x"DD",x"73",x"FE",x"DD",
+x"72",x"FF",x"D1",x"C1",x"D5",x"C5",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"21",x"35",x"00",x"39",
+x"01",x"04",x"00",x"ED",x"B0",x"C1",x"D1",x"21",x"0A",x"00",x"09",x"DD",x"75",x"FA",x"DD",x"74",
+x"FB",x"EB",x"5E",x"23",x"56",x"21",x"1C",x"00",x"19",x"C5",x"E5",x"CD",x"43",x"35",x"F1",x"DD",
+x"75",x"FC",x"DD",x"74",x"FD",x"DD",x"73",x"FE",x"DD",x"72",x"FF",x"DD",x"5E",x"FA",x"DD",x"56",
+x"FB",x"21",x"33",x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"69",x"60",x"DD",x"7E",x"F7",
+x"77",x"23",x"DD",x"7E",x"F8",x"77",x"21",x"02",x"00",x"09",x"DD",x"75",x"FE",x"DD",x"74",x"FF",
+x"DD",x"6E",x"F7",x"DD",x"66",x"F8",x"11",x"04",x"00",x"19",x"5E",x"23",x"56",x"DD",x"6E",x"FE",
+x"DD",x"66",x"FF",x"73",x"23",x"72",x"21",x"0E",x"00",x"09",x"36",x"01",x"21",x"0F",x"00",x"09",
+x"36",x"00",x"21",x"18",x"00",x"09",x"AF",x"77",x"23",x"77",x"23",x"77",x"23",x"77",x"21",x"10",
+x"00",x"09",x"AF",x"77",x"23",x"77",x"23",x"77",x"23",x"77",x"DD",x"7E",x"F9",x"B7",x"28",x"04",
+x"AF",x"02",x"03",x"02",x"DD",x"6E",x"F9",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"2A",
+x"3F",x"72",x"4D",x"7C",x"47",x"B5",x"28",x"02",x"AF",x"02",x"DD",x"7E",x"05",x"DD",x"B6",x"04",
+x"28",x"08",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"AF",x"02",x"21",x"3F",x"72",x"DD",x"7E",x"04",
+x"77",x"23",x"DD",x"7E",x"05",x"77",x"DD",x"7E",x"08",x"B7",x"20",x"03",x"6F",x"18",x"09",x"21",
+x"04",x"00",x"39",x"E5",x"CD",x"4A",x"37",x"F1",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"21",x"F3",
+x"FF",x"39",x"F9",x"DD",x"7E",x"04",x"CB",x"7F",x"28",x"1D",x"E6",x"7F",x"DD",x"77",x"04",x"21",
+x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"3E",x"37",x"F5",x"33",x"CD",x"5B",x"31",x"F1",x"F1",
+x"33",x"3E",x"01",x"95",x"DA",x"73",x"32",x"DD",x"7E",x"04",x"D6",x"0C",x"3E",x"01",x"28",x"01",
+x"AF",x"4F",x"CB",x"41",x"20",x"11",x"C5",x"CD",x"B9",x"34",x"CD",x"78",x"32",x"C1",x"7C",x"B5",
+x"20",x"05",x"2E",x"FF",x"C3",x"73",x"32",x"21",x"01",x"00",x"39",x"DD",x"75",x"FA",x"DD",x"74",
+x"FB",x"DD",x"46",x"04",x"78",x"CB",x"F7",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"77",x"DD",x"5E",
+x"FA",x"DD",x"56",x"FB",x"13",x"DD",x"7E",x"08",x"DD",x"77",x"FC",x"AF",x"DD",x"77",x"FD",x"DD",
+x"77",x"FE",x"DD",x"77",x"FF",x"DD",x"7E",x"FC",x"12",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"13",
+x"13",x"DD",x"7E",x"07",x"DD",x"77",x"FC",x"DD",x"7E",x"08",x"DD",x"77",x"FD",x"AF",x"DD",x"77",
+x"FE",x"DD",x"77",x"FF",x"DD",x"7E",x"FC",x"12",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"23",x"23",
+x"23",x"DD",x"5E",x"06",x"73",x"DD",x"7E",x"FA",x"C6",x"04",x"5F",x"DD",x"7E",x"FB",x"CE",x"00",
+x"57",x"DD",x"7E",x"05",x"12",x"1E",x"01",x"78",x"B7",x"20",x"02",x"1E",x"95",x"DD",x"7E",x"04",
+x"D6",x"08",x"20",x"02",x"1E",x"87",x"DD",x"7E",x"FA",x"C6",x"05",x"6F",x"DD",x"7E",x"FB",x"CE",
+x"00",x"67",x"73",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"C5",x"21",x"06",x"00",x"E5",x"D5",x"CD",
+x"CB",x"45",x"F1",x"F1",x"C1",x"79",x"B7",x"28",x"0E",x"21",x"00",x"00",x"39",x"01",x"01",x"00",
+x"C5",x"E5",x"CD",x"47",x"3E",x"F1",x"F1",x"0E",x"0A",x"21",x"00",x"00",x"39",x"C5",x"11",x"01",
+x"00",x"D5",x"E5",x"CD",x"47",x"3E",x"F1",x"F1",x"C1",x"DD",x"6E",x"F3",x"CB",x"7D",x"28",x"03",
+x"0D",x"20",x"E6",x"DD",x"F9",x"DD",x"E1",x"C9",x"3B",x"3A",x"3D",x"72",x"D3",x"56",x"21",x"00",
+x"00",x"39",x"01",x"01",x"00",x"C5",x"E5",x"CD",x"47",x"3E",x"F1",x"F1",x"CD",x"93",x"4A",x"7C",
+x"B5",x"28",x"05",x"21",x"01",x"00",x"18",x"06",x"CD",x"B9",x"34",x"21",x"00",x"00",x"33",x"C9",
+x"CD",x"3D",x"3E",x"F5",x"01",x"E8",x"03",x"21",x"00",x"00",x"39",x"E5",x"FD",x"E1",x"E5",x"C5",
+x"11",x"01",x"00",x"D5",x"FD",x"E5",x"CD",x"47",x"3E",x"F1",x"F1",x"C1",x"E1",x"7E",x"3C",x"20",
+x"15",x"E5",x"C5",x"3E",x"02",x"F5",x"33",x"CD",x"64",x"16",x"33",x"C1",x"E1",x"59",x"50",x"1B",
+x"4B",x"7A",x"47",x"B3",x"20",x"D5",x"7E",x"D6",x"FE",x"28",x"05",x"21",x"00",x"00",x"18",x"22",
+x"E5",x"DD",x"4E",x"06",x"DD",x"46",x"07",x"C5",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"C5",x"CD",
+x"47",x"3E",x"F1",x"F1",x"E1",x"01",x"02",x"00",x"C5",x"E5",x"CD",x"47",x"3E",x"F1",x"F1",x"21",
+x"01",x"00",x"F1",x"DD",x"E1",x"C9",x"D1",x"C1",x"C5",x"D5",x"79",x"D3",x"BF",x"0E",x"00",x"78",
+x"D3",x"BF",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"DB",x"BE",x"6F",x"C9",
+x"CD",x"3D",x"3E",x"F5",x"F5",x"3B",x"21",x"3C",x"72",x"36",x"03",x"21",x"3D",x"72",x"36",x"02",
+x"3E",x"C8",x"F5",x"33",x"CD",x"64",x"16",x"33",x"3A",x"3C",x"72",x"D3",x"56",x"0E",x"0A",x"21",
+x"00",x"00",x"39",x"EB",x"D5",x"FD",x"E1",x"C5",x"D5",x"21",x"01",x"00",x"E5",x"FD",x"E5",x"CD",
+x"47",x"3E",x"F1",x"F1",x"D1",x"C1",x"79",x"3D",x"4F",x"B7",x"20",x"E8",x"AF",x"DD",x"77",x"FF",
+x"D5",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"AF",x"F5",x"33",x"CD",x"5B",x"31",x"F1",
+x"F1",x"33",x"D1",x"2D",x"C2",x"96",x"34",x"21",x"3C",x"72",x"36",x"01",x"21",x"3D",x"72",x"36",
+x"00",x"D5",x"21",x"00",x"00",x"E5",x"21",x"AA",x"01",x"E5",x"3E",x"08",x"F5",x"33",x"CD",x"5B",
+x"31",x"F1",x"F1",x"33",x"D1",x"2D",x"C2",x"27",x"34",x"4B",x"42",x"D5",x"21",x"04",x"00",x"E5",
+x"C5",x"CD",x"47",x"3E",x"F1",x"F1",x"D1",x"6B",x"62",x"23",x"23",x"7E",x"3D",x"C2",x"96",x"34",
+x"6B",x"62",x"23",x"23",x"23",x"7E",x"D6",x"AA",x"C2",x"96",x"34",x"01",x"E8",x"03",x"C5",x"D5",
+x"21",x"00",x"40",x"E5",x"21",x"00",x"00",x"E5",x"3E",x"A9",x"F5",x"33",x"CD",x"5B",x"31",x"F1",
+x"F1",x"33",x"7D",x"D1",x"C1",x"B7",x"28",x"11",x"C5",x"D5",x"3E",x"14",x"F5",x"33",x"CD",x"64",
+x"16",x"33",x"D1",x"C1",x"0B",x"78",x"B1",x"20",x"D5",x"78",x"B1",x"CA",x"96",x"34",x"D5",x"21",
+x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"3E",x"3A",x"F5",x"33",x"CD",x"5B",x"31",x"F1",x"F1",
+x"33",x"7D",x"D1",x"B7",x"C2",x"96",x"34",x"4B",x"42",x"D5",x"21",x"04",x"00",x"E5",x"C5",x"CD",
+x"47",x"3E",x"F1",x"F1",x"D1",x"1A",x"CB",x"77",x"28",x"05",x"01",x"0C",x"00",x"18",x"03",x"01",
+x"04",x"00",x"DD",x"71",x"FF",x"18",x"6F",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"3E",
+x"A9",x"F5",x"33",x"CD",x"5B",x"31",x"F1",x"F1",x"33",x"3E",x"01",x"95",x"38",x"08",x"DD",x"36",
+x"FF",x"02",x"06",x"A9",x"18",x"06",x"DD",x"36",x"FF",x"01",x"06",x"01",x"11",x"E8",x"03",x"C5",
+x"D5",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"C5",x"33",x"CD",x"5B",x"31",x"F1",x"F1",
+x"33",x"7D",x"D1",x"C1",x"B7",x"28",x"11",x"C5",x"D5",x"3E",x"14",x"F5",x"33",x"CD",x"64",x"16",
+x"33",x"D1",x"C1",x"1B",x"7A",x"B3",x"20",x"D7",x"7A",x"B3",x"28",x"16",x"21",x"00",x"00",x"E5",
+x"21",x"00",x"02",x"E5",x"3E",x"10",x"F5",x"33",x"CD",x"5B",x"31",x"F1",x"F1",x"33",x"7D",x"B7",
+x"28",x"04",x"AF",x"DD",x"77",x"FF",x"DD",x"7E",x"FF",x"32",x"3E",x"72",x"DD",x"7E",x"FF",x"B7",
+x"28",x"05",x"01",x"00",x"00",x"18",x"03",x"01",x"01",x"00",x"21",x"58",x"73",x"71",x"C5",x"CD",
+x"B9",x"34",x"C1",x"69",x"DD",x"F9",x"DD",x"E1",x"C9",x"3B",x"3A",x"3C",x"72",x"D3",x"56",x"21",
+x"00",x"00",x"39",x"01",x"01",x"00",x"C5",x"E5",x"CD",x"47",x"3E",x"F1",x"F1",x"33",x"C9",x"CD",
+x"3D",x"3E",x"F5",x"3B",x"DD",x"36",x"FD",x"09",x"DD",x"5E",x"04",x"DD",x"56",x"05",x"DD",x"7E",
+x"05",x"DD",x"B6",x"04",x"28",x"3B",x"6B",x"62",x"4E",x"23",x"46",x"78",x"B1",x"28",x"32",x"0A",
+x"B7",x"28",x"2E",x"6B",x"62",x"23",x"23",x"7E",x"DD",x"77",x"FE",x"23",x"7E",x"DD",x"77",x"FF",
+x"69",x"60",x"01",x"04",x"00",x"09",x"4E",x"23",x"46",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"BF",
+x"ED",x"42",x"20",x"0D",x"D5",x"CD",x"B6",x"2E",x"7D",x"D1",x"0F",x"38",x"04",x"AF",x"DD",x"77",
+x"FD",x"DD",x"4E",x"06",x"DD",x"46",x"07",x"DD",x"7E",x"FD",x"B7",x"20",x"06",x"EB",x"5E",x"23",
+x"56",x"18",x"03",x"11",x"00",x"00",x"7B",x"02",x"03",x"7A",x"02",x"DD",x"6E",x"FD",x"DD",x"F9",
+x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",x"F5",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"23",x"23",
+x"23",x"4E",x"06",x"00",x"1E",x"00",x"DD",x"71",x"FD",x"DD",x"70",x"FE",x"DD",x"73",x"FF",x"AF",
+x"DD",x"77",x"FC",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"23",x"23",x"4E",x"06",x"00",x"11",x"00",
+x"00",x"79",x"DD",x"B6",x"FC",x"4F",x"78",x"DD",x"B6",x"FD",x"47",x"7B",x"DD",x"B6",x"FE",x"5F",
+x"7A",x"DD",x"B6",x"FF",x"DD",x"71",x"FD",x"DD",x"70",x"FE",x"DD",x"73",x"FF",x"AF",x"DD",x"77",
+x"FC",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"23",x"4E",x"06",x"00",x"11",x"00",x"00",x"79",x"DD",
+x"B6",x"FC",x"4F",x"78",x"DD",x"B6",x"FD",x"47",x"7B",x"DD",x"B6",x"FE",x"5F",x"7A",x"DD",x"B6",
+x"FF",x"DD",x"71",x"FD",x"DD",x"70",x"FE",x"DD",x"73",x"FF",x"AF",x"DD",x"77",x"FC",x"DD",x"6E",
+x"04",x"DD",x"66",x"05",x"4E",x"06",x"00",x"11",x"00",x"00",x"DD",x"7E",x"FC",x"B1",x"6F",x"DD",
+x"7E",x"FD",x"B0",x"67",x"DD",x"7E",x"FE",x"B3",x"5F",x"DD",x"7E",x"FF",x"B2",x"57",x"DD",x"F9",
+x"DD",x"E1",x"C9",x"01",x"03",x"05",x"07",x"09",x"0E",x"10",x"12",x"14",x"16",x"18",x"1C",x"1E",
+x"80",x"9A",x"45",x"41",x"8E",x"41",x"8F",x"80",x"45",x"45",x"45",x"49",x"49",x"49",x"8E",x"8F",
+x"90",x"92",x"92",x"4F",x"99",x"4F",x"55",x"55",x"59",x"99",x"9A",x"9B",x"9C",x"9D",x"9E",x"9F",
+x"41",x"49",x"4F",x"55",x"A5",x"A5",x"A6",x"A7",x"A8",x"A9",x"AA",x"AB",x"AC",x"AD",x"AE",x"AF",
+x"B0",x"B1",x"B2",x"B3",x"B4",x"B5",x"B6",x"B7",x"B8",x"B9",x"BA",x"BB",x"BC",x"BD",x"BE",x"BF",
+x"C0",x"C1",x"C2",x"C3",x"C4",x"C5",x"C6",x"C7",x"C8",x"C9",x"CA",x"CB",x"CC",x"CD",x"CE",x"CF",
+x"D0",x"D1",x"D2",x"D3",x"D4",x"D5",x"D6",x"D7",x"D8",x"D9",x"DA",x"DB",x"DC",x"DD",x"DE",x"DF",
+x"E0",x"E1",x"E2",x"E3",x"E4",x"E5",x"E6",x"E7",x"E8",x"E9",x"EA",x"EB",x"EC",x"ED",x"EE",x"EF",
+x"F0",x"F1",x"F2",x"F3",x"F4",x"F5",x"F6",x"F7",x"F8",x"F9",x"FA",x"FB",x"FC",x"FD",x"FE",x"FF",
+x"D1",x"C1",x"C5",x"D5",x"79",x"D3",x"BF",x"78",x"F6",x"40",x"D3",x"BF",x"21",x"05",x"00",x"39",
+x"4E",x"23",x"46",x"59",x"50",x"0B",x"7A",x"B3",x"C8",x"21",x"04",x"00",x"39",x"7E",x"D3",x"BE",
+x"18",x"F1",x"CD",x"3D",x"3E",x"F5",x"F5",x"DD",x"7E",x"06",x"C6",x"FE",x"DD",x"77",x"06",x"DD",
+x"7E",x"07",x"CE",x"FF",x"DD",x"77",x"07",x"DD",x"7E",x"08",x"CE",x"FF",x"DD",x"77",x"08",x"DD",
+x"7E",x"09",x"CE",x"FF",x"DD",x"77",x"09",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"69",x"60",x"11",
+x"0C",x"00",x"19",x"5E",x"23",x"56",x"23",x"23",x"7E",x"2B",x"6E",x"67",x"7B",x"C6",x"FE",x"5F",
+x"7A",x"CE",x"FF",x"57",x"7D",x"CE",x"FF",x"6F",x"7C",x"CE",x"FF",x"67",x"DD",x"7E",x"06",x"93",
+x"DD",x"7E",x"07",x"9A",x"DD",x"7E",x"08",x"9D",x"DD",x"7E",x"09",x"9C",x"38",x"07",x"21",x"00",
+x"00",x"5D",x"54",x"18",x"50",x"69",x"60",x"11",x"20",x"00",x"19",x"7E",x"DD",x"77",x"FC",x"23",
+x"7E",x"DD",x"77",x"FD",x"23",x"7E",x"DD",x"77",x"FE",x"23",x"7E",x"DD",x"77",x"FF",x"69",x"60",
+x"11",x"08",x"00",x"19",x"4E",x"23",x"46",x"11",x"00",x"00",x"DD",x"6E",x"08",x"DD",x"66",x"09",
+x"E5",x"DD",x"6E",x"06",x"DD",x"66",x"07",x"E5",x"D5",x"C5",x"CD",x"B3",x"5C",x"F1",x"F1",x"F1",
+x"F1",x"7D",x"DD",x"86",x"FC",x"6F",x"7C",x"DD",x"8E",x"FD",x"67",x"7B",x"DD",x"8E",x"FE",x"5F",
+x"7A",x"DD",x"8E",x"FF",x"57",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"21",x"CD",x"FF",
+x"39",x"F9",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"69",x"60",x"AF",x"77",x"23",x"77",x"21",x"3F",
+x"72",x"7E",x"DD",x"77",x"E5",x"23",x"7E",x"DD",x"77",x"E6",x"DD",x"B6",x"E5",x"20",x"05",x"2E",
+x"0C",x"C3",x"38",x"3E",x"DD",x"7E",x"E5",x"02",x"03",x"DD",x"7E",x"E6",x"02",x"DD",x"6E",x"E5",
+x"DD",x"66",x"E6",x"7E",x"B7",x"28",x"0C",x"CD",x"B6",x"2E",x"7D",x"0F",x"38",x"05",x"2E",x"00",
+x"C3",x"38",x"3E",x"DD",x"6E",x"E5",x"DD",x"66",x"E6",x"36",x"00",x"CD",x"20",x"33",x"7D",x"0F",
+x"30",x"05",x"2E",x"03",x"C3",x"38",x"3E",x"AF",x"DD",x"77",x"E7",x"DD",x"77",x"E8",x"DD",x"77",
+x"E9",x"DD",x"77",x"EA",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"DD",x"6E",x"E5",x"DD",
+x"66",x"E6",x"E5",x"CD",x"6B",x"51",x"F1",x"F1",x"F1",x"DD",x"75",x"FE",x"7D",x"D6",x"02",x"C2",
+x"D9",x"38",x"DD",x"7E",x"E5",x"C6",x"28",x"DD",x"77",x"F9",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",
+x"77",x"FA",x"21",x"08",x"00",x"39",x"DD",x"75",x"FB",x"DD",x"74",x"FC",x"AF",x"DD",x"77",x"FF",
+x"DD",x"5E",x"FF",x"16",x"00",x"6B",x"62",x"29",x"29",x"29",x"29",x"01",x"BE",x"01",x"09",x"DD",
+x"4E",x"F9",x"DD",x"46",x"FA",x"09",x"4D",x"44",x"EB",x"29",x"29",x"DD",x"7E",x"FB",x"85",x"DD",
+x"77",x"FD",x"DD",x"7E",x"FC",x"8C",x"DD",x"77",x"FE",x"69",x"60",x"11",x"04",x"00",x"19",x"7E",
+x"B7",x"28",x"0D",x"21",x"08",x"00",x"09",x"E5",x"CD",x"43",x"35",x"F1",x"4D",x"44",x"18",x"06",
+x"01",x"00",x"00",x"11",x"00",x"00",x"DD",x"6E",x"FD",x"DD",x"66",x"FE",x"71",x"23",x"70",x"23",
+x"73",x"23",x"72",x"DD",x"34",x"FF",x"DD",x"7E",x"FF",x"D6",x"04",x"38",x"A3",x"AF",x"DD",x"77",
+x"FF",x"DD",x"7E",x"FF",x"DD",x"77",x"FD",x"AF",x"DD",x"77",x"FE",x"DD",x"7E",x"FD",x"DD",x"77",
+x"F9",x"DD",x"7E",x"FE",x"DD",x"77",x"FA",x"3E",x"03",x"18",x"08",x"DD",x"CB",x"F9",x"26",x"DD",
+x"CB",x"FA",x"16",x"3D",x"20",x"F5",x"DD",x"7E",x"FB",x"DD",x"86",x"F9",x"DD",x"77",x"FD",x"DD",
+x"7E",x"FC",x"DD",x"8E",x"FA",x"DD",x"77",x"FE",x"DD",x"5E",x"FD",x"DD",x"56",x"FE",x"21",x"1A",
+x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"DD",x"7E",x"EA",x"DD",x"B6",x"E9",x"DD",x"B6",
+x"E8",x"DD",x"B6",x"E7",x"28",x"1D",x"DD",x"6E",x"E9",x"DD",x"66",x"EA",x"E5",x"DD",x"6E",x"E7",
+x"DD",x"66",x"E8",x"E5",x"DD",x"6E",x"E5",x"DD",x"66",x"E6",x"E5",x"CD",x"6B",x"51",x"F1",x"F1",
+x"F1",x"18",x"03",x"21",x"03",x"00",x"DD",x"75",x"FE",x"7D",x"D6",x"02",x"38",x"0B",x"DD",x"34",
+x"FF",x"DD",x"7E",x"FF",x"D6",x"04",x"DA",x"51",x"38",x"DD",x"7E",x"FE",x"D6",x"04",x"20",x"05",
+x"2E",x"01",x"C3",x"38",x"3E",x"DD",x"7E",x"FE",x"D6",x"02",x"38",x"05",x"2E",x"0D",x"C3",x"38",
+x"3E",x"DD",x"7E",x"E5",x"C6",x"28",x"DD",x"77",x"EB",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",
+x"EC",x"DD",x"5E",x"EB",x"DD",x"56",x"EC",x"DD",x"6E",x"EB",x"DD",x"66",x"EC",x"01",x"0C",x"00",
+x"09",x"46",x"0E",x"00",x"EB",x"11",x"0B",x"00",x"19",x"5E",x"16",x"00",x"79",x"B3",x"4F",x"78",
+x"B2",x"47",x"79",x"B7",x"20",x"05",x"78",x"D6",x"02",x"28",x"05",x"2E",x"0D",x"C3",x"38",x"3E",
+x"DD",x"5E",x"EB",x"DD",x"56",x"EC",x"DD",x"6E",x"EB",x"DD",x"66",x"EC",x"01",x"17",x"00",x"09",
+x"46",x"0E",x"00",x"EB",x"11",x"16",x"00",x"19",x"5E",x"16",x"00",x"79",x"B3",x"4F",x"78",x"B2",
+x"47",x"17",x"9F",x"5F",x"57",x"B3",x"B0",x"B1",x"20",x"13",x"DD",x"7E",x"EB",x"C6",x"24",x"4F",
+x"DD",x"7E",x"EC",x"CE",x"00",x"47",x"C5",x"CD",x"43",x"35",x"F1",x"4D",x"44",x"DD",x"7E",x"E5",
+x"C6",x"10",x"DD",x"77",x"ED",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",x"EE",x"DD",x"6E",x"ED",
+x"DD",x"66",x"EE",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"7E",x"E5",x"C6",x"01",x"DD",
+x"77",x"FE",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",x"FF",x"DD",x"6E",x"EB",x"DD",x"66",x"EC",
+x"C5",x"01",x"10",x"00",x"09",x"C1",x"7E",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"77",x"DD",x"6E",
+x"FE",x"DD",x"66",x"FF",x"6E",x"3D",x"28",x"0A",x"7D",x"D6",x"02",x"28",x"05",x"2E",x"0D",x"C3",
+x"38",x"3E",x"DD",x"75",x"FC",x"AF",x"DD",x"77",x"FD",x"DD",x"77",x"FE",x"DD",x"77",x"FF",x"6F",
+x"67",x"E5",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"E5",x"D5",x"C5",x"CD",x"B3",x"5C",x"F1",x"F1",
+x"F1",x"F1",x"DD",x"75",x"EF",x"DD",x"74",x"F0",x"DD",x"73",x"F1",x"DD",x"72",x"F2",x"DD",x"7E",
+x"E5",x"C6",x"08",x"DD",x"77",x"FA",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",x"FB",x"DD",x"6E",
+x"EB",x"DD",x"66",x"EC",x"11",x"0D",x"00",x"19",x"5E",x"16",x"00",x"DD",x"6E",x"FA",x"DD",x"66",
+x"FB",x"73",x"23",x"72",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"4E",x"23",x"46",x"7A",x"B3",x"28",
+x"0B",x"59",x"50",x"1B",x"79",x"A3",x"4F",x"78",x"A2",x"B1",x"28",x"05",x"2E",x"0D",x"C3",x"38",
+x"3E",x"DD",x"7E",x"E5",x"C6",x"06",x"DD",x"77",x"F3",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",
+x"F4",x"DD",x"5E",x"EB",x"DD",x"56",x"EC",x"DD",x"6E",x"EB",x"DD",x"66",x"EC",x"01",x"12",x"00",
+x"09",x"46",x"0E",x"00",x"EB",x"11",x"11",x"00",x"19",x"5E",x"16",x"00",x"79",x"B3",x"4F",x"78",
+x"B2",x"47",x"DD",x"6E",x"F3",x"DD",x"66",x"F4",x"71",x"23",x"70",x"79",x"E6",x"0F",x"28",x"05",
+x"2E",x"0D",x"C3",x"38",x"3E",x"DD",x"5E",x"EB",x"DD",x"56",x"EC",x"DD",x"6E",x"EB",x"DD",x"66",
+x"EC",x"01",x"14",x"00",x"09",x"46",x"0E",x"00",x"EB",x"11",x"13",x"00",x"19",x"5E",x"16",x"00",
+x"79",x"B3",x"4F",x"78",x"B2",x"47",x"DD",x"71",x"CD",x"78",x"DD",x"77",x"CE",x"17",x"9F",x"DD",
+x"77",x"CF",x"DD",x"77",x"D0",x"DD",x"B6",x"CF",x"DD",x"B6",x"CE",x"DD",x"B6",x"CD",x"20",x"35",
+x"DD",x"7E",x"EB",x"C6",x"20",x"DD",x"77",x"FE",x"DD",x"7E",x"EC",x"CE",x"00",x"DD",x"77",x"FF",
+x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"CD",x"43",x"35",x"F1",x"DD",x"75",x"FC",x"DD",x"74",
+x"FD",x"DD",x"73",x"FE",x"DD",x"72",x"FF",x"21",x"00",x"00",x"39",x"EB",x"21",x"2F",x"00",x"39",
+x"01",x"04",x"00",x"ED",x"B0",x"DD",x"5E",x"EB",x"DD",x"56",x"EC",x"DD",x"6E",x"EB",x"DD",x"66",
+x"EC",x"01",x"0F",x"00",x"09",x"46",x"0E",x"00",x"EB",x"11",x"0E",x"00",x"19",x"5E",x"16",x"00",
+x"79",x"B3",x"5F",x"78",x"B2",x"57",x"4B",x"7A",x"47",x"B3",x"20",x"05",x"2E",x"0D",x"C3",x"38",
+x"3E",x"DD",x"71",x"D1",x"DD",x"70",x"D2",x"AF",x"DD",x"77",x"D3",x"DD",x"77",x"D4",x"DD",x"7E",
+x"D1",x"DD",x"86",x"EF",x"DD",x"77",x"FC",x"DD",x"7E",x"D2",x"DD",x"8E",x"F0",x"DD",x"77",x"FD",
+x"DD",x"7E",x"D3",x"DD",x"8E",x"F1",x"DD",x"77",x"FE",x"DD",x"7E",x"D4",x"DD",x"8E",x"F2",x"DD",
+x"77",x"FF",x"DD",x"6E",x"F3",x"DD",x"66",x"F4",x"5E",x"23",x"56",x"06",x"04",x"CB",x"3A",x"CB",
+x"1B",x"10",x"FA",x"21",x"00",x"00",x"DD",x"7E",x"FC",x"83",x"4F",x"DD",x"7E",x"FD",x"8A",x"47",
+x"DD",x"7E",x"FE",x"8D",x"5F",x"DD",x"7E",x"FF",x"8C",x"57",x"DD",x"71",x"F5",x"DD",x"70",x"F6",
+x"DD",x"73",x"F7",x"DD",x"72",x"F8",x"DD",x"7E",x"CD",x"DD",x"96",x"F5",x"DD",x"7E",x"CE",x"DD",
+x"9E",x"F6",x"DD",x"7E",x"CF",x"DD",x"9E",x"F7",x"DD",x"7E",x"D0",x"DD",x"9E",x"F8",x"30",x"05",
+x"2E",x"0D",x"C3",x"38",x"3E",x"DD",x"7E",x"CD",x"DD",x"96",x"F5",x"DD",x"77",x"FC",x"DD",x"7E",
+x"CE",x"DD",x"9E",x"F6",x"DD",x"77",x"FD",x"DD",x"7E",x"CF",x"DD",x"9E",x"F7",x"DD",x"77",x"FE",
+x"DD",x"7E",x"D0",x"DD",x"9E",x"F8",x"DD",x"77",x"FF",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"4E",
+x"23",x"46",x"11",x"00",x"00",x"D5",x"C5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"DD",x"6E",
+x"FC",x"DD",x"66",x"FD",x"E5",x"CD",x"31",x"5E",x"F1",x"F1",x"F1",x"F1",x"7A",x"B3",x"B4",x"B5",
+x"20",x"05",x"2E",x"0D",x"C3",x"38",x"3E",x"AF",x"DD",x"77",x"F9",x"3E",x"F5",x"BD",x"3E",x"FF",
+x"9C",x"3E",x"FF",x"9B",x"3E",x"0F",x"9A",x"38",x"04",x"DD",x"36",x"F9",x"03",x"3E",x"F5",x"BD",
+x"3E",x"FF",x"9C",x"3E",x"00",x"9B",x"3E",x"00",x"9A",x"38",x"04",x"DD",x"36",x"F9",x"02",x"3E",
+x"F5",x"BD",x"3E",x"0F",x"9C",x"3E",x"00",x"9B",x"3E",x"00",x"9A",x"38",x"04",x"AF",x"DD",x"77",
+x"F9",x"DD",x"7E",x"F9",x"B7",x"20",x"05",x"2E",x"0D",x"C3",x"38",x"3E",x"DD",x"7E",x"E5",x"C6",
+x"0C",x"DD",x"77",x"FA",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",x"FB",x"01",x"02",x"00",x"09",
+x"4D",x"44",x"30",x"01",x"13",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"71",x"23",x"70",x"23",x"73",
+x"23",x"72",x"DD",x"7E",x"E5",x"C6",x"14",x"5F",x"DD",x"7E",x"E6",x"CE",x"00",x"57",x"21",x"1A",
+x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"DD",x"7E",x"E5",x"C6",x"18",x"DD",x"77",x"FC",x"DD",
+x"7E",x"E6",x"CE",x"00",x"DD",x"77",x"FD",x"DD",x"7E",x"D1",x"DD",x"86",x"E7",x"4F",x"DD",x"7E",
+x"D2",x"DD",x"8E",x"E8",x"47",x"DD",x"7E",x"D3",x"DD",x"8E",x"E9",x"5F",x"DD",x"7E",x"D4",x"DD",
+x"8E",x"EA",x"57",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"71",x"23",x"70",x"23",x"73",x"23",x"72",
+x"DD",x"7E",x"E5",x"C6",x"20",x"DD",x"77",x"FE",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",x"FF",
+x"DD",x"7E",x"E7",x"DD",x"86",x"F5",x"4F",x"DD",x"7E",x"E8",x"DD",x"8E",x"F6",x"47",x"DD",x"7E",
+x"E9",x"DD",x"8E",x"F7",x"5F",x"DD",x"7E",x"EA",x"DD",x"8E",x"F8",x"57",x"DD",x"6E",x"FE",x"DD",
+x"66",x"FF",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"7E",x"E5",x"C6",x"1C",x"DD",x"77",
+x"FE",x"DD",x"7E",x"E6",x"CE",x"00",x"DD",x"77",x"FF",x"DD",x"7E",x"F9",x"D6",x"03",x"20",x"75",
+x"DD",x"4E",x"EB",x"DD",x"46",x"EC",x"DD",x"6E",x"EB",x"DD",x"66",x"EC",x"11",x"2B",x"00",x"19",
+x"56",x"1E",x"00",x"69",x"60",x"01",x"2A",x"00",x"09",x"4E",x"06",x"00",x"7B",x"B1",x"4F",x"7A",
+x"B0",x"B1",x"28",x"05",x"2E",x"0D",x"C3",x"38",x"3E",x"DD",x"6E",x"F3",x"DD",x"66",x"F4",x"7E",
+x"23",x"B6",x"28",x"05",x"2E",x"0D",x"C3",x"38",x"3E",x"DD",x"7E",x"EB",x"C6",x"2C",x"4F",x"DD",
+x"7E",x"EC",x"CE",x"00",x"47",x"C5",x"CD",x"43",x"35",x"F1",x"4D",x"44",x"DD",x"6E",x"FE",x"DD",
+x"66",x"FF",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"4E",
+x"23",x"46",x"23",x"5E",x"23",x"56",x"3E",x"02",x"CB",x"21",x"CB",x"10",x"CB",x"13",x"CB",x"12",
+x"3D",x"20",x"F5",x"18",x"53",x"DD",x"6E",x"F3",x"DD",x"66",x"F4",x"7E",x"23",x"B6",x"20",x"05",
+x"2E",x"0D",x"C3",x"38",x"3E",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"4E",x"23",x"46",x"23",x"5E",
+x"23",x"56",x"79",x"DD",x"86",x"EF",x"4F",x"78",x"DD",x"8E",x"F0",x"47",x"7B",x"DD",x"8E",x"F1",
+x"5F",x"7A",x"DD",x"8E",x"F2",x"57",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"71",x"23",x"70",x"23",
+x"73",x"23",x"72",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",
+x"CB",x"21",x"CB",x"10",x"CB",x"13",x"CB",x"12",x"D5",x"C5",x"DD",x"5E",x"ED",x"DD",x"56",x"EE",
+x"21",x"33",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"D1",x"79",x"C6",x"FF",x"6F",
+x"78",x"CE",x"01",x"67",x"30",x"01",x"13",x"06",x"09",x"CB",x"3A",x"CB",x"1B",x"CB",x"1C",x"CB",
+x"1D",x"10",x"F6",x"DD",x"7E",x"FC",x"95",x"DD",x"7E",x"FD",x"9C",x"DD",x"7E",x"FE",x"9B",x"DD",
+x"7E",x"FF",x"9A",x"30",x"04",x"2E",x"0D",x"18",x"3F",x"DD",x"6E",x"E5",x"DD",x"66",x"E6",x"DD",
+x"7E",x"F9",x"77",x"DD",x"7E",x"E5",x"C6",x"04",x"4F",x"DD",x"7E",x"E6",x"CE",x"00",x"47",x"2A",
+x"41",x"72",x"23",x"22",x"41",x"72",x"FD",x"21",x"41",x"72",x"FD",x"7E",x"00",x"02",x"03",x"FD",
+x"7E",x"01",x"02",x"DD",x"7E",x"E5",x"C6",x"0A",x"4F",x"DD",x"7E",x"E6",x"CE",x"00",x"47",x"3E",
+x"43",x"02",x"03",x"3E",x"72",x"02",x"2E",x"00",x"DD",x"F9",x"DD",x"E1",x"C9",x"E1",x"DD",x"E5",
+x"DD",x"21",x"00",x"00",x"DD",x"39",x"E9",x"E5",x"C5",x"D5",x"F5",x"21",x"0A",x"00",x"39",x"F9",
+x"E1",x"D1",x"0E",x"57",x"14",x"15",x"28",x"07",x"AF",x"47",x"ED",x"B2",x"15",x"18",x"F5",x"1C",
+x"1D",x"28",x"03",x"43",x"ED",x"B2",x"21",x"F2",x"FF",x"39",x"F9",x"F1",x"D1",x"C1",x"E1",x"C9",
+x"CD",x"3D",x"3E",x"21",x"DD",x"FF",x"39",x"F9",x"21",x"00",x"00",x"39",x"DD",x"7E",x"04",x"DD",
+x"77",x"DF",x"DD",x"7E",x"05",x"DD",x"77",x"E0",x"E5",x"DD",x"6E",x"DF",x"DD",x"66",x"E0",x"E5",
+x"CD",x"CF",x"34",x"F1",x"F1",x"DD",x"75",x"E1",x"DD",x"7E",x"DF",x"C6",x"0F",x"DD",x"77",x"E2",
+x"DD",x"7E",x"E0",x"CE",x"00",x"DD",x"77",x"E3",x"DD",x"7E",x"E1",x"B7",x"20",x"0A",x"DD",x"6E",
+x"E2",x"DD",x"66",x"E3",x"7E",x"DD",x"77",x"E1",x"DD",x"7E",x"E1",x"B7",x"28",x"06",x"DD",x"6E",
+x"E1",x"C3",x"5D",x"43",x"DD",x"7E",x"DF",x"DD",x"77",x"E4",x"DD",x"7E",x"E0",x"DD",x"77",x"E5",
+x"C1",x"E1",x"E5",x"C5",x"11",x"0A",x"00",x"19",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"79",
+x"DD",x"96",x"06",x"78",x"DD",x"9E",x"07",x"7B",x"DD",x"9E",x"08",x"7A",x"DD",x"9E",x"09",x"30",
+x"0C",x"DD",x"71",x"06",x"DD",x"70",x"07",x"DD",x"73",x"08",x"DD",x"72",x"09",x"DD",x"7E",x"DF",
+x"C6",x"10",x"DD",x"77",x"E6",x"DD",x"7E",x"E0",x"CE",x"00",x"DD",x"77",x"E7",x"DD",x"7E",x"E6",
+x"DD",x"77",x"E8",x"DD",x"7E",x"E7",x"DD",x"77",x"E9",x"DD",x"5E",x"E6",x"DD",x"56",x"E7",x"21",
+x"0D",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"AF",x"DD",x"77",x"EE",x"DD",x"77",x"EF",
+x"DD",x"77",x"F0",x"DD",x"77",x"F1",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"AF",x"77",x"23",x"77",
+x"23",x"77",x"23",x"77",x"DD",x"7E",x"09",x"DD",x"B6",x"08",x"DD",x"B6",x"07",x"DD",x"B6",x"06",
+x"CA",x"B7",x"42",x"E1",x"E5",x"11",x"08",x"00",x"19",x"4E",x"23",x"46",x"1E",x"00",x"DD",x"71",
+x"F3",x"DD",x"70",x"F4",x"DD",x"73",x"F5",x"AF",x"DD",x"77",x"F2",x"DD",x"CB",x"F3",x"26",x"DD",
+x"CB",x"F4",x"16",x"DD",x"CB",x"F5",x"16",x"DD",x"7E",x"DF",x"C6",x"14",x"DD",x"77",x"F6",x"DD",
+x"7E",x"E0",x"CE",x"00",x"DD",x"77",x"F7",x"DD",x"7E",x"ED",x"DD",x"B6",x"EC",x"DD",x"B6",x"EB",
+x"DD",x"B6",x"EA",x"CA",x"97",x"40",x"DD",x"7E",x"06",x"C6",x"FF",x"4F",x"DD",x"7E",x"07",x"CE",
+x"FF",x"47",x"DD",x"7E",x"08",x"CE",x"FF",x"5F",x"DD",x"7E",x"09",x"CE",x"FF",x"57",x"DD",x"6E",
+x"F4",x"DD",x"66",x"F5",x"E5",x"DD",x"6E",x"F2",x"DD",x"66",x"F3",x"E5",x"D5",x"C5",x"CD",x"31",
+x"5E",x"F1",x"F1",x"F1",x"F1",x"DD",x"75",x"F8",x"DD",x"74",x"F9",x"DD",x"73",x"FA",x"DD",x"72",
+x"FB",x"DD",x"7E",x"EA",x"C6",x"FF",x"DD",x"77",x"FC",x"DD",x"7E",x"EB",x"CE",x"FF",x"DD",x"77",
+x"FD",x"DD",x"7E",x"EC",x"CE",x"FF",x"DD",x"77",x"FE",x"DD",x"7E",x"ED",x"CE",x"FF",x"DD",x"77",
+x"FF",x"DD",x"6E",x"F4",x"DD",x"66",x"F5",x"E5",x"DD",x"6E",x"F2",x"DD",x"66",x"F3",x"E5",x"DD",
+x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"E5",x"CD",x"31",x"5E",
+x"F1",x"F1",x"F1",x"F1",x"DD",x"7E",x"F8",x"95",x"DD",x"7E",x"F9",x"9C",x"DD",x"7E",x"FA",x"9B",
+x"DD",x"7E",x"FB",x"9A",x"38",x"71",x"DD",x"7E",x"F2",x"C6",x"FF",x"4F",x"DD",x"7E",x"F3",x"CE",
+x"FF",x"47",x"DD",x"7E",x"F4",x"CE",x"FF",x"5F",x"DD",x"7E",x"F5",x"CE",x"FF",x"2F",x"67",x"79",
+x"2F",x"F5",x"78",x"2F",x"4F",x"7B",x"2F",x"6F",x"F1",x"DD",x"A6",x"FC",x"5F",x"79",x"DD",x"A6",
+x"FD",x"57",x"7D",x"DD",x"A6",x"FE",x"4F",x"7C",x"DD",x"A6",x"FF",x"47",x"DD",x"6E",x"E6",x"DD",
+x"66",x"E7",x"73",x"23",x"72",x"23",x"71",x"23",x"70",x"DD",x"7E",x"06",x"93",x"DD",x"77",x"06",
+x"DD",x"7E",x"07",x"9A",x"DD",x"77",x"07",x"DD",x"7E",x"08",x"99",x"DD",x"77",x"08",x"DD",x"7E",
+x"09",x"98",x"DD",x"77",x"09",x"DD",x"5E",x"F6",x"DD",x"56",x"F7",x"21",x"1F",x"00",x"39",x"EB",
+x"01",x"04",x"00",x"ED",x"B0",x"18",x"2A",x"C1",x"E1",x"E5",x"C5",x"11",x"06",x"00",x"19",x"7E",
+x"DD",x"77",x"FC",x"23",x"7E",x"DD",x"77",x"FD",x"23",x"7E",x"DD",x"77",x"FE",x"23",x"7E",x"DD",
+x"77",x"FF",x"DD",x"5E",x"F6",x"DD",x"56",x"F7",x"21",x"1F",x"00",x"39",x"01",x"04",x"00",x"ED",
+x"B0",x"DD",x"7E",x"FF",x"DD",x"B6",x"FE",x"DD",x"B6",x"FD",x"DD",x"B6",x"FC",x"CA",x"B7",x"42",
+x"DD",x"7E",x"DF",x"DD",x"77",x"FA",x"DD",x"7E",x"E0",x"DD",x"77",x"FB",x"DD",x"7E",x"F2",x"DD",
+x"96",x"06",x"DD",x"7E",x"F3",x"DD",x"9E",x"07",x"DD",x"7E",x"F4",x"DD",x"9E",x"08",x"DD",x"7E",
+x"F5",x"DD",x"9E",x"09",x"D2",x"E6",x"41",x"DD",x"7E",x"06",x"DD",x"96",x"F2",x"DD",x"77",x"06",
+x"DD",x"7E",x"07",x"DD",x"9E",x"F3",x"DD",x"77",x"07",x"DD",x"7E",x"08",x"DD",x"9E",x"F4",x"DD",
+x"77",x"08",x"DD",x"7E",x"09",x"DD",x"9E",x"F5",x"DD",x"77",x"09",x"DD",x"6E",x"E8",x"DD",x"66",
+x"E9",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"79",x"DD",x"86",x"F2",x"4F",x"78",x"DD",x"8E",
+x"F3",x"47",x"7B",x"DD",x"8E",x"F4",x"5F",x"7A",x"DD",x"8E",x"F5",x"57",x"DD",x"6E",x"E8",x"DD",
+x"66",x"E9",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",
+x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"E5",x"DD",x"6E",x"E4",x"DD",x"66",x"E5",x"E5",x"CD",x"EB",
+x"43",x"F1",x"F1",x"F1",x"DD",x"75",x"FC",x"DD",x"74",x"FD",x"DD",x"73",x"FE",x"DD",x"72",x"FF",
+x"DD",x"7E",x"FC",x"DD",x"A6",x"FD",x"DD",x"A6",x"FE",x"DD",x"A6",x"FF",x"3C",x"20",x"0D",x"DD",
+x"6E",x"E2",x"DD",x"66",x"E3",x"36",x"01",x"2E",x"01",x"C3",x"5D",x"43",x"3E",x"01",x"DD",x"BE",
+x"FC",x"3E",x"00",x"DD",x"9E",x"FD",x"3E",x"00",x"DD",x"9E",x"FE",x"3E",x"00",x"DD",x"9E",x"FF",
+x"30",x"1F",x"E1",x"E5",x"11",x"0C",x"00",x"19",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"DD",
+x"7E",x"FC",x"91",x"DD",x"7E",x"FD",x"98",x"DD",x"7E",x"FE",x"9B",x"DD",x"7E",x"FF",x"9A",x"38",
+x"0D",x"DD",x"6E",x"E2",x"DD",x"66",x"E3",x"36",x"02",x"2E",x"02",x"C3",x"5D",x"43",x"DD",x"7E",
+x"FA",x"C6",x"14",x"5F",x"DD",x"7E",x"FB",x"CE",x"00",x"57",x"21",x"1F",x"00",x"39",x"01",x"04",
+x"00",x"ED",x"B0",x"C3",x"DC",x"40",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"4E",x"23",x"46",x"23",
+x"5E",x"23",x"56",x"79",x"DD",x"86",x"06",x"4F",x"78",x"DD",x"8E",x"07",x"47",x"7B",x"DD",x"8E",
+x"08",x"5F",x"7A",x"DD",x"8E",x"09",x"57",x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"71",x"23",x"70",
+x"23",x"73",x"23",x"72",x"DD",x"7E",x"06",x"B7",x"20",x"07",x"DD",x"CB",x"07",x"46",x"CA",x"B7",
+x"42",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"E5",x"DD",
+x"6E",x"DD",x"DD",x"66",x"DE",x"E5",x"CD",x"92",x"36",x"F1",x"F1",x"F1",x"DD",x"75",x"FC",x"DD",
+x"74",x"FD",x"DD",x"73",x"FE",x"DD",x"72",x"FF",x"21",x"1B",x"00",x"39",x"EB",x"21",x"1F",x"00",
+x"39",x"01",x"04",x"00",x"ED",x"B0",x"DD",x"7E",x"FB",x"DD",x"B6",x"FA",x"DD",x"B6",x"F9",x"DD",
+x"B6",x"F8",x"20",x"0D",x"DD",x"6E",x"E2",x"DD",x"66",x"E3",x"36",x"02",x"2E",x"02",x"C3",x"5D",
+x"43",x"DD",x"7E",x"07",x"DD",x"77",x"FC",x"DD",x"7E",x"08",x"DD",x"77",x"FD",x"DD",x"7E",x"09",
+x"DD",x"77",x"FE",x"AF",x"DD",x"77",x"FF",x"DD",x"CB",x"FE",x"3E",x"DD",x"CB",x"FD",x"1E",x"DD",
+x"CB",x"FC",x"1E",x"DD",x"7E",x"FC",x"DD",x"86",x"F8",x"DD",x"77",x"EE",x"DD",x"7E",x"FD",x"DD",
+x"8E",x"F9",x"DD",x"77",x"EF",x"DD",x"7E",x"FE",x"DD",x"8E",x"FA",x"DD",x"77",x"F0",x"DD",x"7E",
+x"FF",x"DD",x"8E",x"FB",x"DD",x"77",x"F1",x"DD",x"5E",x"E6",x"DD",x"56",x"E7",x"21",x"1F",x"00",
+x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"DD",x"7E",x"FC",x"B7",x"20",x"07",x"DD",x"CB",x"FD",
+x"46",x"CA",x"5A",x"43",x"DD",x"7E",x"DF",x"C6",x"18",x"DD",x"77",x"FC",x"DD",x"7E",x"E0",x"CE",
+x"00",x"DD",x"77",x"FD",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"4E",x"23",x"46",x"23",x"5E",x"23",
+x"56",x"DD",x"7E",x"EE",x"91",x"20",x"11",x"DD",x"7E",x"EF",x"90",x"20",x"0B",x"DD",x"6E",x"F0",
+x"DD",x"66",x"F1",x"BF",x"ED",x"52",x"28",x"52",x"DD",x"7E",x"DF",x"C6",x"1C",x"DD",x"77",x"FE",
+x"DD",x"7E",x"E0",x"CE",x"00",x"DD",x"77",x"FF",x"21",x"01",x"00",x"E5",x"DD",x"6E",x"F0",x"DD",
+x"66",x"F1",x"E5",x"DD",x"6E",x"EE",x"DD",x"66",x"EF",x"E5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",
+x"E5",x"CD",x"8B",x"2D",x"F1",x"F1",x"F1",x"F1",x"DD",x"75",x"FF",x"7D",x"B7",x"28",x"0C",x"DD",
+x"6E",x"E2",x"DD",x"66",x"E3",x"36",x"01",x"2E",x"01",x"18",x"12",x"DD",x"5E",x"FC",x"DD",x"56",
+x"FD",x"21",x"11",x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"DD",x"6E",x"E1",x"DD",x"F9",x"DD",
+x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",x"F5",x"DD",x"7E",x"06",x"C6",x"1A",x"5F",x"DD",x"7E",x"07",
+x"CE",x"00",x"57",x"6B",x"62",x"23",x"46",x"0E",x"00",x"1A",x"5F",x"16",x"00",x"79",x"B3",x"4F",
+x"78",x"B2",x"47",x"DD",x"71",x"FC",x"78",x"DD",x"77",x"FD",x"17",x"9F",x"DD",x"77",x"FE",x"DD",
+x"77",x"FF",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"0A",x"D6",x"03",x"20",x"3D",x"DD",x"7E",x"06",
+x"C6",x"14",x"5F",x"DD",x"7E",x"07",x"CE",x"00",x"57",x"6B",x"62",x"23",x"46",x"0E",x"00",x"1A",
+x"5F",x"16",x"00",x"79",x"B3",x"5F",x"78",x"B2",x"57",x"17",x"9F",x"01",x"00",x"00",x"DD",x"7E",
+x"FC",x"B1",x"DD",x"77",x"FC",x"DD",x"7E",x"FD",x"B0",x"DD",x"77",x"FD",x"DD",x"7E",x"FE",x"B3",
+x"DD",x"77",x"FE",x"DD",x"7E",x"FF",x"B2",x"DD",x"77",x"FF",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",
+x"DD",x"5E",x"FE",x"DD",x"56",x"FF",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",x"F5",
+x"F5",x"F5",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"4E",x"23",x"46",x"DD",x"7E",x"06",x"D6",x"02",
+x"DD",x"7E",x"07",x"DE",x"00",x"DD",x"7E",x"08",x"DE",x"00",x"DD",x"7E",x"09",x"DE",x"00",x"38",
+x"21",x"69",x"60",x"11",x"0C",x"00",x"19",x"5E",x"23",x"56",x"23",x"23",x"7E",x"2B",x"6E",x"67",
+x"DD",x"7E",x"06",x"93",x"DD",x"7E",x"07",x"9A",x"DD",x"7E",x"08",x"9D",x"DD",x"7E",x"09",x"9C",
+x"38",x"11",x"DD",x"36",x"F8",x"01",x"AF",x"DD",x"77",x"F9",x"DD",x"77",x"FA",x"DD",x"77",x"FB",
+x"C3",x"6E",x"45",x"DD",x"36",x"F8",x"FF",x"DD",x"36",x"F9",x"FF",x"DD",x"36",x"FA",x"FF",x"DD",
+x"36",x"FB",x"FF",x"0A",x"6F",x"79",x"C6",x"18",x"5F",x"78",x"CE",x"00",x"57",x"7D",x"FE",x"02",
+x"28",x"07",x"D6",x"03",x"28",x"7C",x"C3",x"60",x"45",x"C5",x"21",x"06",x"00",x"39",x"EB",x"01",
+x"04",x"00",x"ED",x"B0",x"C1",x"DD",x"5E",x"07",x"DD",x"56",x"08",x"DD",x"6E",x"09",x"26",x"00",
+x"DD",x"7E",x"FC",x"83",x"5F",x"DD",x"7E",x"FD",x"8A",x"57",x"DD",x"7E",x"FE",x"8D",x"6F",x"DD",
+x"7E",x"FF",x"8C",x"67",x"C5",x"E5",x"D5",x"C5",x"CD",x"CC",x"4C",x"F1",x"F1",x"F1",x"7D",x"C1",
+x"B7",x"C2",x"6E",x"45",x"21",x"28",x"00",x"09",x"EB",x"DD",x"6E",x"06",x"DD",x"66",x"07",x"DD",
+x"4E",x"08",x"DD",x"46",x"09",x"29",x"CB",x"11",x"CB",x"10",x"7C",x"E6",x"01",x"67",x"19",x"EB",
+x"6B",x"62",x"23",x"46",x"0E",x"00",x"1A",x"5F",x"16",x"00",x"79",x"B3",x"4F",x"78",x"B2",x"47",
+x"DD",x"71",x"F8",x"78",x"DD",x"77",x"F9",x"17",x"9F",x"DD",x"77",x"FA",x"DD",x"77",x"FB",x"C3",
+x"6E",x"45",x"C5",x"21",x"06",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"DD",x"5E",
+x"06",x"DD",x"56",x"07",x"DD",x"6E",x"08",x"DD",x"66",x"09",x"3E",x"07",x"CB",x"3C",x"CB",x"1D",
+x"CB",x"1A",x"CB",x"1B",x"3D",x"20",x"F5",x"DD",x"7E",x"FC",x"83",x"5F",x"DD",x"7E",x"FD",x"8A",
+x"57",x"DD",x"7E",x"FE",x"8D",x"6F",x"DD",x"7E",x"FF",x"8C",x"67",x"C5",x"E5",x"D5",x"C5",x"CD",
+x"CC",x"4C",x"F1",x"F1",x"F1",x"7D",x"C1",x"B7",x"20",x"44",x"21",x"28",x"00",x"09",x"EB",x"DD",
+x"6E",x"06",x"DD",x"66",x"07",x"DD",x"4E",x"08",x"DD",x"46",x"09",x"3E",x"02",x"29",x"CB",x"11",
+x"CB",x"10",x"3D",x"20",x"F8",x"7C",x"E6",x"01",x"67",x"19",x"E5",x"CD",x"43",x"35",x"F1",x"DD",
+x"75",x"F8",x"DD",x"74",x"F9",x"DD",x"73",x"FA",x"7A",x"E6",x"0F",x"DD",x"77",x"FB",x"18",x"0E",
+x"DD",x"36",x"F8",x"01",x"AF",x"DD",x"77",x"F9",x"DD",x"77",x"FA",x"DD",x"77",x"FB",x"DD",x"6E",
+x"F8",x"DD",x"66",x"F9",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"DD",x"F9",x"DD",x"E1",x"C9",x"F5",
+x"21",x"00",x"00",x"39",x"FD",x"21",x"04",x"00",x"FD",x"39",x"FD",x"4E",x"00",x"FD",x"46",x"01",
+x"C5",x"E5",x"C5",x"CD",x"CF",x"34",x"F1",x"F1",x"7D",x"C1",x"5F",x"B7",x"20",x"04",x"AF",x"02",
+x"03",x"02",x"6B",x"F1",x"C9",x"F5",x"21",x"00",x"00",x"39",x"FD",x"21",x"04",x"00",x"FD",x"39",
+x"FD",x"4E",x"00",x"FD",x"46",x"01",x"C5",x"E5",x"C5",x"CD",x"CF",x"34",x"F1",x"F1",x"7D",x"C1",
+x"5F",x"B7",x"20",x"04",x"AF",x"02",x"03",x"02",x"6B",x"F1",x"C9",x"D1",x"C1",x"C5",x"D5",x"21",
+x"04",x"00",x"39",x"5E",x"23",x"56",x"0A",x"D3",x"57",x"03",x"1B",x"7A",x"B3",x"20",x"F7",x"C9",
+x"CD",x"3D",x"3E",x"21",x"EC",x"FF",x"39",x"F9",x"DD",x"7E",x"04",x"DD",x"77",x"F0",x"DD",x"7E",
+x"05",x"DD",x"77",x"F1",x"DD",x"7E",x"F0",x"DD",x"77",x"F2",x"DD",x"7E",x"F1",x"DD",x"77",x"F3",
+x"DD",x"6E",x"F0",x"DD",x"66",x"F1",x"7E",x"DD",x"77",x"F4",x"23",x"7E",x"DD",x"77",x"F5",x"DD",
+x"7E",x"08",x"D6",x"20",x"DD",x"7E",x"09",x"DE",x"00",x"30",x"07",x"DD",x"7E",x"06",x"E6",x"1F",
+x"28",x"05",x"2E",x"02",x"C3",x"EF",x"48",x"DD",x"7E",x"F0",x"C6",x"0E",x"5F",x"DD",x"7E",x"F1",
+x"CE",x"00",x"57",x"21",x"1A",x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"DD",x"6E",x"F0",x"DD",
+x"66",x"F1",x"11",x"06",x"00",x"19",x"7E",x"DD",x"77",x"F6",x"23",x"7E",x"DD",x"77",x"F7",x"23",
+x"7E",x"DD",x"77",x"F8",x"23",x"7E",x"DD",x"77",x"F9",x"DD",x"7E",x"F4",x"C6",x"1C",x"DD",x"77",
+x"FE",x"DD",x"7E",x"F5",x"CE",x"00",x"DD",x"77",x"FF",x"DD",x"7E",x"F9",x"DD",x"B6",x"F8",x"DD",
+x"B6",x"F7",x"DD",x"B6",x"F6",x"20",x"1B",x"DD",x"6E",x"F4",x"DD",x"66",x"F5",x"7E",x"D6",x"03",
+x"38",x"10",x"DD",x"5E",x"FE",x"DD",x"56",x"FF",x"21",x"0A",x"00",x"39",x"EB",x"01",x"04",x"00",
+x"ED",x"B0",x"DD",x"7E",x"F0",x"C6",x"16",x"DD",x"77",x"FA",x"DD",x"7E",x"F1",x"CE",x"00",x"DD",
+x"77",x"FB",x"DD",x"7E",x"F9",x"DD",x"B6",x"F8",x"DD",x"B6",x"F7",x"DD",x"B6",x"F6",x"20",x"69",
+x"DD",x"4E",x"06",x"DD",x"46",x"07",x"DD",x"5E",x"08",x"DD",x"56",x"09",x"3E",x"05",x"CB",x"3A",
+x"CB",x"1B",x"CB",x"18",x"CB",x"19",x"3D",x"20",x"F5",x"DD",x"6E",x"F4",x"DD",x"66",x"F5",x"C5",
+x"01",x"06",x"00",x"09",x"C1",x"7E",x"23",x"66",x"DD",x"77",x"EC",x"DD",x"74",x"ED",x"AF",x"DD",
+x"77",x"EE",x"DD",x"77",x"EF",x"79",x"DD",x"96",x"EC",x"78",x"DD",x"9E",x"ED",x"7B",x"DD",x"9E",
+x"EE",x"7A",x"DD",x"9E",x"EF",x"38",x"05",x"2E",x"02",x"C3",x"EF",x"48",x"DD",x"6E",x"FE",x"DD",
+x"66",x"FF",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"71",
+x"23",x"70",x"23",x"73",x"23",x"72",x"C3",x"2C",x"48",x"DD",x"6E",x"F4",x"DD",x"66",x"F5",x"11",
+x"08",x"00",x"19",x"4E",x"23",x"46",x"1E",x"00",x"DD",x"71",x"FD",x"DD",x"70",x"FE",x"DD",x"73",
+x"FF",x"AF",x"DD",x"77",x"FC",x"DD",x"CB",x"FD",x"26",x"DD",x"CB",x"FE",x"16",x"DD",x"CB",x"FF",
+x"16",x"DD",x"4E",x"F4",x"DD",x"46",x"F5",x"DD",x"7E",x"06",x"DD",x"96",x"FC",x"DD",x"7E",x"07",
+x"DD",x"9E",x"FD",x"DD",x"7E",x"08",x"DD",x"9E",x"FE",x"DD",x"7E",x"09",x"DD",x"9E",x"FF",x"DA",
+x"02",x"48",x"C5",x"DD",x"6E",x"F8",x"DD",x"66",x"F9",x"E5",x"DD",x"6E",x"F6",x"DD",x"66",x"F7",
+x"E5",x"DD",x"6E",x"F2",x"DD",x"66",x"F3",x"E5",x"CD",x"EB",x"43",x"F1",x"F1",x"F1",x"C1",x"DD",
+x"75",x"F6",x"DD",x"74",x"F7",x"DD",x"73",x"F8",x"DD",x"72",x"F9",x"DD",x"7E",x"F6",x"DD",x"A6",
+x"F7",x"DD",x"A6",x"F8",x"DD",x"A6",x"F9",x"3C",x"20",x"05",x"2E",x"01",x"C3",x"EF",x"48",x"DD",
+x"7E",x"F6",x"D6",x"02",x"DD",x"7E",x"F7",x"DE",x"00",x"DD",x"7E",x"F8",x"DE",x"00",x"DD",x"7E",
+x"F9",x"DE",x"00",x"38",x"21",x"69",x"60",x"11",x"0C",x"00",x"19",x"5E",x"23",x"56",x"23",x"23",
+x"7E",x"2B",x"6E",x"67",x"DD",x"7E",x"F6",x"93",x"DD",x"7E",x"F7",x"9A",x"DD",x"7E",x"F8",x"9D",
+x"DD",x"7E",x"F9",x"9C",x"38",x"05",x"2E",x"02",x"C3",x"EF",x"48",x"DD",x"7E",x"06",x"DD",x"96",
+x"FC",x"DD",x"77",x"06",x"DD",x"7E",x"07",x"DD",x"9E",x"FD",x"DD",x"77",x"07",x"DD",x"7E",x"08",
+x"DD",x"9E",x"FE",x"DD",x"77",x"08",x"DD",x"7E",x"09",x"DD",x"9E",x"FF",x"DD",x"77",x"09",x"C3",
+x"47",x"47",x"DD",x"6E",x"F8",x"DD",x"66",x"F9",x"E5",x"DD",x"6E",x"F6",x"DD",x"66",x"F7",x"E5",
+x"DD",x"6E",x"F4",x"DD",x"66",x"F5",x"E5",x"CD",x"92",x"36",x"F1",x"F1",x"F1",x"4D",x"44",x"DD",
+x"6E",x"FA",x"DD",x"66",x"FB",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"7E",x"F0",x"C6",
+x"12",x"5F",x"DD",x"7E",x"F1",x"CE",x"00",x"57",x"21",x"0A",x"00",x"39",x"01",x"04",x"00",x"ED",
+x"B0",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"21",x"10",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",
+x"B0",x"DD",x"7E",x"FF",x"DD",x"B6",x"FE",x"DD",x"B6",x"FD",x"DD",x"B6",x"FC",x"20",x"05",x"2E",
+x"02",x"C3",x"EF",x"48",x"DD",x"4E",x"07",x"DD",x"46",x"08",x"DD",x"5E",x"09",x"16",x"00",x"CB",
+x"3B",x"CB",x"18",x"CB",x"19",x"79",x"DD",x"86",x"FC",x"4F",x"78",x"DD",x"8E",x"FD",x"47",x"7B",
+x"DD",x"8E",x"FE",x"5F",x"7A",x"DD",x"8E",x"FF",x"57",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"71",
+x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"7E",x"F0",x"C6",x"1A",x"DD",x"77",x"FE",x"DD",x"7E",
+x"F1",x"CE",x"00",x"DD",x"77",x"FF",x"DD",x"7E",x"F4",x"C6",x"28",x"DD",x"77",x"FC",x"DD",x"7E",
+x"F5",x"CE",x"00",x"DD",x"77",x"FD",x"DD",x"7E",x"06",x"DD",x"77",x"F6",x"DD",x"7E",x"07",x"E6",
+x"01",x"DD",x"77",x"F7",x"DD",x"36",x"F8",x"00",x"DD",x"36",x"F9",x"00",x"DD",x"7E",x"F6",x"DD",
+x"86",x"FC",x"DD",x"77",x"FA",x"DD",x"7E",x"F7",x"DD",x"8E",x"FD",x"DD",x"77",x"FB",x"DD",x"6E",
+x"FE",x"DD",x"66",x"FF",x"DD",x"7E",x"FA",x"77",x"23",x"DD",x"7E",x"FB",x"77",x"2E",x"00",x"DD",
+x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"21",x"F6",x"FF",x"39",x"F9",x"DD",x"7E",x"04",x"DD",
+x"77",x"F6",x"DD",x"7E",x"05",x"DD",x"77",x"F7",x"C1",x"C5",x"E1",x"E5",x"7E",x"DD",x"77",x"F8",
+x"23",x"7E",x"DD",x"77",x"F9",x"DD",x"5E",x"06",x"DD",x"56",x"07",x"1A",x"D6",x"2F",x"20",x"09",
+x"13",x"DD",x"73",x"06",x"DD",x"72",x"07",x"18",x"F2",x"DD",x"73",x"06",x"DD",x"72",x"07",x"21",
+x"06",x"00",x"09",x"AF",x"77",x"23",x"77",x"23",x"77",x"23",x"77",x"DD",x"5E",x"06",x"DD",x"56",
+x"07",x"1A",x"5F",x"17",x"9F",x"57",x"7B",x"D6",x"20",x"7A",x"DE",x"00",x"30",x"19",x"21",x"27",
+x"00",x"09",x"36",x"80",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"C5",x"CD",x"E0",x"45",
+x"F1",x"F1",x"F1",x"5D",x"C3",x"18",x"4A",x"21",x"10",x"00",x"39",x"C5",x"E5",x"C5",x"CD",x"5B",
+x"4D",x"F1",x"F1",x"7D",x"C1",x"5F",x"B7",x"C2",x"18",x"4A",x"C5",x"C5",x"CD",x"7E",x"54",x"F1",
+x"7D",x"C1",x"5F",x"E1",x"E5",x"C5",x"01",x"27",x"00",x"09",x"C1",x"7E",x"E6",x"04",x"57",x"2E",
+x"00",x"7B",x"B7",x"28",x"0E",x"7B",x"D6",x"04",x"C2",x"18",x"4A",x"7D",x"B2",x"20",x"79",x"1E",
+x"05",x"18",x"75",x"7D",x"B2",x"20",x"71",x"E1",x"E5",x"11",x"04",x"00",x"19",x"CB",x"66",x"20",
+x"04",x"1E",x"05",x"18",x"63",x"DD",x"7E",x"F6",x"C6",x"06",x"DD",x"77",x"FA",x"DD",x"7E",x"F7",
+x"CE",x"00",x"DD",x"77",x"FB",x"DD",x"7E",x"F8",x"C6",x"28",x"DD",x"77",x"FE",x"DD",x"7E",x"F9",
+x"CE",x"00",x"DD",x"77",x"FF",x"E1",x"E5",x"11",x"0E",x"00",x"19",x"5E",x"23",x"7E",x"E6",x"01",
+x"57",x"7B",x"DD",x"86",x"FE",x"5F",x"7A",x"DD",x"8E",x"FF",x"57",x"C5",x"D5",x"DD",x"6E",x"F8",
+x"DD",x"66",x"F9",x"E5",x"CD",x"62",x"43",x"F1",x"F1",x"DD",x"75",x"FC",x"DD",x"74",x"FD",x"DD",
+x"73",x"FE",x"DD",x"72",x"FF",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"21",x"08",x"00",x"39",x"01",
+x"04",x"00",x"ED",x"B0",x"C1",x"C3",x"67",x"49",x"6B",x"DD",x"F9",x"DD",x"E1",x"C9",x"F5",x"21",
+x"00",x"00",x"39",x"FD",x"21",x"04",x"00",x"FD",x"39",x"FD",x"4E",x"00",x"FD",x"46",x"01",x"C5",
+x"E5",x"C5",x"CD",x"CF",x"34",x"F1",x"F1",x"C1",x"7D",x"B7",x"20",x"55",x"21",x"07",x"00",x"39",
+x"7E",x"2B",x"B6",x"20",x"11",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"C5",x"CD",x"E0",
+x"45",x"F1",x"F1",x"F1",x"18",x"3B",x"C5",x"21",x"00",x"00",x"E5",x"C5",x"CD",x"54",x"52",x"F1",
+x"F1",x"C1",x"7D",x"D6",x"04",x"20",x"01",x"6F",x"7D",x"B7",x"20",x"25",x"21",x"06",x"00",x"39",
+x"7E",x"23",x"66",x"6F",x"E5",x"C5",x"CD",x"CF",x"4A",x"F1",x"21",x"00",x"00",x"E3",x"21",x"06",
+x"00",x"39",x"4E",x"23",x"46",x"C5",x"CD",x"35",x"58",x"F1",x"F1",x"7D",x"D6",x"04",x"20",x"01",
+x"6F",x"F1",x"C9",x"CD",x"3D",x"3E",x"3B",x"01",x"88",x"13",x"21",x"00",x"00",x"39",x"C5",x"11",
+x"01",x"00",x"D5",x"E5",x"CD",x"47",x"3E",x"F1",x"F1",x"C1",x"DD",x"7E",x"FF",x"3C",x"28",x"0F",
+x"C5",x"3E",x"02",x"F5",x"33",x"CD",x"64",x"16",x"33",x"C1",x"0B",x"78",x"B1",x"20",x"DB",x"78",
+x"B1",x"28",x"05",x"21",x"01",x"00",x"18",x"03",x"21",x"00",x"00",x"33",x"DD",x"E1",x"C9",x"CD",
+x"3D",x"3E",x"21",x"EF",x"FF",x"39",x"F9",x"DD",x"7E",x"04",x"DD",x"77",x"EF",x"DD",x"7E",x"05",
+x"DD",x"77",x"F0",x"E1",x"E5",x"7E",x"DD",x"77",x"FE",x"23",x"7E",x"DD",x"77",x"FF",x"DD",x"7E",
+x"06",x"DD",x"77",x"F1",x"DD",x"7E",x"07",x"DD",x"77",x"F2",x"DD",x"7E",x"F1",x"C6",x"05",x"DD",
+x"77",x"F3",x"DD",x"7E",x"F2",x"CE",x"00",x"DD",x"77",x"F4",x"DD",x"6E",x"F3",x"DD",x"66",x"F4",
+x"36",x"00",x"E1",x"E5",x"11",x"16",x"00",x"19",x"4E",x"23",x"46",x"23",x"7E",x"23",x"B6",x"B0",
+x"B1",x"CA",x"C7",x"4C",x"E1",x"E5",x"11",x"28",x"00",x"19",x"4E",x"23",x"46",x"23",x"5E",x"23",
+x"56",x"DD",x"7E",x"F1",x"C6",x"05",x"DD",x"77",x"F5",x"DD",x"7E",x"F2",x"CE",x"00",x"DD",x"77",
+x"F6",x"79",x"A0",x"A3",x"A2",x"3C",x"CA",x"D5",x"4B",x"AF",x"DD",x"77",x"F7",x"0E",x"00",x"DD",
+x"7E",x"F5",x"DD",x"77",x"F8",x"DD",x"7E",x"F6",x"DD",x"77",x"F9",x"DD",x"7E",x"FE",x"DD",x"77",
+x"FA",x"DD",x"7E",x"FF",x"DD",x"77",x"FB",x"AF",x"DD",x"77",x"FE",x"AF",x"DD",x"77",x"FF",x"DD",
+x"6E",x"FA",x"DD",x"66",x"FB",x"11",x"0A",x"00",x"19",x"5E",x"23",x"56",x"DD",x"6E",x"FE",x"26",
+x"00",x"29",x"19",x"7E",x"DD",x"77",x"FC",x"23",x"7E",x"DD",x"77",x"FD",x"DD",x"B6",x"FC",x"28",
+x"31",x"DD",x"7E",x"FF",x"D6",x"FE",x"38",x"04",x"0E",x"00",x"18",x"26",x"DD",x"34",x"FE",x"DD",
+x"46",x"FC",x"DD",x"5E",x"FF",x"DD",x"34",x"FF",x"DD",x"4E",x"FF",x"DD",x"6E",x"F8",x"DD",x"66",
+x"F9",x"16",x"00",x"19",x"78",x"77",x"B7",x"20",x"03",x"4F",x"18",x"06",x"AF",x"DD",x"77",x"F7",
+x"18",x"AD",x"DD",x"7E",x"F7",x"B7",x"28",x"02",x"0E",x"00",x"DD",x"6E",x"F8",x"DD",x"66",x"F9",
+x"06",x"00",x"09",x"36",x"00",x"0E",x"00",x"DD",x"6E",x"F3",x"DD",x"66",x"F4",x"46",x"DD",x"7E",
+x"EF",x"C6",x"1A",x"5F",x"DD",x"7E",x"F0",x"CE",x"00",x"57",x"78",x"B7",x"C2",x"6B",x"4C",x"DD",
+x"73",x"F9",x"DD",x"72",x"FA",x"DD",x"7E",x"F5",x"DD",x"77",x"FB",x"DD",x"7E",x"F6",x"DD",x"77",
+x"FC",x"DD",x"7E",x"F5",x"DD",x"77",x"FD",x"DD",x"7E",x"F6",x"DD",x"77",x"FE",x"AF",x"DD",x"77",
+x"FF",x"DD",x"7E",x"FF",x"D6",x"0B",x"30",x"48",x"DD",x"6E",x"F9",x"DD",x"66",x"FA",x"46",x"23",
+x"66",x"78",x"DD",x"86",x"FF",x"6F",x"30",x"01",x"24",x"DD",x"34",x"FF",x"46",x"78",x"FE",x"20",
+x"28",x"DF",x"D6",x"05",x"20",x"02",x"06",x"E5",x"DD",x"7E",x"FF",x"D6",x"09",x"20",x"12",x"79",
+x"FE",x"0C",x"30",x"0D",x"0C",x"DD",x"86",x"FB",x"6F",x"3E",x"00",x"DD",x"8E",x"FC",x"67",x"36",
+x"2E",x"79",x"0C",x"DD",x"86",x"FD",x"6F",x"3E",x"00",x"DD",x"8E",x"FE",x"67",x"70",x"18",x"B1",
+x"DD",x"6E",x"FB",x"DD",x"66",x"FC",x"06",x"00",x"09",x"36",x"00",x"DD",x"6E",x"F3",x"DD",x"66",
+x"F4",x"7E",x"B7",x"20",x"1C",x"B1",x"20",x"0E",x"79",x"0C",x"DD",x"86",x"F5",x"6F",x"3E",x"00",
+x"DD",x"8E",x"F6",x"67",x"36",x"3F",x"DD",x"6E",x"F5",x"DD",x"66",x"F6",x"06",x"00",x"09",x"36",
+x"00",x"DD",x"7E",x"F1",x"C6",x"04",x"4F",x"DD",x"7E",x"F2",x"CE",x"00",x"47",x"6B",x"62",x"7E",
+x"23",x"66",x"6F",x"C5",x"01",x"0B",x"00",x"09",x"C1",x"7E",x"02",x"EB",x"4E",x"23",x"46",x"21",
+x"1C",x"00",x"09",x"E5",x"CD",x"43",x"35",x"F1",x"4D",x"44",x"DD",x"6E",x"F1",x"DD",x"66",x"F2",
+x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",
+x"F5",x"3B",x"AF",x"DD",x"77",x"FB",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"21",x"24",x"00",x"09",
+x"EB",x"D5",x"C5",x"21",x"05",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"D1",x"DD",
+x"7E",x"06",x"DD",x"96",x"FC",x"20",x"18",x"DD",x"7E",x"07",x"DD",x"96",x"FD",x"20",x"10",x"DD",
+x"7E",x"08",x"DD",x"96",x"FE",x"20",x"08",x"DD",x"7E",x"09",x"DD",x"96",x"FF",x"28",x"44",x"FD",
+x"21",x"28",x"00",x"FD",x"09",x"D5",x"21",x"01",x"00",x"E5",x"DD",x"6E",x"08",x"DD",x"66",x"09",
+x"E5",x"DD",x"6E",x"06",x"DD",x"66",x"07",x"E5",x"FD",x"E5",x"CD",x"8B",x"2D",x"F1",x"F1",x"F1",
+x"F1",x"7D",x"D1",x"B7",x"28",x"14",x"DD",x"36",x"06",x"FF",x"DD",x"36",x"07",x"FF",x"DD",x"36",
+x"08",x"FF",x"DD",x"36",x"09",x"FF",x"DD",x"36",x"FB",x"01",x"21",x"0B",x"00",x"39",x"01",x"04",
+x"00",x"ED",x"B0",x"DD",x"6E",x"FB",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"21",x"EF",
+x"FF",x"39",x"F9",x"DD",x"7E",x"06",x"DD",x"77",x"EF",x"DD",x"7E",x"07",x"DD",x"77",x"F0",x"E1",
+x"E5",x"7E",x"DD",x"77",x"FC",x"23",x"7E",x"DD",x"77",x"FD",x"DD",x"7E",x"04",x"DD",x"77",x"F1",
+x"DD",x"7E",x"05",x"DD",x"77",x"F2",x"DD",x"6E",x"F1",x"DD",x"66",x"F2",x"4E",x"23",x"66",x"69",
+x"11",x"0A",x"00",x"19",x"7E",x"DD",x"77",x"F3",x"23",x"7E",x"DD",x"77",x"F4",x"AF",x"DD",x"77",
+x"FE",x"AF",x"DD",x"77",x"FF",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"4E",x"DD",x"34",x"FC",x"20",
+x"03",x"DD",x"34",x"FD",x"DD",x"7E",x"FC",x"DD",x"77",x"F5",x"DD",x"7E",x"FD",x"DD",x"77",x"F6",
+x"79",x"DD",x"77",x"F7",x"17",x"9F",x"DD",x"77",x"F8",x"DD",x"7E",x"F7",x"DD",x"77",x"F9",x"DD",
+x"7E",x"F8",x"DD",x"77",x"FA",x"DD",x"7E",x"F9",x"D6",x"20",x"DD",x"7E",x"FA",x"DE",x"00",x"3E",
+x"00",x"17",x"DD",x"77",x"FB",x"B7",x"20",x"37",x"DD",x"7E",x"F9",x"D6",x"2F",x"DD",x"B6",x"FA",
+x"28",x"2D",x"DD",x"7E",x"FF",x"D6",x"7F",x"38",x"05",x"2E",x"06",x"C3",x"5F",x"51",x"DD",x"6E",
+x"FF",x"DD",x"34",x"FF",x"DD",x"7E",x"FF",x"DD",x"77",x"FE",x"26",x"00",x"29",x"DD",x"5E",x"F3",
+x"DD",x"56",x"F4",x"19",x"DD",x"7E",x"F7",x"77",x"23",x"DD",x"7E",x"F8",x"77",x"18",x"86",x"E1",
+x"E5",x"DD",x"7E",x"F5",x"77",x"23",x"DD",x"7E",x"F6",x"77",x"DD",x"7E",x"FB",x"B7",x"28",x"0A",
+x"DD",x"36",x"FC",x"04",x"AF",x"DD",x"77",x"FD",x"18",x"07",x"AF",x"DD",x"77",x"FC",x"DD",x"77",
+x"FD",x"DD",x"7E",x"FC",x"DD",x"77",x"FD",x"DD",x"46",x"FE",x"DD",x"70",x"FE",x"AF",x"DD",x"77",
+x"FF",x"78",x"B7",x"28",x"21",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"2B",x"29",x"DD",x"5E",x"F3",
+x"DD",x"56",x"F4",x"19",x"5E",x"23",x"56",x"7B",x"D6",x"20",x"B2",x"28",x"06",x"7B",x"D6",x"2E",
+x"B2",x"20",x"03",x"05",x"18",x"D4",x"DD",x"70",x"FA",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"29",
+x"DD",x"5E",x"F3",x"DD",x"56",x"F4",x"19",x"AF",x"77",x"23",x"77",x"78",x"B7",x"20",x"05",x"2E",
+x"06",x"C3",x"5F",x"51",x"AF",x"DD",x"77",x"FF",x"DD",x"7E",x"FF",x"DD",x"77",x"FB",x"AF",x"DD",
+x"77",x"FC",x"DD",x"7E",x"FB",x"DD",x"77",x"F8",x"DD",x"7E",x"FC",x"DD",x"77",x"F9",x"DD",x"CB",
+x"F8",x"26",x"DD",x"CB",x"F9",x"16",x"DD",x"7E",x"F3",x"DD",x"86",x"F8",x"DD",x"77",x"FB",x"DD",
+x"7E",x"F4",x"DD",x"8E",x"F9",x"DD",x"77",x"FC",x"DD",x"6E",x"FB",x"DD",x"66",x"FC",x"7E",x"DD",
+x"77",x"FB",x"23",x"7E",x"DD",x"77",x"FC",x"DD",x"7E",x"FB",x"D6",x"20",x"DD",x"B6",x"FC",x"20",
+x"05",x"DD",x"34",x"FF",x"18",x"B2",x"DD",x"7E",x"FF",x"DD",x"77",x"FE",x"DD",x"7E",x"FF",x"B7",
+x"20",x"0A",x"DD",x"7E",x"FB",x"D6",x"2E",x"DD",x"B6",x"FC",x"20",x"08",x"DD",x"7E",x"FD",x"F6",
+x"03",x"DD",x"77",x"FD",x"DD",x"46",x"FA",x"78",x"B7",x"28",x"18",x"68",x"26",x"00",x"2B",x"29",
+x"DD",x"5E",x"F3",x"DD",x"56",x"F4",x"19",x"5E",x"23",x"56",x"7B",x"D6",x"2E",x"B2",x"28",x"03",
+x"05",x"18",x"E4",x"DD",x"70",x"F5",x"DD",x"7E",x"F1",x"C6",x"1C",x"DD",x"77",x"F6",x"DD",x"7E",
+x"F2",x"CE",x"00",x"DD",x"77",x"F7",x"DD",x"4E",x"F6",x"DD",x"46",x"F7",x"21",x"0B",x"00",x"E5",
+x"2E",x"20",x"E5",x"C5",x"CD",x"C2",x"00",x"F1",x"F1",x"F1",x"1E",x"00",x"AF",x"DD",x"77",x"FF",
+x"DD",x"36",x"F8",x"08",x"DD",x"6E",x"FE",x"DD",x"34",x"FE",x"26",x"00",x"29",x"DD",x"4E",x"F3",
+x"DD",x"46",x"F4",x"09",x"46",x"23",x"56",x"7B",x"87",x"87",x"DD",x"77",x"F9",x"7A",x"B0",x"CA",
+x"DD",x"50",x"DD",x"70",x"FA",x"DD",x"72",x"FB",x"DD",x"7E",x"FD",x"F6",x"03",x"4F",x"DD",x"7E",
+x"FA",x"D6",x"20",x"DD",x"B6",x"FB",x"28",x"1E",x"DD",x"7E",x"FE",x"DD",x"96",x"F5",x"3E",x"01",
+x"28",x"01",x"AF",x"DD",x"77",x"FC",x"DD",x"7E",x"FA",x"D6",x"2E",x"DD",x"B6",x"FB",x"20",x"0B",
+x"DD",x"CB",x"FC",x"46",x"20",x"05",x"DD",x"71",x"FD",x"18",x"A9",x"DD",x"7E",x"FF",x"DD",x"96",
+x"F8",x"30",x"06",x"DD",x"7E",x"FC",x"B7",x"28",x"33",x"DD",x"7E",x"F8",x"D6",x"0B",x"20",x"06",
+x"DD",x"71",x"FD",x"C3",x"DD",x"50",x"DD",x"CB",x"FC",x"46",x"20",x"03",x"DD",x"71",x"FD",x"DD",
+x"7E",x"F5",x"DD",x"96",x"FE",x"DA",x"DD",x"50",x"DD",x"7E",x"F5",x"DD",x"77",x"FE",x"DD",x"36",
+x"FF",x"08",x"DD",x"36",x"F8",x"0B",x"DD",x"5E",x"F9",x"C3",x"54",x"4F",x"DD",x"7E",x"FA",x"D6",
+x"80",x"DD",x"7E",x"FB",x"DE",x"00",x"38",x"1A",x"DD",x"7E",x"FD",x"F6",x"02",x"DD",x"77",x"FD",
+x"CB",x"78",x"28",x"0E",x"DD",x"4E",x"FA",x"CB",x"B9",x"06",x"00",x"21",x"F0",x"35",x"09",x"46",
+x"16",x"00",x"DD",x"70",x"FB",x"DD",x"72",x"FC",x"DD",x"7E",x"FD",x"F6",x"03",x"DD",x"77",x"FA",
+x"DD",x"7E",x"FC",x"D6",x"01",x"38",x"4C",x"DD",x"6E",x"F8",x"26",x"00",x"2B",x"DD",x"7E",x"FF",
+x"DD",x"77",x"FB",x"AF",x"DD",x"77",x"FC",x"DD",x"7E",x"FB",x"95",x"DD",x"7E",x"FC",x"9C",x"E2",
+x"44",x"50",x"EE",x"80",x"FA",x"56",x"50",x"DD",x"7E",x"FA",x"DD",x"77",x"FD",x"DD",x"7E",x"F8",
+x"DD",x"77",x"FF",x"C3",x"54",x"4F",x"DD",x"7E",x"FF",x"DD",x"34",x"FF",x"DD",x"86",x"F6",x"6F",
+x"3E",x"00",x"DD",x"8E",x"F7",x"67",x"DD",x"72",x"FB",x"DD",x"36",x"FC",x"00",x"DD",x"7E",x"FB",
+x"77",x"18",x"56",x"7A",x"B0",x"28",x"14",x"68",x"62",x"C5",x"D5",x"E5",x"21",x"64",x"51",x"E5",
+x"CD",x"11",x"58",x"F1",x"F1",x"D1",x"C1",x"7C",x"B5",x"28",x"0A",x"06",x"5F",x"DD",x"7E",x"FA",
+x"DD",x"77",x"FD",x"18",x"34",x"DD",x"7E",x"FB",x"D6",x"41",x"DD",x"7E",x"FC",x"DE",x"00",x"38",
+x"0E",x"3E",x"5A",x"DD",x"BE",x"FB",x"3E",x"00",x"DD",x"9E",x"FC",x"38",x"02",x"CB",x"CB",x"DD",
+x"7E",x"FB",x"D6",x"61",x"DD",x"7E",x"FC",x"DE",x"00",x"38",x"0E",x"3E",x"7A",x"DD",x"BE",x"FB",
+x"3E",x"00",x"DD",x"9E",x"FC",x"38",x"02",x"CB",x"C3",x"DD",x"7E",x"FF",x"DD",x"34",x"FF",x"DD",
+x"86",x"F6",x"6F",x"3E",x"00",x"DD",x"8E",x"F7",x"67",x"70",x"C3",x"54",x"4F",x"DD",x"6E",x"F6",
+x"DD",x"66",x"F7",x"7E",x"D6",x"E5",x"20",x"08",x"DD",x"6E",x"F6",x"DD",x"66",x"F7",x"36",x"05",
+x"DD",x"7E",x"F8",x"D6",x"08",x"20",x"03",x"DD",x"5E",x"F9",x"DD",x"73",x"FE",x"AF",x"DD",x"77",
+x"FF",x"DD",x"7E",x"FE",x"E6",x"0C",x"4F",x"06",x"00",x"79",x"D6",x"0C",x"B0",x"28",x"0E",x"DD",
+x"7E",x"FE",x"E6",x"03",x"4F",x"06",x"00",x"79",x"D6",x"03",x"B0",x"20",x"08",x"DD",x"7E",x"FD",
+x"F6",x"02",x"DD",x"77",x"FD",x"DD",x"CB",x"FD",x"4E",x"20",x"18",x"CB",x"43",x"28",x"08",x"DD",
+x"7E",x"FD",x"F6",x"10",x"DD",x"77",x"FD",x"CB",x"53",x"28",x"08",x"DD",x"7E",x"FD",x"F6",x"08",
+x"DD",x"77",x"FD",x"DD",x"7E",x"F1",x"C6",x"27",x"DD",x"77",x"FE",x"DD",x"7E",x"F2",x"CE",x"00",
+x"DD",x"77",x"FF",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"DD",x"7E",x"FD",x"77",x"2E",x"00",x"DD",
+x"F9",x"DD",x"E1",x"C9",x"2B",x"2C",x"3B",x"3D",x"5B",x"5D",x"00",x"CD",x"3D",x"3E",x"F5",x"F5",
+x"DD",x"4E",x"04",x"DD",x"46",x"05",x"59",x"50",x"13",x"13",x"AF",x"12",x"21",x"24",x"00",x"09",
+x"36",x"FF",x"23",x"36",x"FF",x"23",x"36",x"FF",x"23",x"36",x"FF",x"C5",x"DD",x"6E",x"08",x"DD",
+x"66",x"09",x"E5",x"DD",x"6E",x"06",x"DD",x"66",x"07",x"E5",x"C5",x"CD",x"CC",x"4C",x"F1",x"F1",
+x"F1",x"7D",x"C1",x"B7",x"28",x"05",x"2E",x"04",x"C3",x"2B",x"52",x"33",x"33",x"C5",x"DD",x"71",
+x"FE",x"DD",x"70",x"FF",x"69",x"60",x"11",x"27",x"02",x"19",x"56",x"1E",x"00",x"DD",x"6E",x"FE",
+x"DD",x"66",x"FF",x"C5",x"01",x"26",x"02",x"09",x"C1",x"6E",x"26",x"00",x"7B",x"B5",x"5F",x"7A",
+x"B4",x"57",x"7B",x"D6",x"55",x"20",x"05",x"7A",x"D6",x"AA",x"28",x"04",x"2E",x"03",x"18",x"4B",
+x"E1",x"E5",x"11",x"28",x"00",x"19",x"7E",x"FE",x"E9",x"28",x"08",x"FE",x"EB",x"28",x"04",x"D6",
+x"E8",x"20",x"36",x"21",x"5E",x"00",x"09",x"C5",x"11",x"03",x"00",x"D5",x"11",x"30",x"52",x"D5",
+x"E5",x"CD",x"22",x"5B",x"F1",x"F1",x"F1",x"C1",x"7C",x"B5",x"20",x"03",x"6F",x"18",x"1C",x"21",
+x"7A",x"00",x"09",x"01",x"05",x"00",x"C5",x"01",x"34",x"52",x"C5",x"E5",x"CD",x"22",x"5B",x"F1",
+x"F1",x"F1",x"7C",x"B5",x"20",x"03",x"6F",x"18",x"02",x"2E",x"02",x"DD",x"F9",x"DD",x"E1",x"C9",
+x"46",x"41",x"54",x"00",x"46",x"41",x"54",x"33",x"32",x"00",x"F1",x"C1",x"D1",x"D5",x"C5",x"F5",
+x"AF",x"6F",x"B0",x"06",x"10",x"20",x"04",x"06",x"08",x"79",x"29",x"CB",x"11",x"17",x"30",x"01",
+x"19",x"10",x"F7",x"C9",x"CD",x"3D",x"3E",x"21",x"EE",x"FF",x"39",x"F9",x"DD",x"36",x"F1",x"04",
+x"DD",x"4E",x"04",x"DD",x"46",x"05",x"0A",x"DD",x"77",x"F2",x"03",x"0A",x"DD",x"77",x"F3",x"0B",
+x"DD",x"36",x"F4",x"FF",x"DD",x"36",x"F5",x"FF",x"DD",x"71",x"F6",x"DD",x"70",x"F7",x"DD",x"7E",
+x"F2",x"DD",x"77",x"F8",x"DD",x"7E",x"F3",x"DD",x"77",x"F9",x"21",x"16",x"00",x"09",x"DD",x"75",
+x"FA",x"DD",x"74",x"FB",x"C5",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"21",x"10",x"00",x"39",x"EB",
+x"01",x"04",x"00",x"ED",x"B0",x"C1",x"DD",x"7E",x"FF",x"DD",x"B6",x"FE",x"DD",x"B6",x"FD",x"DD",
+x"B6",x"FC",x"CA",x"2F",x"54",x"C5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"DD",x"6E",x"FC",
+x"DD",x"66",x"FD",x"E5",x"DD",x"6E",x"F2",x"DD",x"66",x"F3",x"E5",x"CD",x"CC",x"4C",x"F1",x"F1",
+x"F1",x"C1",x"DD",x"75",x"F1",x"7D",x"B7",x"C2",x"2F",x"54",x"21",x"1A",x"00",x"09",x"DD",x"75",
+x"FC",x"DD",x"74",x"FD",x"7E",x"23",x"66",x"6F",x"7E",x"DD",x"77",x"FF",x"B7",x"20",x"07",x"DD",
+x"36",x"F1",x"04",x"C3",x"2F",x"54",x"79",x"C6",x"04",x"5F",x"78",x"CE",x"00",x"57",x"C5",x"01",
+x"0B",x"00",x"09",x"C1",x"7E",x"E6",x"3F",x"DD",x"77",x"FE",x"12",x"DD",x"7E",x"FF",x"D6",x"E5",
+x"28",x"25",x"DD",x"7E",x"FF",x"D6",x"2E",x"28",x"1E",x"DD",x"5E",x"FE",x"16",x"00",x"CB",x"AB",
+x"7B",x"D6",x"08",x"B2",x"3E",x"01",x"28",x"01",x"AF",x"5F",x"16",x"00",x"DD",x"6E",x"06",x"DD",
+x"66",x"07",x"BF",x"ED",x"52",x"28",x"07",x"DD",x"36",x"F4",x"FF",x"C3",x"1B",x"54",x"21",x"28",
+x"00",x"09",x"EB",x"DD",x"7E",x"FE",x"D6",x"0F",x"C2",x"ED",x"53",x"DD",x"CB",x"FF",x"76",x"28",
+x"49",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"7E",x"23",x"66",x"6F",x"C5",x"01",x"0D",x"00",x"09",
+x"C1",x"7E",x"DD",x"77",x"F5",x"DD",x"7E",x"FF",x"E6",x"BF",x"DD",x"77",x"FF",x"DD",x"77",x"F4",
+x"DD",x"6E",x"F6",x"DD",x"66",x"F7",x"C5",x"01",x"0E",x"00",x"09",x"C1",x"7E",x"DD",x"77",x"EE",
+x"23",x"7E",x"DD",x"77",x"EF",x"23",x"7E",x"DD",x"77",x"F0",x"23",x"7E",x"DD",x"77",x"F1",x"C5",
+x"21",x"02",x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"C1",x"DD",x"7E",x"F4",x"DD",x"96",x"FF",
+x"20",x"43",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"5E",x"23",x"56",x"6B",x"62",x"C5",x"01",x"0D",
+x"00",x"09",x"C1",x"7E",x"DD",x"77",x"FF",x"DD",x"7E",x"F5",x"DD",x"96",x"FF",x"20",x"26",x"DD",
+x"6E",x"F8",x"DD",x"66",x"F9",x"C5",x"01",x"0A",x"00",x"09",x"C1",x"7E",x"23",x"66",x"6F",x"C5",
+x"D5",x"E5",x"CD",x"E9",x"56",x"F1",x"F1",x"C1",x"7C",x"B5",x"28",x"09",x"DD",x"7E",x"F4",x"3D",
+x"5F",x"17",x"9F",x"18",x"03",x"11",x"FF",x"00",x"DD",x"73",x"F4",x"18",x"2E",x"DD",x"7E",x"F4",
+x"B7",x"20",x"17",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"4E",x"23",x"46",x"D5",x"C5",x"CD",x"4B",
+x"54",x"F1",x"4D",x"D1",x"DD",x"7E",x"F5",x"91",x"28",x"25",x"3E",x"FF",x"12",x"13",x"3E",x"FF",
+x"12",x"13",x"3E",x"FF",x"12",x"13",x"3E",x"FF",x"12",x"18",x"14",x"C5",x"21",x"00",x"00",x"E5",
+x"C5",x"CD",x"35",x"58",x"F1",x"F1",x"C1",x"DD",x"75",x"F1",x"7D",x"B7",x"CA",x"94",x"52",x"DD",
+x"7E",x"F1",x"B7",x"28",x"0E",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"AF",x"77",x"23",x"77",x"23",
+x"77",x"23",x"77",x"DD",x"6E",x"F1",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"3B",x"AF",
+x"DD",x"77",x"FF",x"01",x"0B",x"00",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"DD",x"5E",x"FF",x"CB",
+x"3B",x"DD",x"7E",x"FF",x"0F",x"E6",x"80",x"83",x"5E",x"23",x"83",x"DD",x"77",x"FF",x"59",x"50",
+x"1B",x"4B",x"7A",x"47",x"B3",x"20",x"E5",x"DD",x"6E",x"FF",x"33",x"DD",x"E1",x"C9",x"CD",x"3D",
+x"3E",x"21",x"E5",x"FF",x"39",x"F9",x"DD",x"7E",x"04",x"DD",x"77",x"FE",x"DD",x"7E",x"05",x"DD",
+x"77",x"FF",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"7E",x"DD",x"77",x"E9",x"23",x"7E",x"DD",x"77",
+x"EA",x"21",x"00",x"00",x"E5",x"21",x"00",x"00",x"E5",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",
+x"CD",x"E0",x"45",x"F1",x"F1",x"F1",x"DD",x"75",x"FD",x"7D",x"B7",x"28",x"06",x"DD",x"6E",x"FD",
+x"C3",x"E4",x"56",x"DD",x"36",x"EB",x"FF",x"DD",x"36",x"EC",x"FF",x"DD",x"7E",x"FE",x"DD",x"77",
+x"ED",x"DD",x"7E",x"FF",x"DD",x"77",x"EE",x"DD",x"7E",x"FE",x"C6",x"28",x"DD",x"77",x"EF",x"DD",
+x"7E",x"FF",x"CE",x"00",x"DD",x"77",x"F0",x"DD",x"6E",x"EF",x"DD",x"66",x"F0",x"36",x"FF",x"23",
+x"36",x"FF",x"23",x"36",x"FF",x"23",x"36",x"FF",x"DD",x"7E",x"FE",x"DD",x"77",x"F1",x"DD",x"7E",
+x"FF",x"DD",x"77",x"F2",x"DD",x"7E",x"E9",x"DD",x"77",x"F3",x"DD",x"7E",x"EA",x"DD",x"77",x"F4",
+x"DD",x"7E",x"FE",x"C6",x"1C",x"DD",x"77",x"F5",x"DD",x"7E",x"FF",x"CE",x"00",x"DD",x"77",x"F6",
+x"DD",x"7E",x"FE",x"C6",x"27",x"DD",x"77",x"F7",x"DD",x"7E",x"FF",x"CE",x"00",x"DD",x"77",x"F8",
+x"DD",x"7E",x"F7",x"DD",x"77",x"F9",x"DD",x"7E",x"F8",x"DD",x"77",x"FA",x"DD",x"7E",x"FE",x"DD",
+x"77",x"FB",x"DD",x"7E",x"FF",x"DD",x"77",x"FC",x"DD",x"6E",x"FB",x"DD",x"66",x"FC",x"11",x"16",
+x"00",x"19",x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"D5",x"C5",x"DD",x"6E",x"E9",x"DD",x"66",
+x"EA",x"E5",x"CD",x"CC",x"4C",x"F1",x"F1",x"F1",x"DD",x"75",x"FD",x"7D",x"B7",x"C2",x"E1",x"56",
+x"DD",x"7E",x"ED",x"C6",x"1A",x"4F",x"DD",x"7E",x"EE",x"CE",x"00",x"47",x"69",x"60",x"7E",x"23",
+x"66",x"6F",x"5E",x"7B",x"B7",x"20",x"07",x"DD",x"36",x"FD",x"04",x"C3",x"E1",x"56",x"DD",x"7E",
+x"ED",x"C6",x"04",x"DD",x"77",x"FE",x"DD",x"7E",x"EE",x"CE",x"00",x"DD",x"77",x"FF",x"C5",x"01",
+x"0B",x"00",x"09",x"C1",x"7E",x"E6",x"3F",x"57",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"77",x"7B",
+x"D6",x"E5",x"28",x"10",x"7A",x"D6",x"0F",x"3E",x"01",x"28",x"01",x"AF",x"CB",x"5A",x"28",x"1C",
+x"CB",x"47",x"20",x"18",x"DD",x"36",x"EC",x"FF",x"DD",x"6E",x"EF",x"DD",x"66",x"F0",x"36",x"FF",
+x"23",x"36",x"FF",x"23",x"36",x"FF",x"23",x"36",x"FF",x"C3",x"C9",x"56",x"B7",x"CA",x"76",x"56",
+x"DD",x"6E",x"F9",x"DD",x"66",x"FA",x"CB",x"76",x"C2",x"C9",x"56",x"CB",x"73",x"28",x"47",x"69",
+x"60",x"56",x"23",x"66",x"6A",x"C5",x"01",x"0D",x"00",x"09",x"C1",x"7E",x"DD",x"77",x"EB",x"CB",
+x"B3",x"DD",x"73",x"EC",x"DD",x"6E",x"F1",x"DD",x"66",x"F2",x"C5",x"01",x"0E",x"00",x"09",x"C1",
+x"7E",x"DD",x"77",x"E5",x"23",x"7E",x"DD",x"77",x"E6",x"23",x"7E",x"DD",x"77",x"E7",x"23",x"7E",
+x"DD",x"77",x"E8",x"D5",x"C5",x"DD",x"5E",x"EF",x"DD",x"56",x"F0",x"21",x"04",x"00",x"39",x"01",
+x"04",x"00",x"ED",x"B0",x"C1",x"D1",x"DD",x"7E",x"EC",x"93",x"20",x"32",x"69",x"60",x"5E",x"23",
+x"56",x"6B",x"62",x"01",x"0D",x"00",x"09",x"DD",x"7E",x"EB",x"96",x"20",x"21",x"DD",x"6E",x"F3",
+x"DD",x"66",x"F4",x"01",x"0A",x"00",x"09",x"4E",x"23",x"46",x"D5",x"C5",x"CD",x"71",x"5B",x"F1",
+x"F1",x"7C",x"B5",x"28",x"09",x"DD",x"7E",x"EC",x"3D",x"4F",x"17",x"9F",x"18",x"03",x"01",x"FF",
+x"00",x"DD",x"71",x"EC",x"18",x"53",x"DD",x"7E",x"EC",x"B7",x"20",x"13",x"69",x"60",x"5E",x"23",
+x"56",x"C5",x"D5",x"CD",x"4B",x"54",x"F1",x"5D",x"C1",x"DD",x"7E",x"EB",x"93",x"28",x"52",x"DD",
+x"6E",x"F7",x"DD",x"66",x"F8",x"7E",x"0F",x"38",x"1B",x"DD",x"5E",x"F5",x"DD",x"56",x"F6",x"69",
+x"60",x"4E",x"23",x"46",x"21",x"0B",x"00",x"E5",x"D5",x"C5",x"CD",x"22",x"5B",x"F1",x"F1",x"F1",
+x"7C",x"B5",x"28",x"2D",x"DD",x"36",x"EC",x"FF",x"DD",x"6E",x"EF",x"DD",x"66",x"F0",x"36",x"FF",
+x"23",x"36",x"FF",x"23",x"36",x"FF",x"23",x"36",x"FF",x"21",x"00",x"00",x"E5",x"DD",x"6E",x"ED",
+x"DD",x"66",x"EE",x"E5",x"CD",x"35",x"58",x"F1",x"F1",x"DD",x"75",x"FD",x"7D",x"B7",x"CA",x"48",
+x"55",x"DD",x"6E",x"FD",x"DD",x"F9",x"DD",x"E1",x"C9",x"CD",x"3D",x"3E",x"21",x"F6",x"FF",x"39",
+x"F9",x"DD",x"7E",x"06",x"C6",x"1A",x"5F",x"DD",x"7E",x"07",x"CE",x"00",x"57",x"6B",x"62",x"23",
+x"46",x"0E",x"00",x"1A",x"5F",x"16",x"00",x"79",x"B3",x"4F",x"78",x"B2",x"B1",x"28",x"06",x"21",
+x"00",x"00",x"C3",x"0C",x"58",x"DD",x"7E",x"06",x"DD",x"77",x"F6",x"DD",x"7E",x"07",x"DD",x"77",
+x"F7",x"E1",x"E5",x"4E",x"06",x"00",x"CB",x"B1",x"0B",x"69",x"60",x"29",x"09",x"29",x"29",x"09",
+x"DD",x"75",x"F8",x"DD",x"74",x"F9",x"DD",x"36",x"FA",x"01",x"AF",x"DD",x"77",x"FB",x"DD",x"7E",
+x"F8",x"DD",x"77",x"FE",x"DD",x"7E",x"F9",x"DD",x"77",x"FF",x"01",x"00",x"00",x"79",x"D6",x"0D",
+x"78",x"DE",x"00",x"D2",x"DF",x"57",x"21",x"E3",x"35",x"09",x"7E",x"DD",x"86",x"F6",x"5F",x"3E",
+x"00",x"DD",x"8E",x"F7",x"57",x"6B",x"62",x"23",x"6E",x"DD",x"75",x"FD",x"DD",x"36",x"FC",x"00",
+x"1A",x"5F",x"16",x"00",x"DD",x"7E",x"FC",x"B3",x"5F",x"DD",x"7E",x"FD",x"B2",x"57",x"DD",x"7E",
+x"FB",x"DD",x"B6",x"FA",x"28",x"4B",x"DD",x"7E",x"FE",x"D6",x"7F",x"DD",x"7E",x"FF",x"DE",x"00",
+x"38",x"05",x"21",x"00",x"00",x"18",x"75",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"DD",x"34",x"FE",
+x"20",x"03",x"DD",x"34",x"FF",x"DD",x"7E",x"FE",x"DD",x"77",x"F8",x"DD",x"7E",x"FF",x"DD",x"77",
+x"F9",x"29",x"DD",x"75",x"FC",x"DD",x"74",x"FD",x"DD",x"7E",x"04",x"DD",x"86",x"FC",x"6F",x"DD",
+x"7E",x"05",x"DD",x"8E",x"FD",x"67",x"DD",x"73",x"FA",x"DD",x"72",x"FB",x"73",x"23",x"72",x"18",
+x"0A",x"7B",x"A2",x"3C",x"28",x"05",x"21",x"00",x"00",x"18",x"31",x"03",x"C3",x"4D",x"57",x"E1",
+x"E5",x"CB",x"76",x"28",x"24",x"DD",x"7E",x"F8",x"D6",x"7F",x"DD",x"7E",x"F9",x"DE",x"00",x"38",
+x"05",x"21",x"00",x"00",x"18",x"16",x"D1",x"C1",x"C5",x"D5",x"CB",x"21",x"CB",x"10",x"DD",x"6E",
+x"04",x"DD",x"66",x"05",x"09",x"AF",x"77",x"23",x"77",x"21",x"01",x"00",x"DD",x"F9",x"DD",x"E1",
+x"C9",x"D1",x"C1",x"C5",x"D5",x"0A",x"F5",x"5F",x"17",x"9F",x"57",x"F1",x"B7",x"28",x"14",x"FD",
+x"21",x"04",x"00",x"FD",x"39",x"FD",x"6E",x"00",x"FD",x"66",x"01",x"BF",x"ED",x"52",x"28",x"03",
+x"03",x"18",x"E2",x"EB",x"C9",x"CD",x"3D",x"3E",x"21",x"E6",x"FF",x"39",x"F9",x"DD",x"7E",x"04",
+x"DD",x"77",x"E6",x"DD",x"7E",x"05",x"DD",x"77",x"E7",x"E1",x"E5",x"7E",x"DD",x"77",x"E8",x"23",
+x"7E",x"DD",x"77",x"E9",x"DD",x"7E",x"E6",x"C6",x"0E",x"DD",x"77",x"EA",x"DD",x"7E",x"E7",x"CE",
+x"00",x"DD",x"77",x"EB",x"DD",x"6E",x"EA",x"DD",x"66",x"EB",x"4E",x"23",x"46",x"23",x"5E",x"23",
+x"56",x"79",x"C6",x"20",x"DD",x"77",x"EC",x"78",x"CE",x"00",x"DD",x"77",x"ED",x"7B",x"CE",x"00",
+x"DD",x"77",x"EE",x"7A",x"CE",x"00",x"DD",x"77",x"EF",x"DD",x"7E",x"E6",x"C6",x"16",x"DD",x"77",
+x"F0",x"DD",x"7E",x"E7",x"CE",x"00",x"DD",x"77",x"F1",x"DD",x"7E",x"EE",x"D6",x"20",x"DD",x"7E",
+x"EF",x"DE",x"00",x"38",x"0E",x"DD",x"6E",x"F0",x"DD",x"66",x"F1",x"AF",x"77",x"23",x"77",x"23",
+x"77",x"23",x"77",x"DD",x"5E",x"F0",x"DD",x"56",x"F1",x"21",x"16",x"00",x"39",x"EB",x"01",x"04",
+x"00",x"ED",x"B0",x"DD",x"7E",x"FF",x"DD",x"B6",x"FE",x"DD",x"B6",x"FD",x"DD",x"B6",x"FC",x"20",
+x"05",x"2E",x"04",x"C3",x"1D",x"5B",x"DD",x"7E",x"EC",x"DD",x"77",x"F2",x"DD",x"7E",x"ED",x"E6",
+x"01",x"DD",x"77",x"F3",x"DD",x"36",x"F4",x"00",x"DD",x"36",x"F5",x"00",x"3E",x"00",x"DD",x"B6",
+x"F4",x"DD",x"B6",x"F3",x"DD",x"B6",x"F2",x"C2",x"CB",x"5A",x"DD",x"7E",x"FC",x"C6",x"01",x"4F",
+x"DD",x"7E",x"FD",x"CE",x"00",x"47",x"DD",x"7E",x"FE",x"CE",x"00",x"5F",x"DD",x"7E",x"FF",x"CE",
+x"00",x"57",x"DD",x"6E",x"F0",x"DD",x"66",x"F1",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",
+x"7E",x"E6",x"C6",x"12",x"DD",x"77",x"F6",x"DD",x"7E",x"E7",x"CE",x"00",x"DD",x"77",x"F7",x"DD",
+x"5E",x"F6",x"DD",x"56",x"F7",x"21",x"12",x"00",x"39",x"EB",x"01",x"04",x"00",x"ED",x"B0",x"DD",
+x"7E",x"FB",x"DD",x"B6",x"FA",x"DD",x"B6",x"F9",x"DD",x"B6",x"F8",x"20",x"5B",x"DD",x"4E",x"EC",
+x"DD",x"46",x"ED",x"DD",x"5E",x"EE",x"DD",x"56",x"EF",x"3E",x"05",x"CB",x"3A",x"CB",x"1B",x"CB",
+x"18",x"CB",x"19",x"3D",x"20",x"F5",x"DD",x"6E",x"E8",x"DD",x"66",x"E9",x"C5",x"01",x"06",x"00",
+x"09",x"C1",x"7E",x"23",x"66",x"DD",x"77",x"FC",x"DD",x"74",x"FD",x"AF",x"DD",x"77",x"FE",x"DD",
+x"77",x"FF",x"79",x"DD",x"96",x"FC",x"78",x"DD",x"9E",x"FD",x"7B",x"DD",x"9E",x"FE",x"7A",x"DD",
+x"9E",x"FF",x"DA",x"CB",x"5A",x"DD",x"6E",x"F0",x"DD",x"66",x"F1",x"AF",x"77",x"23",x"77",x"23",
+x"77",x"23",x"77",x"2E",x"04",x"C3",x"1D",x"5B",x"DD",x"4E",x"ED",x"DD",x"46",x"EE",x"DD",x"5E",
+x"EF",x"16",x"00",x"CB",x"3B",x"CB",x"18",x"CB",x"19",x"DD",x"6E",x"E8",x"DD",x"66",x"E9",x"C5",
+x"01",x"09",x"00",x"09",x"C1",x"7E",x"2B",x"6E",x"67",x"2B",x"DD",x"75",x"FC",x"DD",x"74",x"FD",
+x"AF",x"DD",x"77",x"FE",x"DD",x"77",x"FF",x"79",x"DD",x"A6",x"FC",x"F5",x"78",x"DD",x"A6",x"FD",
+x"4F",x"7B",x"DD",x"A6",x"FE",x"6F",x"7A",x"DD",x"A6",x"FF",x"67",x"F1",x"B4",x"B5",x"B1",x"C2",
+x"CB",x"5A",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"E5",x"DD",x"6E",x"F8",x"DD",x"66",x"F9",x"E5",
+x"DD",x"6E",x"E6",x"DD",x"66",x"E7",x"E5",x"CD",x"EB",x"43",x"F1",x"F1",x"F1",x"DD",x"75",x"FC",
+x"DD",x"74",x"FD",x"DD",x"73",x"FE",x"DD",x"72",x"FF",x"3E",x"01",x"DD",x"BE",x"FC",x"3E",x"00",
+x"DD",x"9E",x"FD",x"3E",x"00",x"DD",x"9E",x"FE",x"3E",x"00",x"DD",x"9E",x"FF",x"38",x"05",x"2E",
+x"02",x"C3",x"1D",x"5B",x"DD",x"7E",x"FC",x"DD",x"A6",x"FD",x"DD",x"A6",x"FE",x"DD",x"A6",x"FF",
+x"3C",x"20",x"05",x"2E",x"01",x"C3",x"1D",x"5B",x"C1",x"E1",x"E5",x"C5",x"11",x"0C",x"00",x"19",
+x"4E",x"23",x"46",x"23",x"5E",x"23",x"56",x"DD",x"7E",x"FC",x"91",x"DD",x"7E",x"FD",x"98",x"DD",
+x"7E",x"FE",x"9B",x"DD",x"7E",x"FF",x"9A",x"38",x"29",x"DD",x"7E",x"07",x"DD",x"B6",x"06",x"20",
+x"0E",x"DD",x"6E",x"F0",x"DD",x"66",x"F1",x"AF",x"77",x"23",x"77",x"23",x"77",x"23",x"77",x"DD",
+x"6E",x"F0",x"DD",x"66",x"F1",x"AF",x"77",x"23",x"77",x"23",x"77",x"23",x"77",x"2E",x"04",x"C3",
+x"1D",x"5B",x"DD",x"5E",x"F6",x"DD",x"56",x"F7",x"21",x"16",x"00",x"39",x"01",x"04",x"00",x"ED",
+x"B0",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"E5",x"DD",x"6E",x"FC",x"DD",x"66",x"FD",x"E5",x"DD",
+x"6E",x"E8",x"DD",x"66",x"E9",x"E5",x"CD",x"92",x"36",x"F1",x"F1",x"F1",x"4D",x"44",x"DD",x"6E",
+x"F0",x"DD",x"66",x"F1",x"71",x"23",x"70",x"23",x"73",x"23",x"72",x"DD",x"5E",x"EA",x"DD",x"56",
+x"EB",x"21",x"06",x"00",x"39",x"01",x"04",x"00",x"ED",x"B0",x"DD",x"7E",x"E6",x"C6",x"1A",x"DD",
+x"77",x"FE",x"DD",x"7E",x"E7",x"CE",x"00",x"DD",x"77",x"FF",x"DD",x"7E",x"E8",x"C6",x"28",x"DD",
+x"77",x"FC",x"DD",x"7E",x"E9",x"CE",x"00",x"DD",x"77",x"FD",x"DD",x"7E",x"FC",x"DD",x"86",x"F2",
+x"DD",x"77",x"FA",x"DD",x"7E",x"FD",x"DD",x"8E",x"F3",x"DD",x"77",x"FB",x"DD",x"6E",x"FE",x"DD",
+x"66",x"FF",x"DD",x"7E",x"FA",x"77",x"23",x"DD",x"7E",x"FB",x"77",x"2E",x"00",x"DD",x"F9",x"DD",
+x"E1",x"C9",x"CD",x"3D",x"3E",x"F5",x"F5",x"DD",x"4E",x"04",x"DD",x"46",x"05",x"DD",x"7E",x"06",
+x"DD",x"77",x"FE",x"DD",x"7E",x"07",x"DD",x"77",x"FF",x"DD",x"5E",x"08",x"DD",x"56",x"09",x"0A",
+x"03",x"DD",x"77",x"FC",x"AF",x"DD",x"77",x"FD",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"6E",x"DD",
+x"34",x"FE",x"20",x"03",x"DD",x"34",x"FF",x"26",x"00",x"DD",x"7E",x"FC",x"95",x"6F",x"DD",x"7E",
+x"FD",x"9C",x"67",x"1B",x"7A",x"B3",x"28",x"04",x"7C",x"B5",x"28",x"D3",x"DD",x"F9",x"DD",x"E1",
+x"C9",x"CD",x"3D",x"3E",x"21",x"F5",x"FF",x"39",x"F9",x"DD",x"7E",x"06",x"C6",x"1A",x"5F",x"DD",
+x"7E",x"07",x"CE",x"00",x"57",x"6B",x"62",x"23",x"46",x"0E",x"00",x"1A",x"5F",x"16",x"00",x"79",
+x"B3",x"4F",x"78",x"B2",x"B1",x"28",x"06",x"21",x"00",x"00",x"C3",x"AE",x"5C",x"DD",x"4E",x"06",
+x"DD",x"46",x"07",x"0A",x"DD",x"77",x"F5",x"E6",x"3F",x"5F",x"16",x"00",x"1B",x"6B",x"62",x"29",
+x"19",x"29",x"29",x"19",x"DD",x"75",x"F6",x"DD",x"74",x"F7",x"11",x"01",x"00",x"DD",x"7E",x"F6",
+x"DD",x"77",x"FC",x"DD",x"7E",x"F7",x"DD",x"77",x"FD",x"AF",x"DD",x"77",x"FE",x"DD",x"77",x"FF",
+x"DD",x"7E",x"FE",x"D6",x"0D",x"DD",x"7E",x"FF",x"DE",x"00",x"D2",x"85",x"5C",x"3E",x"E3",x"DD",
+x"86",x"FE",x"6F",x"3E",x"35",x"DD",x"8E",x"FF",x"67",x"7E",x"81",x"DD",x"77",x"F8",x"3E",x"00",
+x"88",x"DD",x"77",x"F9",x"DD",x"6E",x"F8",x"DD",x"66",x"F9",x"23",x"6E",x"DD",x"75",x"FB",x"DD",
+x"36",x"FA",x"00",x"DD",x"6E",x"F8",x"DD",x"66",x"F9",x"6E",x"26",x"00",x"7D",x"DD",x"B6",x"FA",
+x"6F",x"7C",x"DD",x"B6",x"FB",x"67",x"DD",x"75",x"FA",x"DD",x"74",x"FB",x"7A",x"B3",x"28",x"4A",
+x"DD",x"7E",x"FC",x"D6",x"7F",x"DD",x"7E",x"FD",x"DE",x"00",x"30",x"31",x"DD",x"6E",x"FC",x"DD",
+x"66",x"FD",x"DD",x"34",x"FC",x"20",x"03",x"DD",x"34",x"FD",x"DD",x"7E",x"FC",x"DD",x"77",x"F6",
+x"DD",x"7E",x"FD",x"DD",x"77",x"F7",x"29",x"EB",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"19",x"5E",
+x"23",x"56",x"DD",x"6E",x"FA",x"DD",x"66",x"FB",x"BF",x"ED",x"52",x"28",x"05",x"21",x"00",x"00",
+x"18",x"4C",x"DD",x"5E",x"FA",x"DD",x"56",x"FB",x"18",x"0F",x"DD",x"7E",x"FA",x"DD",x"66",x"FB",
+x"A4",x"3C",x"28",x"05",x"21",x"00",x"00",x"18",x"35",x"DD",x"34",x"FE",x"C2",x"D0",x"5B",x"DD",
+x"34",x"FF",x"C3",x"D0",x"5B",x"DD",x"CB",x"F5",x"76",x"28",x"20",x"7A",x"B3",x"28",x"1C",x"DD",
+x"4E",x"F6",x"DD",x"46",x"F7",x"CB",x"21",x"CB",x"10",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"09",
+x"7E",x"23",x"4E",x"B1",x"28",x"05",x"21",x"00",x"00",x"18",x"03",x"21",x"01",x"00",x"DD",x"F9",
+x"DD",x"E1",x"C9",x"DD",x"E5",x"DD",x"21",x"00",x"00",x"DD",x"39",x"21",x"F8",x"FF",x"39",x"F9",
+x"21",x"0C",x"00",x"39",x"EB",x"4B",x"42",x"03",x"03",x"DD",x"71",x"FE",x"DD",x"70",x"FF",x"6B",
+x"62",x"23",x"23",x"4E",x"23",x"46",x"21",x"10",x"00",x"39",x"E3",x"E1",x"E5",x"7E",x"23",x"66",
+x"6F",x"D5",x"E5",x"C5",x"CD",x"3A",x"52",x"F1",x"F1",x"4D",x"44",x"D1",x"DD",x"6E",x"FE",x"DD",
+x"66",x"FF",x"71",x"23",x"70",x"4B",x"42",x"03",x"03",x"DD",x"71",x"FC",x"DD",x"70",x"FD",x"6B",
+x"62",x"23",x"23",x"7E",x"DD",x"77",x"FE",x"23",x"7E",x"DD",x"77",x"FF",x"E1",x"E5",x"23",x"23",
+x"4E",x"23",x"46",x"6B",x"62",x"7E",x"23",x"66",x"6F",x"D5",x"E5",x"C5",x"CD",x"3A",x"52",x"F1",
+x"F1",x"D1",x"DD",x"7E",x"FE",x"85",x"4F",x"DD",x"7E",x"FF",x"8C",x"47",x"DD",x"6E",x"FC",x"DD",
+x"66",x"FD",x"71",x"23",x"70",x"4B",x"42",x"03",x"03",x"DD",x"71",x"FD",x"DD",x"70",x"FE",x"6B",
+x"62",x"23",x"23",x"4E",x"23",x"46",x"6B",x"62",x"23",x"7E",x"DD",x"77",x"FF",x"E1",x"E5",x"23",
+x"66",x"D5",x"C5",x"DD",x"5E",x"FF",x"2E",x"00",x"55",x"06",x"08",x"29",x"30",x"01",x"19",x"10",
+x"FA",x"C1",x"D1",x"09",x"4D",x"44",x"DD",x"6E",x"FD",x"DD",x"66",x"FE",x"71",x"23",x"70",x"E1",
+x"E5",x"4E",x"6B",x"62",x"23",x"66",x"D5",x"59",x"2E",x"00",x"55",x"06",x"08",x"29",x"30",x"01",
+x"19",x"10",x"FA",x"D1",x"DD",x"75",x"FA",x"DD",x"74",x"FB",x"C1",x"C5",x"03",x"DD",x"71",x"FE",
+x"DD",x"70",x"FF",x"6B",x"62",x"4E",x"E1",x"E5",x"23",x"66",x"D5",x"59",x"2E",x"00",x"55",x"06",
+x"08",x"29",x"30",x"01",x"19",x"10",x"FA",x"D1",x"4D",x"44",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",
+x"71",x"23",x"70",x"C1",x"C5",x"03",x"03",x"03",x"DD",x"71",x"FC",x"DD",x"70",x"FD",x"C1",x"C5",
+x"03",x"DD",x"71",x"FE",x"DD",x"70",x"FF",x"E1",x"E5",x"23",x"4E",x"23",x"46",x"79",x"DD",x"86",
+x"FA",x"4F",x"78",x"DD",x"8E",x"FB",x"47",x"DD",x"6E",x"FE",x"DD",x"66",x"FF",x"71",x"23",x"70",
+x"79",x"DD",x"96",x"FA",x"78",x"DD",x"9E",x"FB",x"3E",x"00",x"17",x"DD",x"6E",x"FC",x"DD",x"66",
+x"FD",x"77",x"4B",x"42",x"1A",x"5F",x"E1",x"E5",x"66",x"C5",x"2E",x"00",x"55",x"06",x"08",x"29",
+x"30",x"01",x"19",x"10",x"FA",x"C1",x"EB",x"7B",x"02",x"03",x"7A",x"02",x"C1",x"C5",x"AF",x"02",
+x"DD",x"7E",x"04",x"DD",x"86",x"08",x"6F",x"DD",x"7E",x"05",x"DD",x"8E",x"09",x"67",x"DD",x"7E",
+x"06",x"DD",x"8E",x"0A",x"5F",x"DD",x"7E",x"07",x"DD",x"8E",x"0B",x"57",x"DD",x"F9",x"DD",x"E1",
+x"C9",x"DD",x"E5",x"DD",x"21",x"00",x"00",x"DD",x"39",x"3B",x"01",x"00",x"00",x"11",x"00",x"00",
+x"DD",x"36",x"FF",x"20",x"DD",x"7E",x"07",x"CB",x"07",x"E6",x"01",x"6F",x"DD",x"CB",x"04",x"26",
+x"DD",x"CB",x"05",x"16",x"DD",x"CB",x"06",x"16",x"DD",x"CB",x"07",x"16",x"CB",x"21",x"CB",x"10",
+x"CB",x"13",x"CB",x"12",x"CB",x"45",x"28",x"02",x"CB",x"C1",x"79",x"DD",x"96",x"08",x"78",x"DD",
+x"9E",x"09",x"7B",x"DD",x"9E",x"0A",x"7A",x"DD",x"9E",x"0B",x"38",x"2E",x"79",x"DD",x"96",x"08",
+x"4F",x"78",x"DD",x"9E",x"09",x"47",x"7B",x"DD",x"9E",x"0A",x"5F",x"7A",x"DD",x"9E",x"0B",x"57",
+x"DD",x"7E",x"04",x"F6",x"01",x"DD",x"77",x"04",x"DD",x"7E",x"05",x"DD",x"77",x"05",x"DD",x"7E",
+x"06",x"DD",x"77",x"06",x"DD",x"7E",x"07",x"DD",x"77",x"07",x"DD",x"35",x"FF",x"DD",x"7E",x"FF",
+x"B7",x"20",x"91",x"DD",x"6E",x"04",x"DD",x"66",x"05",x"DD",x"5E",x"06",x"DD",x"56",x"07",x"33",
+x"DD",x"E1",x"C9",x"00",x"20",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"00",x"83",x"16",x"A3",
+x"16",x"93",x"16",x"00",x"00",x"00",x"00",x"01",x"01",x"15",x"00",x"78",x"B1",x"CA",x"15",x"0B",
+x"11",x"44",x"73",x"21",x"C3",x"5E",x"ED",x"B0",x"FD",x"21",x"C1",x"66",x"FD",x"36",x"00",x"FF",
+x"FD",x"21",x"C2",x"66",x"FD",x"36",x"00",x"00",x"C9",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
+x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",x"FF",
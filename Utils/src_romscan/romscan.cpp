@@ -0,0 +1,443 @@
+/**
+ * romscan: check a ROM collection before it goes on a Phoenix SD card.
+ *
+ * Every file under the given folders is read by a pool of worker threads,
+ * hashed (CRC-32 and SHA-1) and run through the same tests the menu does
+ * when a title is started (menu.c, the file type checks in main() and
+ * loadCartridgeRom() / loadMegacartRom()):
+ *
+ *   - the first 512 bytes must read, AA55 or 55AA at 0 is a 32K cart
+ *     that must not be over 32K
+ *   - otherwise the 512 bytes at (16K pages - 1) * 16K must read, and
+ *     AA55 or 55AA there is a megacart
+ *   - megacarts must be 32K, 64K, 128K or 256K, or 512K where the first
+ *     32K is skipped (480K passes the same way)
+ *
+ * CORE*.PHX, *.BIO and MULTCART.ROM are the loader's files, not titles.
+ * They are hashed and listed as system files, the way mksdimg keeps them
+ * apart, and are not counted as bad or as duplicates.
+ *
+ * Folders with more than the 254 entries the menu lists (counting the ".."
+ * of a subfolder) are reported, as are names over 126 characters and paths
+ * over 512. Files with the same SHA-1 are listed as duplicates.
+ *
+ * Directory walking is done up front on the main thread, the workers then
+ * take files from a shared index and only ever read, so there is no
+ * locking besides that index. The report is sorted by path, the same for
+ * any thread count.
+ *
+ * Unix/MinGW:
+ * g++ -std=c++11 -Wall -O2 -pthread -o romscan romscan.cpp
+ */
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+namespace {
+
+const unsigned MENU_MAX_FILES = 254;
+const size_t MENU_MAX_NAME    = 126;
+const size_t MENU_MAX_PATH    = 512;
+const uint64_t PAGE           = 16384;
+const size_t BLOCK            = 512;
+const size_t READ_SIZE        = 256 * 1024;
+
+// what the menu would do with the file
+enum Kind {
+    CART,           // 32K or smaller cartridge
+    MEGACART,
+    SYSTEM,         // loader file: CORE*.PHX, *.BIO, MULTCART.ROM
+    NO_HEADER,      // "Unrecognized file type."
+    SHORT_FILE,     // first or last 512 bytes don't read
+    CART_TOO_BIG,   // "Unrecognized >32k Cart"
+    MEGA_PAD,       // "Megacart images must be padded"
+    MEGA_TOO_BIG,   // "Megacart ROM too large"
+    READ_ERROR,
+};
+
+const char *kindText[] = {
+    "cart",
+    "megacart",
+    "system file",
+    "unrecognized file type",
+    "too short to identify",
+    "cart with AA55 at 0 is over 32K",
+    "megacart must be padded to 32K/64K/128K/256K/512K",
+    "megacart is over 512K",
+    "cannot read",
+};
+
+struct Entry {
+    std::string path;
+    uint64_t size;
+    Kind kind;
+    uint32_t crc;
+    uint8_t sha[20];
+};
+
+// ---- CRC-32 (zlib), four bytes per step ----
+
+uint32_t crcTable[4][256];
+
+void crcInit()
+{
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c & 1) ? (c >> 1) ^ 0xEDB88320 : c >> 1;
+        crcTable[0][i] = c;
+    }
+    for (uint32_t i = 0; i < 256; i++)
+        for (int t = 1; t < 4; t++)
+            crcTable[t][i] = crcTable[0][crcTable[t - 1][i] & 0xFF] ^ (crcTable[t - 1][i] >> 8);
+}
+
+uint32_t crcUpdate(uint32_t crc, const uint8_t *p, size_t n)
+{
+    crc = ~crc;
+    for (; n >= 4; p += 4, n -= 4) {
+        crc ^= p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+        crc = crcTable[3][crc & 0xFF] ^ crcTable[2][(crc >> 8) & 0xFF] ^
+              crcTable[1][(crc >> 16) & 0xFF] ^ crcTable[0][crc >> 24];
+    }
+    while (n--) crc = crcTable[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+// ---- SHA-1 ----
+
+struct Sha1 {
+    uint32_t h[5];
+    uint8_t buf[64];
+    size_t used;
+    uint64_t total;
+
+    Sha1() : used(0), total(0)
+    {
+        h[0] = 0x67452301; h[1] = 0xEFCDAB89; h[2] = 0x98BADCFE; h[3] = 0x10325476; h[4] = 0xC3D2E1F0;
+    }
+
+    static uint32_t rol(uint32_t v, int n) { return (v << n) | (v >> (32 - n)); }
+
+    void block(const uint8_t *p)
+    {
+        uint32_t w[80];
+        for (int i = 0; i < 16; i++)
+            w[i] = (uint32_t)p[i * 4] << 24 | p[i * 4 + 1] << 16 | p[i * 4 + 2] << 8 | p[i * 4 + 3];
+        for (int i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+        // one loop per round function, no branches in the inner loops
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], t;
+        for (int i = 0; i < 20; i++) {
+            t = rol(a, 5) + ((b & c) | (~b & d)) + e + 0x5A827999 + w[i];
+            e = d; d = c; c = rol(b, 30); b = a; a = t;
+        }
+        for (int i = 20; i < 40; i++) {
+            t = rol(a, 5) + (b ^ c ^ d) + e + 0x6ED9EBA1 + w[i];
+            e = d; d = c; c = rol(b, 30); b = a; a = t;
+        }
+        for (int i = 40; i < 60; i++) {
+            t = rol(a, 5) + ((b & c) | (d & (b | c))) + e + 0x8F1BBCDC + w[i];
+            e = d; d = c; c = rol(b, 30); b = a; a = t;
+        }
+        for (int i = 60; i < 80; i++) {
+            t = rol(a, 5) + (b ^ c ^ d) + e + 0xCA62C1D6 + w[i];
+            e = d; d = c; c = rol(b, 30); b = a; a = t;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+    }
+
+    void update(const uint8_t *p, size_t n)
+    {
+        total += n;
+        if (used) {
+            size_t k = std::min(n, 64 - used);
+            memcpy(buf + used, p, k);
+            used += k; p += k; n -= k;
+            if (used < 64) return;
+            block(buf);
+            used = 0;
+        }
+        for (; n >= 64; p += 64, n -= 64) block(p);
+        memcpy(buf, p, n);
+        used = n;
+    }
+
+    void final(uint8_t out[20])
+    {
+        uint64_t bits = total * 8;
+        uint8_t pad = 0x80, zero = 0, len[8];
+        update(&pad, 1);
+        while (used != 56) update(&zero, 1);
+        for (int i = 0; i < 8; i++) len[i] = bits >> (56 - i * 8);
+        update(len, 8);
+        for (int i = 0; i < 20; i++) out[i] = h[i / 4] >> (24 - (i % 4) * 8);
+    }
+};
+
+// ---- classification ----
+
+bool isHeader(const uint8_t *p)
+{
+    return (p[0] == 0xAA && p[1] == 0x55) || (p[0] == 0x55 && p[1] == 0xAA);
+}
+
+// Same names as is_system() in mksdimg.
+bool isSystem(const std::string &name)
+{
+    std::string n;
+    for (size_t i = 0; i < name.size(); i++) n += toupper((unsigned char)name[i]);
+
+    size_t dot = n.rfind('.');
+    if (dot == std::string::npos) return false;
+    std::string ext = n.substr(dot);
+    return n == "MULTCART.ROM" || ext == ".PHX" || ext == ".BIO";
+}
+
+// Hash the file and keep the two 512 byte blocks the menu looks at.
+void scanFile(Entry &e, std::vector<uint8_t> &buf)
+{
+    FILE *f = fopen(e.path.c_str(), "rb");
+    if (!f) {
+        e.kind = READ_ERROR;
+        return;
+    }
+
+    uint64_t pages = (e.size + PAGE - 1) / PAGE;
+    uint64_t last = pages ? (pages - 1) * PAGE : 0;
+    uint8_t first[BLOCK], tail[BLOCK];
+    size_t firstLen = 0, tailLen = 0;
+    uint64_t pos = 0;
+    Sha1 sha;
+    e.crc = 0;
+
+    for (;;) {
+        size_t n = fread(&buf[0], 1, buf.size(), f);
+        if (n == 0) break;
+
+        if (pos < BLOCK) {
+            size_t k = std::min<uint64_t>(n, BLOCK - pos);
+            memcpy(first + pos, &buf[0], k);
+            firstLen = pos + k;
+        }
+        uint64_t want = last + tailLen;     // next tail byte
+        if (tailLen < BLOCK && want >= pos && want < pos + n) {
+            size_t k = std::min<uint64_t>(pos + n - want, BLOCK - tailLen);
+            memcpy(tail + tailLen, &buf[want - pos], k);
+            tailLen += k;
+        }
+
+        e.crc = crcUpdate(e.crc, &buf[0], n);
+        sha.update(&buf[0], n);
+        pos += n;
+    }
+    bool err = ferror(f) != 0;
+    fclose(f);
+    sha.final(e.sha);
+
+    if (err || pos != e.size) {
+        e.kind = READ_ERROR;
+    } else if (e.kind == SYSTEM) {
+        // hashed only
+    } else if (firstLen < BLOCK) {
+        e.kind = SHORT_FILE;
+    } else if (isHeader(first)) {
+        e.kind = e.size > 2 * PAGE ? CART_TOO_BIG : CART;
+    } else if (tailLen < BLOCK) {
+        e.kind = SHORT_FILE;
+    } else if (!isHeader(tail)) {
+        e.kind = NO_HEADER;
+    } else if (pages > 32) {
+        e.kind = MEGA_TOO_BIG;
+    } else if (pages == 2 || pages == 4 || pages == 8 || pages == 16 || pages == 30 || pages == 32) {
+        e.kind = MEGACART;
+    } else {
+        e.kind = MEGA_PAD;
+    }
+}
+
+// ---- directory walk ----
+
+struct Folder {
+    std::string path;
+    unsigned entries;   // as the menu counts them
+};
+
+int warnings;
+
+void walk(const std::string &path, bool top, std::vector<Entry> &files, std::vector<Folder> &folders)
+{
+    DIR *d = opendir(path.c_str());
+    if (!d) {
+        fprintf(stderr, "Error: cannot open %s\n", path.c_str());
+        warnings++;
+        return;
+    }
+
+    Folder folder = { path, top ? 0u : 1u };
+    std::vector<std::string> subs;
+
+    while (struct dirent *de = readdir(d)) {
+        if (de->d_name[0] == '.') continue;    // hidden by the menu
+        std::string name = de->d_name;
+        std::string sub = path + "/" + name;
+
+        struct stat st;
+        if (stat(sub.c_str(), &st) != 0) continue;
+        folder.entries++;
+
+        if (name.size() > MENU_MAX_NAME) {
+            printf("%s: name is over %u characters, the menu cuts it short\n", sub.c_str(), (unsigned)MENU_MAX_NAME);
+            warnings++;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            subs.push_back(sub);
+        } else {
+            Entry e;
+            e.path = sub;
+            e.size = st.st_size;
+            e.kind = isSystem(name) ? SYSTEM : READ_ERROR;
+            files.push_back(e);
+        }
+    }
+    closedir(d);
+
+    folders.push_back(folder);
+    for (size_t i = 0; i < subs.size(); i++) walk(subs[i], false, files, folders);
+}
+
+std::string hex(const uint8_t *p, size_t n)
+{
+    static const char h[] = "0123456789abcdef";
+    std::string s;
+    for (size_t i = 0; i < n; i++) {
+        s += h[p[i] >> 4];
+        s += h[p[i] & 15];
+    }
+    return s;
+}
+
+void usage()
+{
+    printf(
+    "romscan, version 1.0\n\n"
+    "Check a Phoenix ROM collection the way the menu will see it.\n\n"
+    "Use: romscan [-v] [-j threads] <folder> [folder ...]\n\n"
+    "  -v  list every file with its type, CRC-32 and SHA-1\n"
+    "  -j  number of worker threads, default one per CPU\n"
+    "\n"
+    );
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool verbose = false;
+    unsigned threads = std::thread::hardware_concurrency();
+    int a = 1;
+
+    for (; a < argc && argv[a][0] == '-'; a++) {
+        if (!strcmp(argv[a], "-v")) {
+            verbose = true;
+        } else if (!strcmp(argv[a], "-j") && a + 1 < argc) {
+            threads = atoi(argv[++a]);
+        } else {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (a == argc) {
+        usage();
+        return EXIT_FAILURE;
+    }
+    if (threads < 1) threads = 1;
+
+    crcInit();
+
+    std::vector<Entry> files;
+    std::vector<Folder> folders;
+    for (; a < argc; a++) {
+        std::string root = argv[a];
+        while (root.size() > 1 && (root[root.size() - 1] == '/' || root[root.size() - 1] == '\\'))
+            root.erase(root.size() - 1);
+        walk(root, true, files, folders);
+    }
+
+    // hash and classify, biggest files first to even out the threads
+    std::vector<size_t> order(files.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t x, size_t y) { return files[x].size > files[y].size; });
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < std::min<size_t>(threads, files.size()); t++) {
+        pool.push_back(std::thread([&]() {
+            std::vector<uint8_t> buf(READ_SIZE);
+            for (size_t i; (i = next++) < order.size(); ) scanFile(files[order[i]], buf);
+        }));
+    }
+    for (size_t t = 0; t < pool.size(); t++) pool[t].join();
+
+    std::sort(files.begin(), files.end(), [](const Entry &x, const Entry &y) { return x.path < y.path; });
+
+    // report
+    unsigned count[READ_ERROR + 1] = { 0 };
+    for (size_t i = 0; i < files.size(); i++) {
+        const Entry &e = files[i];
+        count[e.kind]++;
+        if (verbose) {
+            printf("%08x %s %8lu %-8s %s\n", (unsigned)e.crc, hex(e.sha, 20).c_str(),
+                (unsigned long)e.size, e.kind == CART ? "cart" : e.kind == MEGACART ? "megacart" : e.kind == SYSTEM ? "system" : "BAD",
+                e.path.c_str());
+        }
+        if (e.kind != CART && e.kind != MEGACART && e.kind != SYSTEM) {
+            printf("%s: %s\n", e.path.c_str(), kindText[e.kind]);
+        }
+        if (e.path.size() > MENU_MAX_PATH) {
+            printf("%s: path is over %u characters\n", e.path.c_str(), (unsigned)MENU_MAX_PATH);
+            warnings++;
+        }
+    }
+
+    std::sort(folders.begin(), folders.end(), [](const Folder &x, const Folder &y) { return x.path < y.path; });
+    for (size_t i = 0; i < folders.size(); i++) {
+        if (folders[i].entries > MENU_MAX_FILES) {
+            printf("%s: %u entries, the menu lists only %u\n", folders[i].path.c_str(),
+                folders[i].entries, MENU_MAX_FILES);
+            warnings++;
+        }
+    }
+
+    // duplicates, by SHA-1
+    std::map<std::string, std::vector<size_t> > bySha;
+    for (size_t i = 0; i < files.size(); i++)
+        if (files[i].kind != READ_ERROR && files[i].kind != SYSTEM) bySha[hex(files[i].sha, 20)].push_back(i);
+
+    unsigned dupSets = 0, dupFiles = 0;
+    for (std::map<std::string, std::vector<size_t> >::const_iterator it = bySha.begin(); it != bySha.end(); ++it) {
+        const std::vector<size_t> &v = it->second;
+        if (v.size() < 2) continue;
+        dupSets++;
+        dupFiles += v.size() - 1;
+        printf("duplicate %s (CRC %08x):\n", it->first.c_str(), (unsigned)files[v[0]].crc);
+        for (size_t k = 0; k < v.size(); k++) printf("    %s\n", files[v[k]].path.c_str());
+    }
+
+    unsigned bad = files.size() - count[CART] - count[MEGACART] - count[SYSTEM];
+    printf("\n%u files in %u folders: %u carts, %u megacarts, %u system, %u bad, %u duplicates in %u sets, %d warnings\n",
+        (unsigned)files.size(), (unsigned)folders.size(), count[CART], count[MEGACART], count[SYSTEM], bad,
+        dupFiles, dupSets, warnings);
+
+    return bad || warnings ? EXIT_FAILURE : EXIT_SUCCESS;
+}
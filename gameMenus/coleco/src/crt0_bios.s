@@ -14,7 +14,7 @@
 	.org 0x0000
 
 ; Boot starts here
-    ld sp,#0x8000           ; set stack (unnecessarily)
+    ld sp,#0x7ff8           ; set stack (unnecessarily), below the warm start block
     jp start                ; and jump to the startup code
     .db 0xff, 0xff          ; padding
 
@@ -66,15 +66,21 @@ start:
 	ld hl,#_vdpLimi
 	ld (hl),#0
 	
-	; clear RAM before starting
+	; clear RAM before starting, except the SD-card warm start block
+	; at 7FF8-7FFF (see diskio_diskinit.c) so a reset can skip card init
 	ld hl,#0x7000			; set copy source
 	ld de,#0x7001			; set copy dest
-	ld bc,#0x1fff			; set bytes to copy (1 less than size)
+	ld bc,#0x0ff7			; set bytes to copy (1 less than size)
 	ld (hl),#0				; set initial value (this gets copied through)
 	ldir					; do it
+	ld hl,#0x8000			; and the rest, as before
+	ld de,#0x8001
+	ld bc,#0x0fff
+	ld (hl),#0
+	ldir
 
     ; we will have to fix the memory bank before we prepare the system RAM
-	ld  sp, #0x8000			; 6000-6FFF is reserved for Coleco, 7000-7FFF is used by menu
+	ld  sp, #0x7ff8			; 6000-6FFF is reserved for Coleco, 7000-7FF7 is used by menu
 	call gsinit				; Initialize global variables
 	
 	call _vdpinit			; Initialize VDP and sound
@@ -14,6 +14,31 @@ unsigned char useScanlines = 0;     // takes in real time but we need it after a
 // stored in phoenixBoot.c - whether to allow 4 sprite flicker or not
 extern unsigned char useFlicker;
 
+// the GPU program and its parameter block live at the very top of VRAM,
+// which the menu doesn't use. A cartridge layout may, but by then we are
+// only using it to clear all of VRAM.
+#define GPU_VRAM 0x3fd0
+#define GPU_CODE (GPU_VRAM+10)
+
+// GPU program, hand assembled TMS9900. Copies the parameter block into the
+// DMA registers at >8000, then jumps to a two word tail it writes to GRAM
+// that triggers the DMA and idles. That way it doesn't matter if the DMA
+// overwrites the program (the 16K clear does). RUNNING in SR2 stays set
+// while the DMA holds the GPU, so it clears only when the job is done.
+const unsigned char GPU_PROG[] = {
+	0x02,0x00, 0x80,0x00,		// LI   R0,>8000		DMA registers
+	0x02,0x01, GPU_VRAM>>8,GPU_VRAM&0xff,	// LI R1,GPU_VRAM	parameter block
+	0xcc,0x31,					// MOV  *R1+,*R0+		source
+	0xcc,0x31,					// MOV  *R1+,*R0+		destination
+	0xcc,0x31,					// MOV  *R1+,*R0+		width, height
+	0xcc,0x31,					// MOV  *R1+,*R0+		stride, flags
+	0x02,0x02, 0xd4,0x00,		// LI   R2,>D400		MOVB R0,*R0 - R0 is >8008, the trigger
+	0xc8,0x02, 0x40,0x00,		// MOV  R2,@>4000
+	0x02,0x02, 0x03,0x40,		// LI   R2,>0340		IDLE
+	0xc8,0x02, 0x40,0x02,		// MOV  R2,@>4002
+	0x04,0x60, 0x40,0x00		// B    @>4000
+};
+
 // default F18 palette values
 const unsigned int DEFAULT_PALETTE[] = {
 	0x0000,0x0000,0x02C3,0x05D6,0x054F,0x076F,0x0D54,0x04EF,
@@ -100,3 +125,63 @@ void loadpal_f18a(const unsigned int *ptr, unsigned char cnt) {
 
 	VDP_SET_REGISTER(0x2f, 0x00);	// Turn off the DPM mode
 }
+
+// run one GPU DMA job and wait for it. Width and height of 0 mean 256.
+// flags is written to DMA register 7: 0x01 for fill, 0x00 for copy.
+// The F18A must be unlocked.
+void gpudma_f18a(unsigned int src, unsigned int dst, unsigned char w, unsigned char h, unsigned char flags) {
+	// stop the GPU in case anything is still running on it
+	VDP_SET_REGISTER(0x38, 0);
+
+	// parameter block, same order as the DMA registers
+	VDP_SET_ADDRESS_WRITE(GPU_VRAM);
+	VDPWD = src>>8;
+	VDPWD = src&0xff;
+	VDPWD = dst>>8;
+	VDPWD = dst&0xff;
+	VDPWD = w;
+	VDPWD = h;
+	VDPWD = w;		// stride equal to width keeps the rows contiguous
+	VDPWD = flags;
+
+	// the program goes in every time, the last job may have cleared it
+	vdpmemcpy(GPU_CODE, GPU_PROG, sizeof(GPU_PROG));
+
+	// loading the PC LSB also starts the GPU
+	VDP_SET_REGISTER(0x36, GPU_CODE>>8);
+	VDP_SET_REGISTER(0x37, GPU_CODE&0xff);
+
+	// wait for RUNNING in SR2 to clear, then go back to SR0
+	VDP_SET_REGISTER(0x0f, 2);
+	while (VDPST & 0x80) { }
+	VDP_SET_REGISTER(0x0f, 0);
+}
+
+// fill cnt bytes of VRAM at adr with ch using the GPU DMA
+void gpufill_f18a(unsigned int adr, unsigned char ch, unsigned int cnt) {
+	// the DMA reads the fill byte from VRAM, it goes after the parameters
+	VDP_SET_ADDRESS_WRITE(GPU_VRAM+8);
+	VDPWD = ch;
+
+	// whole 256 byte rows first, then the rest as a single row
+	if (cnt >= 256) {
+		gpudma_f18a(GPU_VRAM+8, adr, 0, cnt>>8, 0x01);
+		adr += cnt&0xff00;
+	}
+	if (cnt&0xff) {
+		gpudma_f18a(GPU_VRAM+8, adr, cnt&0xff, 1, 0x01);
+	}
+}
+
+// copy cnt bytes of VRAM from src to dst using the GPU DMA
+// overlapping areas only work if dst is below src
+void gpucopy_f18a(unsigned int src, unsigned int dst, unsigned int cnt) {
+	if (cnt >= 256) {
+		gpudma_f18a(src, dst, 0, cnt>>8, 0x00);
+		src += cnt&0xff00;
+		dst += cnt&0xff00;
+	}
+	if (cnt&0xff) {
+		gpudma_f18a(src, dst, cnt&0xff, 1, 0x00);
+	}
+}
@@ -12,5 +12,10 @@ void loadpal_f18a(const unsigned int *ptr, unsigned char cnt);
 // prepare the F18A to launch a Coleco title with sprite and scanline settings
 void prepare_f18a();
 
+// fill or copy VRAM with the F18A GPU DMA, these wait for it to finish
+// the F18A must be unlocked, and VRAM 0x3FD0-0x3FFF is used for the GPU program
+void gpufill_f18a(unsigned int adr, unsigned char ch, unsigned int cnt);
+void gpucopy_f18a(unsigned int src, unsigned int dst, unsigned int cnt);
+
 // define for the useScanlines variable
 #define SCANLINES_ON 0x04
@@ -46,6 +46,7 @@ int wait_ready();
 void deselect();
 int select();
 int rcvr_datablock(BYTE *buff, UINT btr);
+UINT rcvr_dma(BYTE *buff, UINT count);
 int xmit_datablock(const BYTE *buff, BYTE token);
 BYTE send_cmd(BYTE cmd, DWORD arg);
 
@@ -94,6 +95,42 @@ BYTE send_cmd(BYTE cmd, DWORD arg);
 extern unsigned char csHigh, csLow;	/* commands to write for CS control (include speed bits) */
 extern DSTATUS Stat;					/* Disk status */
 extern BYTE CardType;			    	/* b0:MMC, b1:SDv1, b2:SDv2, b3:Block addressing */
+extern BYTE DmaEnable;					/* Non-zero to DMA upper 32K block reads straight into SRAM */
+
+/* SD-card access statistics, for the storage diagnostics page */
+#define DSTAT_BUCKETS	7		/* poll counts of 1, 2-3, 4-7 ... 64 and up */
+
+typedef struct {
+	WORD	cmd[DSTAT_BUCKETS];		/* send_cmd() response polls */
+	WORD	token[DSTAT_BUCKETS];	/* rcvr_datablock() start token polls */
+	WORD	ready[DSTAT_BUCKETS];	/* wait_ready() busy polls */
+	WORD	retries;				/* disk_read() attempts after the first */
+	WORD	crcErrors;				/* data blocks with a bad CRC */
+	WORD	timeouts;				/* response, token and ready timeouts */
+	BYTE	ocr[4];					/* OCR read during init (SDv2 only) */
+	WORD	initTicks;				/* vblank ticks taken by the last disk_initialize() */
+	DWORD	initCycles;				/* CPU cycles taken by it, 0 without the performance counters */
+	BYTE	warm;					/* non-zero if the card was reused after a warm reset */
+} DSTATS;
+
+extern DSTATS DiskStats;
+void dstat_inc(WORD *cnt);
+void dstat_poll(WORD *hist, UINT polls);
+
+/* Timeouts, in 60Hz vblank ticks counted by disk_ticks(). Ticks land    */
+/* anywhere in the first frame, so each has one added. Loops also stop   */
+/* after TMO_POLLS polls in case the VDP interrupt is off.               */
+#define TMO_READY	31		/* wait_ready(), 500ms */
+#define TMO_TOKEN	7		/* rcvr_datablock() start token, 100ms */
+#define TMO_INIT	61		/* ACMD41/CMD1 leaving idle state, 1s */
+#define TMO_POLLS	0xFFFF
+
+/* Define to build the fixed dly_50us() waits of the original driver back */
+/* in and skip the warm reuse, to compare init and load times with it.    */
+/* #define DISK_BASELINE_DELAYS */
+
+WORD disk_ticks(void);
+void ackVblank(void);
 
 /*--------------------------------------------------------------------------
 
@@ -104,6 +141,7 @@ extern BYTE CardType;			    	/* b0:MMC, b1:SDv1, b2:SDv2, b3:Block addressing */
 /* MMC/SD command (SPI mode) */
 #define CMD0	((BYTE)0)			/* GO_IDLE_STATE */
 #define CMD1	((BYTE)1)			/* SEND_OP_COND */
+#define CMD6	((BYTE)6)			/* SWITCH_FUNC (SDC) */
 #define	ACMD41	((BYTE)(0x80+41))	/* SEND_OP_COND (SDC) */
 #define CMD8	((BYTE)8)			/* SEND_IF_COND */
 #define CMD9	((BYTE)9)			/* SEND_CSD */
@@ -131,4 +169,7 @@ extern BYTE CardType;			    	/* b0:MMC, b1:SDv1, b2:SDv2, b3:Block addressing */
 #define CT_SDC		(CT_SD1|CT_SD2)	/* SD */
 #define CT_BLOCK	0x08		/* Block addressing */
 
+/* Attempts at a read before disk_read() reports an error */
+#define DISK_READ_RETRIES	3
+
 #endif
@@ -32,28 +32,68 @@ unsigned char csHigh, csLow;
 DSTATUS Stat = STA_NOINIT;	/* Disk status */
 BYTE CardType;			    /* b0:MMC, b1:SDv1, b2:SDv2, b3:Block addressing */
 
+/* Card state kept across warm resets. The crt0 leaves 0x7FF8-0x7FFF  */
+/* alone when it clears RAM, and starts the stack below it.           */
+typedef struct {
+	BYTE	magic[2];	/* 'S','D' when valid */
+	BYTE	type;		/* CardType */
+	BYTE	csHigh;		/* Bus configuration, including High-Speed */
+	BYTE	csLow;
+	BYTE	check;		/* ~(type ^ csHigh ^ csLow) */
+} WARMCARD;
+
+__at (0x7FF8) WARMCARD WarmCard;
+
 /*-----------------------------------------------------------------------*/
-/* Initialize Disk Drive                                                 */
+/* Reuse the card set up before a warm reset                             */
 /*-----------------------------------------------------------------------*/
-DSTATUS disk_initialize (
-#if FF_FS_ONEDRIVE != 1
-	BYTE drv		/* Physical drive nmuber (0) */
-#endif
-)
+/* A card still in SPI mode answers CMD13 (SEND_STATUS) with no errors. */
+/* A card inserted since has not been put in SPI mode, so it does not   */
+/* answer and gets the full initialization.                             */
+static BYTE warm_init (void)	/* Card type, 0 if the card must be initialized */
+{
+	BYTE d;
+
+	if (WarmCard.magic[0] != 'S' || WarmCard.magic[1] != 'D' || !WarmCard.type ||
+		WarmCard.check != (BYTE)~(WarmCard.type ^ WarmCard.csHigh ^ WarmCard.csLow)) {
+		return 0;
+	}
+
+	csHigh = WarmCard.csHigh;
+	csLow = WarmCard.csLow;
+
+	CS_L();
+	send_cmd(CMD12, 0);				/* Stop a read the reset may have interrupted */
+	if (send_cmd(CMD13, 0) == 0) {	/* R2 is R1 and then a status byte */
+		rcvr_mmc(&d, 1);
+		if (d == 0) return WarmCard.type;
+	}
+
+	return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Identify and initialize the card from power-up                        */
+/*-----------------------------------------------------------------------*/
+/* The card is polled back to back while it leaves the idle state, with */
+/* a 1s vblank timeout, instead of sleeping between tries.              */
+static BYTE cold_init (void)	/* Card type, 0 if the card failed */
 {
-	BYTE n, ty, cmd, buf[4];
+	BYTE n, ty, cmd, buf[4], sw[64];
 	UINT tmr;
-	DSTATUS s;
-#if FF_FS_ONEDRIVE != 1
-	if (drv) return RES_NOTRDY;
-#endif
+	WORD start;
 
     // prepare low speed bus configuration
     csHigh = PH_SD_CE_OFF | PH_SD_LOW_SPEED;
     csLow = PH_SD_LOW_SPEED;
 
+	/* No 10ms power-up delay. The card is powered long before the menu runs, */
+	/* and a hot-inserted card has already passed the card detect debounce.  */
+#ifdef DISK_BASELINE_DELAYS
 	dly_50us(200);			/* 10ms */
+#endif
 	CS_H();		            /* Deselect CS */
+	start = disk_ticks();
 
 	for (n = 10; n; n--) rcvr_mmc(buf, 1);	/* Apply 80 dummy clocks and the card gets ready to receive command */
 
@@ -67,12 +107,16 @@ DSTATUS disk_initialize (
 		if (send_cmd(CMD8, 0x1AA) == 1) {	/* SDv2? */
 			rcvr_mmc(buf, 4);							/* Get trailing return value of R7 resp */
 			if (buf[2] == 0x01 && buf[3] == 0xAA) {		/* The card can work at vdd range of 2.7-3.6V */
-				for (tmr = 1000; tmr; tmr--) {			/* Wait for leaving idle state (ACMD41 with HCS bit) */
+				for (tmr = TMO_POLLS; tmr; tmr--) {		/* Wait for leaving idle state (ACMD41 with HCS bit) */
 					if (send_cmd(ACMD41, 1UL << 30) == 0) break;
+#ifdef DISK_BASELINE_DELAYS
 					dly_50us(20);
+#endif
+					if ((WORD)(disk_ticks() - start) >= TMO_INIT) tmr = 1;	/* Timeout, ends with tmr == 0 */
 				}
 				if (tmr && send_cmd(CMD58, 0) == 0) {	/* Check CCS bit in the OCR */
 					rcvr_mmc(buf, 4);
+					for (n = 0; n < 4; n++) DiskStats.ocr[n] = buf[n];
 					ty = (buf[0] & 0x40) ? CT_SD2 | CT_BLOCK : CT_SD2;	/* SDv2 */
 				}
 			}
@@ -82,21 +126,79 @@ DSTATUS disk_initialize (
 			} else {
 				ty = CT_MMC; cmd = CMD1;	/* MMCv3 */
 			}
-			for (tmr = 1000; tmr; tmr--) {			/* Wait for leaving idle state */
+			for (tmr = TMO_POLLS; tmr; tmr--) {		/* Wait for leaving idle state */
 				if (send_cmd(cmd, 0) == 0) break;
+#ifdef DISK_BASELINE_DELAYS
 				dly_50us(20);
+#endif
+				if ((WORD)(disk_ticks() - start) >= TMO_INIT) tmr = 1;	/* Timeout, ends with tmr == 0 */
 			}
 			if (!tmr || send_cmd(CMD16, 512) != 0) {/* Set R/W block length to 512 */
 				ty = 0;
             }
 		}
 	}
+	if (ty & CT_SDC) {						/* SD cards v1.10 and up can switch to High-Speed */
+		/* Mode 1 (set) of function 1 (High-Speed) in group 1, other groups unchanged.
+		   Cards without the function report 0xF in the group 1 result nibble. */
+		if (send_cmd(CMD6, 0x80FFFFF1) == 0 && rcvr_datablock(sw, 64)) {
+			if ((sw[16] & 0x0F) == 0x01) {		/* Switched, bits 379..376 of the status */
+				// prepare 25MHz bus configuration
+				csHigh = PH_SD_CE_OFF | PH_SD_HIGH_SPEED;
+				csLow = PH_SD_HIGH_SPEED;
+			}
+		}
+	}
+
+	return ty;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Initialize Disk Drive                                                 */
+/*-----------------------------------------------------------------------*/
+DSTATUS disk_initialize (
+#if FF_FS_ONEDRIVE != 1
+	BYTE drv		/* Physical drive nmuber (0) */
+#endif
+)
+{
+	BYTE ty;
+	WORD start;
+	DWORD cycles;
+	DSTATUS s;
+#if FF_FS_ONEDRIVE != 1
+	if (drv) return RES_NOTRDY;
+#endif
+
+	phPerfCounters = PH_PERF_LATCH;
+	cycles = perfRead(PH_PERF_CYCLES);
+	start = disk_ticks();
+#ifdef DISK_BASELINE_DELAYS
+	ty = 0;
+#else
+	ty = warm_init();
+#endif
+	DiskStats.warm = ty ? 1 : 0;
+	if (!ty) ty = cold_init();
+
 	CardType = ty;
 	s = ty ? 0 : STA_NOINIT;
 	Stat = s;
 
+	/* Remember the card for the next warm reset */
+	WarmCard.magic[0] = ty ? 'S' : 0;
+	WarmCard.magic[1] = 'D';
+	WarmCard.type = ty;
+	WarmCard.csHigh = csHigh;
+	WarmCard.csLow = csLow;
+	WarmCard.check = ~(ty ^ csHigh ^ csLow);
+
 	deselect();
 
+	DiskStats.initTicks = disk_ticks() - start;
+	phPerfCounters = PH_PERF_LATCH;
+	DiskStats.initCycles = perfRead(PH_PERF_CYCLES) - cycles;
+
 	return s;
 }
 
@@ -33,7 +33,8 @@ DRESULT disk_read (
 	UINT count			/* Sector count (1..128) */
 )
 {
-	BYTE cmd;
+	BYTE cmd, retry;
+	UINT n;
 
 #if FF_FS_ONEDRIVE != 1
 	if (disk_status(drv) & STA_NOINIT) return RES_NOTRDY;
@@ -41,22 +42,33 @@ DRESULT disk_read (
 	if (disk_status() & STA_NOINIT) return RES_NOTRDY;
 #endif
 
-	if (!(CardType & CT_BLOCK)) {
-        sector *= 512;	/* Convert LBA to byte address if needed */
-    }
-
-	cmd = count > 1 ? CMD18 : CMD17;			/*  READ_MULTIPLE_BLOCK : READ_SINGLE_BLOCK */
-	if (send_cmd(cmd, sector) == 0) {
-		do {
-			if (!rcvr_datablock(buff, 512)) {
-                break;
-            }
-			buff += 512;
-		} while (--count);
-		if (cmd == CMD18) send_cmd(CMD12, 0);	/* STOP_TRANSMISSION */
+	/* A block that fails (bad token or CRC) is read again, along with the */
+	/* rest of the request, a few times before giving up.                   */
+	for (retry = DISK_READ_RETRIES; retry && count; retry--) {
+		if (retry != DISK_READ_RETRIES) dstat_inc(&DiskStats.retries);
+		cmd = count > 1 ? CMD18 : CMD17;			/*  READ_MULTIPLE_BLOCK : READ_SINGLE_BLOCK */
+		/* Convert LBA to byte address if needed */
+		if (send_cmd(cmd, (CardType & CT_BLOCK) ? sector : sector * 512) == 0) {
+			/* Whole blocks for the cartridge area go straight to SRAM. FatFs' own */
+			/* window buffer is in low RAM, so it never takes this path.          */
+			if (DmaEnable && buff >= (BYTE*)0x8000 && ((UINT)buff & 0x1FF) == 0) {
+				n = rcvr_dma(buff, count);
+				buff += n * 512;
+				sector += n;
+				count -= n;
+			} else {
+				do {
+					if (!rcvr_datablock(buff, 512)) {
+						break;
+					}
+					buff += 512;
+					sector++;
+				} while (--count);
+			}
+			if (cmd == CMD18) send_cmd(CMD12, 0);	/* STOP_TRANSMISSION */
+		}
+		deselect();
 	}
-	deselect();
 
 	return count ? RES_ERROR : RES_OK;
 }
-
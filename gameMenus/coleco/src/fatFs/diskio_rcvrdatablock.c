@@ -30,17 +30,29 @@ int rcvr_datablock (	/* 1:OK, 0:Failed */
 )
 {
 	BYTE d[2];
-	UINT tmr;
+	UINT polls = 0;
+	WORD start = disk_ticks();
 
-	for (tmr = 1000; tmr; tmr--) {	/* Wait for data packet in timeout of 100ms */
+	do {							/* Spin for the data packet in timeout of 100ms */
 		rcvr_mmc(d, 1);
-		if (d[0] != 0xFF) break;
-		dly_50us(2);
-	}
+		polls++;
+#ifdef DISK_BASELINE_DELAYS
+		if (d[0] == 0xFF) dly_50us(2);
+#endif
+	} while (d[0] == 0xFF && (WORD)(disk_ticks() - start) < TMO_TOKEN && polls != TMO_POLLS);
+	if (d[0] == 0xFF) dstat_inc(&DiskStats.timeouts);
+	dstat_poll(DiskStats.token, polls);
 	if (d[0] != 0xFE) return 0;		/* If not valid data token, return with error */
 
+	phSDControl = csLow | PH_SD_PREFETCH | PH_SD_CRC_RESTART;	/* Read ahead while the block streams in, check its CRC */
 	rcvr_mmc(buff, btr);			/* Receive the data block into buffer */
-	rcvr_mmc(d, 2);					/* Discard CRC */
+	rcvr_mmc(d, 2);					/* Receive CRC, checked by the hardware */
+	phSDControl = csLow;			/* Stop read ahead, any bytes already fetched are kept in order */
+
+	if (btr == 512 && !(phSDControl & PH_SD_CRC_OK)) {	/* The checker only covers full blocks */
+		dstat_inc(&DiskStats.crcErrors);
+		return 0;
+	}
 
 	return 1;						/* Return with success */
 }
@@ -0,0 +1,50 @@
+/*-----------------------------------------------------------------------*/
+/* Low level disk I/O module for Phoenix SD Card                         */
+/*-----------------------------------------------------------------------*/
+
+#include "ff.h"			/* Obtains integer types */
+#include "diskio.h"		/* Declarations of disk functions */
+#include "../phoenix.h" /* declarations of Phoenix hardware */
+
+// Code adapted from the generic sdmm.c - not updated to Matt's reference just yet
+// Obviously not bit-banging though.
+// License for those parts:
+/*------------------------------------------------------------------------/
+/  Foolproof MMCv3/SDv1/SDv2 (in SPI mode) control module
+/-------------------------------------------------------------------------/
+/
+/  Copyright (C) 2013, ChaN, all right reserved.
+/
+/ * This software is a free software and there is NO WARRANTY.
+/ * No restriction on use. You can use, modify and redistribute it for
+/   personal, non-profit or commercial products UNDER YOUR RESPONSIBILITY.
+/ * Redistributions of source code must retain the above copyright notice.
+*/
+
+BYTE DmaEnable;		/* Non-zero to DMA upper 32K block reads straight into SRAM */
+
+/*-----------------------------------------------------------------------*/
+/* Receive data packets from the card into SRAM (hardware DMA)           */
+/*-----------------------------------------------------------------------*/
+UINT rcvr_dma (			/* Number of data packets received, stops at the first failed one */
+	BYTE *buff,			/* 512-byte aligned upper 32K address in the selected RAM bank */
+	UINT count			/* Number of data packets */
+)
+{
+	UINT blk;
+
+	/* Each 32K bank is 64 blocks, and the upper 32K address gives the block in the bank */
+	blk = ((UINT)(phRAMBankSelect & 0x0F) << 6) | (((UINT)buff >> 9) & 0x3F);
+	phDMABlockLo = (BYTE)blk;
+	phDMABlockHi = (BYTE)(blk >> 8);
+	phDMACountLo = (BYTE)count;
+	phDMACountHi = (BYTE)(count >> 8);
+	phDMAControl = PH_DMA_START;	/* Card is still selected from the read command */
+
+	while (phDMAControl & PH_DMA_BUSY) ;
+
+	if (!(phDMAControl & PH_DMA_ERROR)) return count;
+
+	/* The count register stops at the failed block */
+	return count - (((UINT)(phDMACountHi & 0x07) << 8) | phDMACountLo);
+}
@@ -62,6 +62,13 @@ BYTE send_cmd (		/* Returns command response (bit7==1:Send failed)*/
 		rcvr_mmc(&d, 1);
     } while ((d & 0x80) && --n);
 
+	if (d & 0x80) {
+		dstat_inc(&DiskStats.timeouts);
+		dstat_poll(DiskStats.cmd, 10);
+	} else {
+		dstat_poll(DiskStats.cmd, 11 - n);
+	}
+
 	return d;			/* Return with the response value */
 }
 
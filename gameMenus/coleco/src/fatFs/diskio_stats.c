@@ -0,0 +1,51 @@
+/*-----------------------------------------------------------------------*/
+/* Low level disk I/O module for Phoenix SD Card                         */
+/*-----------------------------------------------------------------------*/
+
+#include "ff.h"			/* Obtains integer types */
+#include "diskio.h"		/* Declarations of disk functions */
+#include "../phoenix.h" /* declarations of Phoenix hardware */
+
+// Code adapted from the generic sdmm.c - not updated to Matt's reference just yet
+// Obviously not bit-banging though.
+// License for those parts:
+/*------------------------------------------------------------------------/
+/  Foolproof MMCv3/SDv1/SDv2 (in SPI mode) control module
+/-------------------------------------------------------------------------/
+/
+/  Copyright (C) 2013, ChaN, all right reserved.
+/
+/ * This software is a free software and there is NO WARRANTY.
+/ * No restriction on use. You can use, modify and redistribute it for
+/   personal, non-profit or commercial products UNDER YOUR RESPONSIBILITY.
+/ * Redistributions of source code must retain the above copyright notice.
+*/
+
+DSTATS DiskStats;	/* SD-card access statistics */
+
+/*-----------------------------------------------------------------------*/
+/* Count an event, the counters stop at 0xFFFF                           */
+/*-----------------------------------------------------------------------*/
+void dstat_inc (
+	WORD *cnt			/* Counter to increment */
+)
+{
+	if (*cnt != 0xFFFF) (*cnt)++;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Record a poll count in a histogram, one bucket per power of two       */
+/*-----------------------------------------------------------------------*/
+void dstat_poll (
+	WORD *hist,			/* Histogram of DSTAT_BUCKETS counters */
+	UINT polls			/* Number of polls until the card answered */
+)
+{
+	BYTE b = 0;
+
+	while (polls > 1 && b < DSTAT_BUCKETS - 1) {	/* 1, 2-3, 4-7 ... 64 and up */
+		polls >>= 1;
+		b++;
+	}
+	dstat_inc(&hist[b]);
+}
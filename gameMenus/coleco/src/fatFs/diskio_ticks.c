@@ -0,0 +1,54 @@
+/*-----------------------------------------------------------------------*/
+/* Low level disk I/O module for Phoenix SD Card                         */
+/*-----------------------------------------------------------------------*/
+
+#include "ff.h"			/* Obtains integer types */
+#include "diskio.h"		/* Declarations of disk functions */
+#include "../phoenix.h" /* declarations of Phoenix hardware */
+#include "vdp.h"		/* vblank flag */
+#include "../joykey.h"	/* vblank input sampler */
+
+// Code adapted from the generic sdmm.c - not updated to Matt's reference just yet
+// Obviously not bit-banging though.
+// License for those parts:
+/*------------------------------------------------------------------------/
+/  Foolproof MMCv3/SDv1/SDv2 (in SPI mode) control module
+/-------------------------------------------------------------------------/
+/
+/  Copyright (C) 2013, ChaN, all right reserved.
+/
+/ * This software is a free software and there is NO WARRANTY.
+/ * No restriction on use. You can use, modify and redistribute it for
+/   personal, non-profit or commercial products UNDER YOUR RESPONSIBILITY.
+/ * Redistributions of source code must retain the above copyright notice.
+*/
+
+WORD DiskTicks;		/* Vblank ticks seen while the disk code polls */
+
+/*-----------------------------------------------------------------------*/
+/* Acknowledge a pending vblank                                          */
+/*-----------------------------------------------------------------------*/
+/* The only place the vblank flag is cleared, by the menu and the disk   */
+/* code alike. Each frame is counted in DiskTicks and, while it is on,   */
+/* given to the controller sampler, so frames that go by during disk     */
+/* reads are not lost to either.                                         */
+void ackVblank (void)
+{
+	if (vdpLimi & 0x80) {
+		VDP_CLEAR_VBLANK;
+		DiskTicks++;
+		if (joySamplerOn) joySample();
+	}
+}
+
+/*-----------------------------------------------------------------------*/
+/* Vblank tick count for timeouts                                        */
+/*-----------------------------------------------------------------------*/
+/* The vblank flag is only sampled by ackVblank(), so ticks only advance */
+/* while someone polls. A timeout loop should also cap its poll count,   */
+/* since ticks stop if the VDP interrupt is turned off.                  */
+WORD disk_ticks (void)
+{
+	ackVblank();
+	return DiskTicks;
+}
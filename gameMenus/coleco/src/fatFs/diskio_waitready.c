@@ -27,13 +27,19 @@
 int wait_ready (void)	/* 1:OK, 0:Timeout */
 {
 	BYTE d;
-	UINT tmr;
+	UINT polls = 0;
+	WORD start = disk_ticks();
 
-	for (tmr = 5000; tmr; tmr--) {	/* Wait for ready in timeout of 500ms */
+	do {							/* Spin until ready, in timeout of 500ms */
 		rcvr_mmc(&d, 1);
-		if (d == 0xFF) break;
-		dly_50us(2);
-	}
+		polls++;
+#ifdef DISK_BASELINE_DELAYS
+		if (d != 0xFF) dly_50us(2);
+#endif
+	} while (d != 0xFF && (WORD)(disk_ticks() - start) < TMO_READY && polls != TMO_POLLS);
 
-	return tmr ? 1 : 0;
+	if (d != 0xFF) dstat_inc(&DiskStats.timeouts);
+	dstat_poll(DiskStats.ready, polls);
+
+	return (d == 0xFF) ? 1 : 0;
 }
@@ -29,7 +29,7 @@ static volatile __sfr __at 0x80 port2;
 static volatile __sfr __at 0xc0 port3;
 
 // For Coleco, all modes except 2 read controller 1, and 2 reads controller 2
-void readinputs(unsigned char mode) {
+void readjoy(unsigned char mode, JOYSTATE *p) {
 	unsigned char key;
 
 	port2 = SELECT;		// select keypad
@@ -45,13 +45,13 @@ void readinputs(unsigned char mode) {
 	// Note this limits us not to read keypad and fire2 at the same time,
 	// which honestly I will probably want later.
 	if ((key&0x40) == 0) {
-		MY_KEY = JOY_FIRE;
+		p->key = JOY_FIRE;
 	} else {
-		MY_KEY = keys[key & 0xf];
+		p->key = keys[key & 0xf];
 	}
 
-	MY_JOYX = 0;
-	MY_JOYY = 0;
+	p->joyx = 0;
+	p->joyy = 0;
 
 	port3 = SELECT;		// select joystick
 	if (mode == 2) {
@@ -62,19 +62,106 @@ void readinputs(unsigned char mode) {
 	// active low bits:
 	// xFxxLDRU
 	if ((key&0x40) == 0) {
-		MY_KEY = JOY_FIRE;
+		p->key = JOY_FIRE;
 	}
 	if ((key&0x08) == 0) {
-		MY_JOYX = JOY_LEFT;
+		p->joyx = JOY_LEFT;
 	}
 	if ((key&0x04) == 0) {
-		MY_JOYY = JOY_DOWN;
+		p->joyy = JOY_DOWN;
 	}
 	if ((key&0x02) == 0) {
-		MY_JOYX = JOY_RIGHT;
+		p->joyx = JOY_RIGHT;
 	}
 	if ((key&0x01) == 0) {
-		MY_JOYY = JOY_UP;
+		p->joyy = JOY_UP;
+	}
+}
+
+void readinputs(unsigned char mode) {
+	JOYSTATE st;
+
+	readjoy(mode, &st);
+	MY_KEY = st.key;
+	MY_JOYX = st.joyx;
+	MY_JOYY = st.joyy;
+}
+
+// --- vblank sampler ---
+
+unsigned char joySamplerOn = 0;			// checked when a vblank is acknowledged
+
+JOYSTATE joyRaw;						// last frame's sample
+JOYSTATE joyStable;						// debounced state
+unsigned char joyHeld;					// frames until the next autorepeat
+
+JOYSTATE joyRing[JOY_RING_SIZE];
+unsigned char joyHead;					// written by the sampler
+unsigned char joyTail;					// written by the reader
+
+// queue an event, dropping it if the ring is full
+void joyPush() {
+	unsigned char next = (joyHead+1) & (JOY_RING_SIZE-1);
+	if (next != joyTail) {
+		joyRing[joyHead] = joyStable;
+		joyHead = next;
+	}
+}
+
+void joySample() {
+	JOYSTATE now;
+
+	readjoy(1, &now);
+	if ((now.key == 0xff) && (now.joyx == 0) && (now.joyy == 0)) {
+		// try joystick 2
+		readjoy(2, &now);
+	}
+
+	// a change counts once it reads the same for two frames
+	if ((now.key == joyRaw.key) && (now.joyx == joyRaw.joyx) && (now.joyy == joyRaw.joyy)) {
+		if ((now.key != joyStable.key) || (now.joyx != joyStable.joyx) || (now.joyy != joyStable.joyy)) {
+			joyStable = now;
+			joyHeld = JOY_REPEAT_FIRST;
+			joyPush();
+		} else if ((now.joyx) || (now.joyy)) {
+			// held direction - repeat, but don't stack them up behind a slow reader
+			if (--joyHeld == 0) {
+				joyHeld = JOY_REPEAT_NEXT;
+				if (joyHead == joyTail) {
+					joyPush();
+				}
+			}
+		}
+	}
+	joyRaw = now;
+}
+
+void joyStart() {
+	readjoy(1, &joyRaw);
+	joyStable = joyRaw;
+	joyHead = joyTail;
+	joySamplerOn = 1;
+}
+
+void joyStop() {
+	joySamplerOn = 0;
+}
+
+void joyGetState() {
+	MY_KEY = joyStable.key;
+	MY_JOYX = joyStable.joyx;
+	MY_JOYY = joyStable.joyy;
+}
+
+unsigned char joyGetEvent(JOYSTATE *p) {
+	if (joyHead == joyTail) {
+		return 0;
 	}
+	*p = joyRing[joyTail];
+	joyTail = (joyTail+1) & (JOY_RING_SIZE-1);
+	return 1;
+}
 
+void joyFlushEvents() {
+	joyTail = joyHead;
 }
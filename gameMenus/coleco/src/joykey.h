@@ -17,6 +17,40 @@ extern unsigned char MY_JOYX;
 #define JOY_DOWN	0xfc
 #define JOY_FIRE	18
 
+// one controller state, and the input events
+typedef struct {
+	unsigned char key;		// as MY_KEY
+	unsigned char joyx;		// as MY_JOYX
+	unsigned char joyy;		// as MY_JOYY
+} JOYSTATE;
+
 // read inputs - return in above variables.
 // 1 for controller 1, 2 for controller 2
-void readinputs(unsigned char mode);
\ No newline at end of file
+void readinputs(unsigned char mode);
+// same, but into a JOYSTATE
+void readjoy(unsigned char mode, JOYSTATE *p);
+
+// Vblank input sampler. Once started, both controllers are read for each
+// vblank acknowledged by ackVblank(), from waitVblanks(), readkeypad() or
+// the disk code polling disk_ticks() (controller 2 only when 1 is idle),
+// debounced over two frames, and each change, plus autorepeat of a held
+// direction, goes into a ring buffer.
+// Nothing else may touch the controller ports while it runs. Needs the
+// VDP interrupt enabled. The NMI itself only sets the vblank flag: the
+// VRAM kernels run with SP above their own arguments, so there is no
+// room on the stack for a call from the NMI.
+#define JOY_RING_SIZE 16		// power of 2
+#define JOY_REPEAT_FIRST 45		// frames held before the first repeat
+#define JOY_REPEAT_NEXT 5		// frames between repeats after that
+
+extern unsigned char joySamplerOn;
+void joyStart();
+void joyStop();
+// copy the current debounced state into MY_KEY, MY_JOYX and MY_JOYY
+void joyGetState();
+// get the next event, returns 0 if there was none
+unsigned char joyGetEvent(JOYSTATE *p);
+// drop any events not read yet
+void joyFlushEvents();
+// take one sample, called once per acknowledged vblank while on
+void joySample();
\ No newline at end of file
@@ -1,276 +1,59 @@
-// Modified by Tursi to keep only the characters 29-122
-// (copyright to z)
-// Full 256 tile character set based on the MSX1 font.
-// Modifies the original set to have copyright and
-// trademark characters at the indexes expected by the CV.
+// Generated by mkasset, edit the source images instead
+//
+// FATFONT: raw from ../assets/fatfont.bin
 
 #ifdef HEADERS__
 extern const unsigned char FATFONT[];
-// Size of data in above array
 #define SIZE_OF_FATFONT 752
 #else
 const unsigned char FATFONT[] = {
-#if 0
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,	// 0
-	0x3C,0x42,0xA5,0x81,0xA5,0x99,0x42,0x3C,
-	0x3C,0x7E,0xDB,0xFF,0xFF,0xDB,0x66,0x3C,
-	0x6C,0xFE,0xFE,0xFE,0x7C,0x38,0x10,0x00,
-	0x10,0x38,0x7C,0xFE,0x7C,0x38,0x10,0x00,
-	0x10,0x38,0x54,0xFE,0x54,0x10,0x38,0x00,
-	0x10,0x38,0x7C,0xFE,0xFE,0x10,0x38,0x00,
-	0x00,0x00,0x00,0x30,0x30,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xE7,0xE7,0xFF,0xFF,0xFF,	// 8
-	0x38,0x44,0x82,0x82,0x82,0x44,0x38,0x00,
-	0xC7,0xBB,0x7D,0x7D,0x7D,0xBB,0xC7,0xFF,
-	0x0F,0x03,0x05,0x79,0x88,0x88,0x88,0x70,
-	0x38,0x44,0x44,0x44,0x38,0x10,0x7C,0x10,
-	0x30,0x28,0x24,0x24,0x28,0x20,0xE0,0xC0,
-	0x3C,0x24,0x3C,0x24,0x24,0xE4,0xDC,0x18,
-	0x10,0x54,0x38,0xEE,0x38,0x54,0x10,0x00,
-	0x10,0x10,0x10,0x7C,0x10,0x10,0x10,0x10,	// 16
-	0x10,0x10,0x10,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xFF,0x10,0x10,0x10,0x10,
-	0x10,0x10,0x10,0xF0,0x10,0x10,0x10,0x10,
-	0x10,0x10,0x10,0x1F,0x10,0x10,0x10,0x10,
-	0x10,0x10,0x10,0xFF,0x10,0x10,0x10,0x10,
-	0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
-	0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x1F,0x10,0x10,0x10,0x10,	// 24
-	0x00,0x00,0x00,0xF0,0x10,0x10,0x10,0x10,
-	0x10,0x10,0x10,0x1F,0x00,0x00,0x00,0x00,
-	0x10,0x10,0x10,0xF0,0x00,0x00,0x00,0x00,
-	0x81,0x42,0x24,0x18,0x18,0x24,0x42,0x81,	// moved original graphic tiles to 141, 142, 143
-#endif
-//	0x7E,0x81,0xBD,0xA1,0xA1,0xBD,0x81,0x7E,	// 29 CV copyright (c)
-    0x78,0x84,0xB4,0xA4,0xB4,0x84,0x78,0x00,    // (redrawn by Tursi)
-    0x1F,0x04,0x04,0x04,0x00,0x00,0x00,0x00,	// 30 CV trade T
-	0x44,0x6C,0x54,0x54,0x00,0x00,0x00,0x00,	// 31 CV mark M
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,	// 32
-	0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x00,
-	0x50,0x50,0x50,0x00,0x00,0x00,0x00,0x00,
-	0x50,0x50,0xF8,0x50,0xF8,0x50,0x50,0x00,
-	0x20,0x78,0xA0,0x70,0x28,0xF0,0x20,0x00,
-	0xC0,0xC8,0x10,0x20,0x40,0x98,0x18,0x00,
-	0x40,0xA0,0x40,0xA8,0x90,0x98,0x60,0x00,
-	0x10,0x20,0x40,0x00,0x00,0x00,0x00,0x00,
-	0x10,0x20,0x40,0x40,0x40,0x20,0x10,0x00,	// 40
-	0x40,0x20,0x10,0x10,0x10,0x20,0x40,0x00,
-	0x20,0xA8,0x70,0x20,0x70,0xA8,0x20,0x00,
-	0x00,0x20,0x20,0xF8,0x20,0x20,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x40,
-	0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,
-	0x00,0x00,0x08,0x10,0x20,0x40,0x80,0x00,
-	0x70,0x88,0x98,0xA8,0xC8,0x88,0x70,0x00,	// 48
-//	0x20,0x60,0xA0,0x20,0x20,0x20,0xF0,0x00,
-	0x20,0x60,0x20,0x20,0x20,0x20,0x70,0x00,    // 49 (1) editted by Tursi
-    0x70,0x88,0x08,0x10,0x60,0x80,0xF8,0x00,
-	0x70,0x88,0x08,0x30,0x08,0x88,0x70,0x00,
-	0x10,0x30,0x50,0x90,0xF8,0x10,0x10,0x00,
-	0xF8,0x80,0xE0,0x10,0x08,0x10,0xE0,0x00,
-	0x30,0x40,0x80,0xF0,0x88,0x88,0x70,0x00,
-	0xF8,0x88,0x10,0x20,0x20,0x20,0x20,0x00,
-	0x70,0x88,0x88,0x70,0x88,0x88,0x70,0x00,	// 56
-	0x70,0x88,0x88,0x78,0x08,0x10,0x60,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,
-	0x00,0x00,0x20,0x00,0x00,0x20,0x20,0x40,
-	0x18,0x30,0x60,0xC0,0x60,0x30,0x18,0x00,
-	0x00,0x00,0xF8,0x00,0xF8,0x00,0x00,0x00,
-	0xC0,0x60,0x30,0x18,0x30,0x60,0xC0,0x00,
-	0x70,0x88,0x08,0x10,0x20,0x00,0x20,0x00,
-	0x70,0x88,0x08,0x48,0xA8,0xA8,0x70,0x00,	// 64 @
-	0x20,0x50,0x88,0x88,0xF8,0x88,0x88,0x00,	// 65 A
-	0xF0,0x48,0x48,0x70,0x48,0x48,0xF0,0x00,
-	0x30,0x48,0x80,0x80,0x80,0x48,0x30,0x00,
-	0xE0,0x50,0x48,0x48,0x48,0x50,0xE0,0x00,
-	0xF8,0x80,0x80,0xF0,0x80,0x80,0xF8,0x00,
-	0xF8,0x80,0x80,0xF0,0x80,0x80,0x80,0x00,
-	0x70,0x88,0x80,0xB8,0x88,0x88,0x70,0x00,
-	0x88,0x88,0x88,0xF8,0x88,0x88,0x88,0x00,
-	0x70,0x20,0x20,0x20,0x20,0x20,0x70,0x00,
-	0x38,0x10,0x10,0x10,0x90,0x90,0x60,0x00,
-	0x88,0x90,0xA0,0xC0,0xA0,0x90,0x88,0x00,
-	0x80,0x80,0x80,0x80,0x80,0x80,0xF8,0x00,
-	0x88,0xD8,0xA8,0xA8,0x88,0x88,0x88,0x00,
-	0x88,0xC8,0xC8,0xA8,0x98,0x98,0x88,0x00,
-	0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x00,
-	0xF0,0x88,0x88,0xF0,0x80,0x80,0x80,0x00,
-	0x70,0x88,0x88,0x88,0xA8,0x90,0x68,0x00,
-	0xF0,0x88,0x88,0xF0,0xA0,0x90,0x88,0x00,
-	0x70,0x88,0x80,0x70,0x08,0x88,0x70,0x00,
-	0xF8,0x20,0x20,0x20,0x20,0x20,0x20,0x00,
-	0x88,0x88,0x88,0x88,0x88,0x88,0x70,0x00,
-	0x88,0x88,0x88,0x88,0x50,0x50,0x20,0x00,
-	0x88,0x88,0x88,0xA8,0xA8,0xD8,0x88,0x00,
-	0x88,0x88,0x50,0x20,0x50,0x88,0x88,0x00,
-	0x88,0x88,0x88,0x70,0x20,0x20,0x20,0x00,
-	0xF8,0x08,0x10,0x20,0x40,0x80,0xF8,0x00,
-	0x70,0x40,0x40,0x40,0x40,0x40,0x70,0x00,
-	0x00,0x00,0x80,0x40,0x20,0x10,0x08,0x00,
-	0x70,0x10,0x10,0x10,0x10,0x10,0x70,0x00,
-	0x20,0x50,0x88,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,
-	0x80,0x40,0x20,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x70,0x08,0x78,0x88,0x78,0x00,
-	0x80,0x80,0xB0,0xC8,0x88,0xC8,0xB0,0x00,
-	0x00,0x00,0x70,0x88,0x80,0x88,0x70,0x00,
-	0x08,0x08,0x68,0x98,0x88,0x98,0x68,0x00,
-	0x00,0x00,0x70,0x88,0xF8,0x80,0x70,0x00,
-	0x10,0x28,0x20,0xF8,0x20,0x20,0x20,0x00,
-	0x00,0x00,0x68,0x98,0x98,0x68,0x08,0x70,
-	0x80,0x80,0xF0,0x88,0x88,0x88,0x88,0x00,
-	0x20,0x00,0x60,0x20,0x20,0x20,0x70,0x00,
-	0x10,0x00,0x30,0x10,0x10,0x10,0x90,0x60,
-	0x40,0x40,0x48,0x50,0x60,0x50,0x48,0x00,
-	0x60,0x20,0x20,0x20,0x20,0x20,0x70,0x00,
-	0x00,0x00,0xD0,0xA8,0xA8,0xA8,0xA8,0x00,
-	0x00,0x00,0xB0,0xC8,0x88,0x88,0x88,0x00,
-	0x00,0x00,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x00,0x00,0xB0,0xC8,0xC8,0xB0,0x80,0x80,
-	0x00,0x00,0x68,0x98,0x98,0x68,0x08,0x08,
-	0x00,0x00,0xB0,0xC8,0x80,0x80,0x80,0x00,
-	0x00,0x00,0x78,0x80,0x70,0x08,0xF0,0x00,
-	0x40,0x40,0xF0,0x40,0x40,0x48,0x30,0x00,
-	0x00,0x00,0x90,0x90,0x90,0x90,0x68,0x00,
-	0x00,0x00,0x88,0x88,0x88,0x50,0x20,0x00,
-	0x00,0x00,0x88,0xA8,0xA8,0xA8,0x50,0x00,
-	0x00,0x00,0x88,0x50,0x20,0x50,0x88,0x00,
-	0x00,0x00,0x88,0x88,0x98,0x68,0x08,0x70,
-	0x00,0x00,0xF8,0x10,0x20,0x40,0xF8,0x00     // 122 (z)
-#if 0
-	0x18,0x20,0x20,0x40,0x20,0x20,0x18,0x00,
-	0x20,0x20,0x20,0x00,0x20,0x20,0x20,0x00,
-	0xC0,0x20,0x20,0x10,0x20,0x20,0xC0,0x00,
-	0x40,0xA8,0x10,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x20,0x50,0xF8,0x00,0x00,0x00,
-	0x30,0x48,0x80,0x80,0x80,0x48,0x30,0x60,	// 128
-	0x50,0x00,0x90,0x90,0x90,0x90,0x68,0x00,
-	0x10,0x20,0x70,0x88,0xF8,0x80,0x70,0x00,
-	0x20,0x50,0x70,0x08,0x78,0x88,0x78,0x00,
-	0x10,0x20,0x20,0x50,0x88,0xF8,0x88,0x00,
-	0x40,0x20,0x70,0x08,0x78,0x88,0x78,0x00,
-	0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x70,0x88,0x80,0x88,0x70,0x20,
-	0x20,0x50,0x70,0x88,0xF8,0x80,0x70,0x00,	// 136
-	0x10,0x20,0x70,0x20,0x20,0x20,0x70,0x00,	// 137
-	0x10,0x20,0x70,0x88,0x88,0x88,0x70,0x00,	// 138
-	0x10,0x20,0x88,0x88,0x88,0x88,0x70,0x00,	// 139
-	0x20,0x50,0x20,0x50,0x88,0xF8,0x88,0x00,	// 140
-	0x01,0x02,0x04,0x08,0x10,0x20,0x40,0x80,	// 141 moved graphic tile 29 here
-	0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01,	// 142 moved graphic tile 30 here
-	0x00,0x10,0x10,0xFF,0x10,0x10,0x00,0x00,	// 143 moved graphic tile 31 here 
-	0x10,0x20,0xF8,0x80,0xF0,0x80,0xF8,0x00,	// 144
-	0x00,0x00,0x6C,0x12,0x7E,0x90,0x6E,0x00,
-	0x3E,0x50,0x90,0x9C,0xF0,0x90,0x9E,0x00,
-	0x20,0x50,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x50,0x00,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x40,0x20,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x20,0x50,0x00,0x90,0x90,0x90,0x68,0x00,
-	0x40,0x20,0x00,0x90,0x90,0x90,0x68,0x00,
-	0x50,0x00,0x88,0x88,0x98,0x68,0x08,0x70,
-	0x50,0x00,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x50,0x00,0x88,0x88,0x88,0x88,0x70,0x00,
-	0x20,0x20,0x78,0x80,0x80,0x78,0x20,0x20,
-	0x18,0x24,0x20,0xF8,0x20,0xE2,0x5C,0x00,
-	0x88,0x50,0x20,0xF8,0x20,0xF8,0x20,0x00,
-	0x60,0x80,0x9C,0x84,0x88,0x90,0x7C,0x00,
-	0x18,0x20,0x20,0xF8,0x20,0x20,0x20,0x40,
-	0x10,0x20,0x70,0x08,0x78,0x88,0x78,0x00,
-	0x10,0x20,0x00,0x60,0x20,0x20,0x70,0x00,
-	0x10,0x20,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x10,0x20,0x90,0x90,0x90,0x90,0x68,0x00,
-	0x28,0x50,0xB0,0xC8,0x88,0x88,0x88,0x00,
-	0x28,0x50,0x88,0xC8,0xA8,0x98,0x88,0x00,
-	0x60,0x90,0x90,0x68,0x00,0xF8,0x00,0x00,
-	0x60,0x90,0x90,0x60,0x00,0xF0,0x00,0x00,
-	0x20,0x00,0x20,0x40,0x80,0x88,0x70,0x00,
-	0x00,0x00,0x00,0xF8,0x80,0x80,0x00,0x00,
-	0x00,0x00,0x00,0xF8,0x08,0x08,0x00,0x00,
-	0x84,0x88,0x90,0xA8,0x54,0x84,0x08,0x1C,
-	0x84,0x88,0x90,0xA8,0x58,0xA8,0x3C,0x08,
-	0x20,0x00,0x00,0x20,0x20,0x20,0x20,0x00,
-	0x00,0x12,0x24,0x48,0x90,0x48,0x24,0x12,
-	0x00,0x90,0x48,0x24,0x12,0x24,0x48,0x90,
-	0x28,0x50,0x20,0x50,0x88,0xF8,0x88,0x00,
-	0x28,0x50,0x70,0x08,0x78,0x88,0x78,0x00,
-	0x28,0x50,0x00,0x70,0x20,0x20,0x70,0x00,
-	0x28,0x50,0x00,0x20,0x20,0x20,0x70,0x00,
-	0x28,0x50,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x28,0x50,0x70,0x88,0x88,0x88,0x70,0x00,
-	0x28,0x50,0x00,0x88,0x88,0x88,0x70,0x00,
-	0x28,0x50,0x00,0x90,0x90,0x90,0x68,0x00,
-	0xFC,0x48,0x48,0x48,0xE8,0x08,0x50,0x20,
-	0x00,0xA0,0x00,0xA0,0xA0,0xA0,0x20,0x40,
-	0xC0,0x44,0xC8,0x54,0xEC,0x54,0x9E,0x04,
-	0x10,0xA8,0x40,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x20,0x50,0x88,0x50,0x20,0x00,0x00,
-	0xC4,0xC8,0x10,0x20,0x40,0xB6,0x36,0x00,
-	0x7C,0xA8,0xA8,0x68,0x28,0x28,0x28,0x00,
-	0x38,0x40,0x30,0x48,0x48,0x30,0x08,0x70,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-	0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,
-	0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x3C,0x3C,0x00,0x00,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
-	0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
-	0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,
-	0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
-	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
-	0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,
-	0x11,0x22,0x44,0x88,0x11,0x22,0x44,0x88,
-	0x88,0x44,0x22,0x11,0x88,0x44,0x22,0x11,
-	0xFE,0x7C,0x38,0x10,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x10,0x38,0x7C,0xFE,
-	0x80,0xC0,0xE0,0xF0,0xE0,0xC0,0x80,0x00,
-	0x01,0x03,0x07,0x0F,0x07,0x03,0x01,0x00,
-	0xFF,0x7E,0x3C,0x18,0x18,0x3C,0x7E,0xFF,
-	0x81,0xC3,0xE7,0xFF,0xFF,0xE7,0xC3,0x81,
-	0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,
-	0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,
-	0x33,0x33,0xCC,0xCC,0x33,0x33,0xCC,0xCC,
-	0x00,0x20,0x20,0x50,0x50,0x88,0xF8,0x00,
-	0x20,0x20,0x70,0x20,0x70,0x20,0x20,0x00,
-	0x00,0x00,0x00,0x50,0x88,0xA8,0x50,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-	0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,
-	0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,
-	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x68,0x90,0x90,0x90,0x68,0x00,
-	0x30,0x48,0x48,0x70,0x48,0x48,0x70,0xC0,
-	0xF8,0x88,0x80,0x80,0x80,0x80,0x80,0x00,
-	0xF8,0x50,0x50,0x50,0x50,0x50,0x98,0x00,
-	0xF8,0x88,0x40,0x20,0x40,0x88,0xF8,0x00,
-	0x00,0x00,0x78,0x90,0x90,0x90,0x60,0x00,
-	0x00,0x50,0x50,0x50,0x50,0x68,0x80,0x80,
-	0x00,0x50,0xA0,0x20,0x20,0x20,0x20,0x00,
-	0xF8,0x20,0x70,0xA8,0xA8,0x70,0x20,0xF8,
-	0x20,0x50,0x88,0xF8,0x88,0x50,0x20,0x00,
-	0x70,0x88,0x88,0x88,0x50,0x50,0xD8,0x00,
-	0x30,0x40,0x40,0x20,0x50,0x50,0x50,0x20,
-	0x00,0x00,0x00,0x50,0xA8,0xA8,0x50,0x00,
-	0x08,0x70,0xA8,0xA8,0xA8,0x70,0x80,0x00,
-	0x38,0x40,0x80,0xF8,0x80,0x40,0x38,0x00,
-	0x70,0x88,0x88,0x88,0x88,0x88,0x88,0x00,
-	0x00,0x00,0xF0,0x00,0xF0,0x00,0xF0,0x00,
-	0x20,0x20,0xF8,0x20,0x20,0x00,0xF8,0x00,
-	0xC0,0x30,0x08,0x30,0xC0,0x00,0xF8,0x00,
-	0x18,0x60,0x80,0x60,0x18,0x00,0xF8,0x00,
-	0x10,0x28,0x20,0x20,0x20,0x20,0x20,0x20,
-	0x20,0x20,0x20,0x20,0x20,0x20,0xA0,0x40,
-	0x00,0x20,0x00,0xF8,0x00,0x20,0x00,0x00,
-	0x00,0x50,0xA0,0x00,0x50,0xA0,0x00,0x00,
-	0x00,0x18,0x24,0x24,0x18,0x00,0x00,0x00,
-	0x00,0x30,0x78,0x78,0x30,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,
-	0x3E,0x20,0x20,0x20,0xA0,0x60,0x20,0x00,
-	0xA0,0x50,0x50,0x50,0x00,0x00,0x00,0x00,
-	0x40,0xA0,0x20,0x40,0xE0,0x00,0x00,0x00,
-	0x00,0x38,0x38,0x38,0x38,0x38,0x38,0x00,
-	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF
-#endif
+// raw
+	 0x78,0x84,0xB4,0xA4,0xB4,0x84,0x78,0x00,0x1F,0x04,0x04,0x04,0x00,0x00,0x00,0x00,	// 00000000 x.....x......... //
+	 0x44,0x6C,0x54,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,	// 00000010 DlTT............ //
+	 0x20,0x20,0x20,0x20,0x00,0x00,0x20,0x00,0x50,0x50,0x50,0x00,0x00,0x00,0x00,0x00,	// 00000020     .. .PPP..... //
+	 0x50,0x50,0xF8,0x50,0xF8,0x50,0x50,0x00,0x20,0x78,0xA0,0x70,0x28,0xF0,0x20,0x00,	// 00000030 PP.P.PP. x.p(. . //
+	 0xC0,0xC8,0x10,0x20,0x40,0x98,0x18,0x00,0x40,0xA0,0x40,0xA8,0x90,0x98,0x60,0x00,	// 00000040 ... @...@.@...`. //
+	 0x10,0x20,0x40,0x00,0x00,0x00,0x00,0x00,0x10,0x20,0x40,0x40,0x40,0x20,0x10,0x00,	// 00000050 . @...... @@@ .. //
+	 0x40,0x20,0x10,0x10,0x10,0x20,0x40,0x00,0x20,0xA8,0x70,0x20,0x70,0xA8,0x20,0x00,	// 00000060 @ ... @. .p p. . //
+	 0x00,0x20,0x20,0xF8,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x20,0x40,	// 00000070 .  .  .......  @ //
+	 0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,	// 00000080 ...x.........``. //
+	 0x00,0x00,0x08,0x10,0x20,0x40,0x80,0x00,0x70,0x88,0x98,0xA8,0xC8,0x88,0x70,0x00,	// 00000090 .... @..p.....p. //
+	 0x20,0x60,0x20,0x20,0x20,0x20,0x70,0x00,0x70,0x88,0x08,0x10,0x60,0x80,0xF8,0x00,	// 000000A0  `    p.p...`... //
+	 0x70,0x88,0x08,0x30,0x08,0x88,0x70,0x00,0x10,0x30,0x50,0x90,0xF8,0x10,0x10,0x00,	// 000000B0 p..0..p..0P..... //
+	 0xF8,0x80,0xE0,0x10,0x08,0x10,0xE0,0x00,0x30,0x40,0x80,0xF0,0x88,0x88,0x70,0x00,	// 000000C0 ........0@....p. //
+	 0xF8,0x88,0x10,0x20,0x20,0x20,0x20,0x00,0x70,0x88,0x88,0x70,0x88,0x88,0x70,0x00,	// 000000D0 ...    .p..p..p. //
+	 0x70,0x88,0x88,0x78,0x08,0x10,0x60,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,	// 000000E0 p..x..`... .. .. //
+	 0x00,0x00,0x20,0x00,0x00,0x20,0x20,0x40,0x18,0x30,0x60,0xC0,0x60,0x30,0x18,0x00,	// 000000F0 .. ..  @.0`.`0.. //
+	 0x00,0x00,0xF8,0x00,0xF8,0x00,0x00,0x00,0xC0,0x60,0x30,0x18,0x30,0x60,0xC0,0x00,	// 00000100 .........`0.0`.. //
+	 0x70,0x88,0x08,0x10,0x20,0x00,0x20,0x00,0x70,0x88,0x08,0x48,0xA8,0xA8,0x70,0x00,	// 00000110 p... . .p..H..p. //
+	 0x20,0x50,0x88,0x88,0xF8,0x88,0x88,0x00,0xF0,0x48,0x48,0x70,0x48,0x48,0xF0,0x00,	// 00000120  P.......HHpHH.. //
+	 0x30,0x48,0x80,0x80,0x80,0x48,0x30,0x00,0xE0,0x50,0x48,0x48,0x48,0x50,0xE0,0x00,	// 00000130 0H...H0..PHHHP.. //
+	 0xF8,0x80,0x80,0xF0,0x80,0x80,0xF8,0x00,0xF8,0x80,0x80,0xF0,0x80,0x80,0x80,0x00,	// 00000140 ................ //
+	 0x70,0x88,0x80,0xB8,0x88,0x88,0x70,0x00,0x88,0x88,0x88,0xF8,0x88,0x88,0x88,0x00,	// 00000150 p.....p......... //
+	 0x70,0x20,0x20,0x20,0x20,0x20,0x70,0x00,0x38,0x10,0x10,0x10,0x90,0x90,0x60,0x00,	// 00000160 p     p.8.....`. //
+	 0x88,0x90,0xA0,0xC0,0xA0,0x90,0x88,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0xF8,0x00,	// 00000170 ................ //
+	 0x88,0xD8,0xA8,0xA8,0x88,0x88,0x88,0x00,0x88,0xC8,0xC8,0xA8,0x98,0x98,0x88,0x00,	// 00000180 ................ //
+	 0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0xF0,0x88,0x88,0xF0,0x80,0x80,0x80,0x00,	// 00000190 p.....p......... //
+	 0x70,0x88,0x88,0x88,0xA8,0x90,0x68,0x00,0xF0,0x88,0x88,0xF0,0xA0,0x90,0x88,0x00,	// 000001A0 p.....h......... //
+	 0x70,0x88,0x80,0x70,0x08,0x88,0x70,0x00,0xF8,0x20,0x20,0x20,0x20,0x20,0x20,0x00,	// 000001B0 p..p..p..      . //
+	 0x88,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x88,0x88,0x88,0x88,0x50,0x50,0x20,0x00,	// 000001C0 ......p.....PP . //
+	 0x88,0x88,0x88,0xA8,0xA8,0xD8,0x88,0x00,0x88,0x88,0x50,0x20,0x50,0x88,0x88,0x00,	// 000001D0 ..........P P... //
+	 0x88,0x88,0x88,0x70,0x20,0x20,0x20,0x00,0xF8,0x08,0x10,0x20,0x40,0x80,0xF8,0x00,	// 000001E0 ...p   .... @... //
+	 0x70,0x40,0x40,0x40,0x40,0x40,0x70,0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x08,0x00,	// 000001F0 p@@@@@p....@ ... //
+	 0x70,0x10,0x10,0x10,0x10,0x10,0x70,0x00,0x20,0x50,0x88,0x00,0x00,0x00,0x00,0x00,	// 00000200 p.....p. P...... //
+	 0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x80,0x40,0x20,0x00,0x00,0x00,0x00,0x00,	// 00000210 .........@ ..... //
+	 0x00,0x00,0x70,0x08,0x78,0x88,0x78,0x00,0x80,0x80,0xB0,0xC8,0x88,0xC8,0xB0,0x00,	// 00000220 ..p.x.x......... //
+	 0x00,0x00,0x70,0x88,0x80,0x88,0x70,0x00,0x08,0x08,0x68,0x98,0x88,0x98,0x68,0x00,	// 00000230 ..p...p...h...h. //
+	 0x00,0x00,0x70,0x88,0xF8,0x80,0x70,0x00,0x10,0x28,0x20,0xF8,0x20,0x20,0x20,0x00,	// 00000240 ..p...p..( .   . //
+	 0x00,0x00,0x68,0x98,0x98,0x68,0x08,0x70,0x80,0x80,0xF0,0x88,0x88,0x88,0x88,0x00,	// 00000250 ..h..h.p........ //
+	 0x20,0x00,0x60,0x20,0x20,0x20,0x70,0x00,0x10,0x00,0x30,0x10,0x10,0x10,0x90,0x60,	// 00000260  .`   p...0....` //
+	 0x40,0x40,0x48,0x50,0x60,0x50,0x48,0x00,0x60,0x20,0x20,0x20,0x20,0x20,0x70,0x00,	// 00000270 @@HP`PH.`     p. //
+	 0x00,0x00,0xD0,0xA8,0xA8,0xA8,0xA8,0x00,0x00,0x00,0xB0,0xC8,0x88,0x88,0x88,0x00,	// 00000280 ................ //
+	 0x00,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0xB0,0xC8,0xC8,0xB0,0x80,0x80,	// 00000290 ..p...p......... //
+	 0x00,0x00,0x68,0x98,0x98,0x68,0x08,0x08,0x00,0x00,0xB0,0xC8,0x80,0x80,0x80,0x00,	// 000002A0 ..h..h.......... //
+	 0x00,0x00,0x78,0x80,0x70,0x08,0xF0,0x00,0x40,0x40,0xF0,0x40,0x40,0x48,0x30,0x00,	// 000002B0 ..x.p...@@.@@H0. //
+	 0x00,0x00,0x90,0x90,0x90,0x90,0x68,0x00,0x00,0x00,0x88,0x88,0x88,0x50,0x20,0x00,	// 000002C0 ......h......P . //
+	 0x00,0x00,0x88,0xA8,0xA8,0xA8,0x50,0x00,0x00,0x00,0x88,0x50,0x20,0x50,0x88,0x00,	// 000002D0 ......P....P P.. //
+	 0x00,0x00,0x88,0x88,0x98,0x68,0x08,0x70,0x00,0x00,0xF8,0x10,0x20,0x40,0xF8,0x00 	// 000002E0 .....h.p.... @.. //
 };
 #endif
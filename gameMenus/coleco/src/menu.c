@@ -18,6 +18,7 @@
 #include "phoenix.h"
 #include "f18a.h"
 #include "joykey.h"
+#include "vdpqueue.h"
 #include "fatFs/ff.h"			/* Obtains integer types */
 #include "fatFs/diskio.h"		/* Declarations of disk functions */
 
@@ -26,6 +27,10 @@
 // fast memcpy, since we don't need delays on the F18A
 extern void vdpmemcpyfast(unsigned int pAddr, const unsigned char *pSrc, unsigned int cnt);
 #define vdpmemcpy vdpmemcpyfast
+extern void vdpmemsetfast(unsigned int pAddr, unsigned int ch, unsigned int cnt);
+#define vdpmemset vdpmemsetfast
+extern void vdpmemreadfast(unsigned int pAddr, unsigned char *pDest, unsigned int cnt);
+#define vdpmemread vdpmemreadfast
 
 // kscan wrapper
 extern void readkeypad();
@@ -113,7 +118,6 @@ unsigned char *sortedList[256];     // sorted pointers to filenames
 unsigned char listSize = 0;         // number of elements in sortedList
 unsigned char listOffset = 0;       // current list offset
 unsigned char listSelect = 0;       // current selection index
-unsigned char repeatTimeout;        // number of frames before autorepeat
 unsigned char firstScan = 0;        // during the first scan, we look for a Coleco folder and enter it
 unsigned char firstDir = 0;         // indicates we need to set up the display for the first time showing a directory
 
@@ -203,12 +207,12 @@ void dly_50us(unsigned char n)
 
 // clear the sprite layer
 void cleartextout() {
-    vdpmemset(GSPRITEPAT, 0, 16*4*8);
+    gpufill_f18a(GSPRITEPAT, 0, 16*4*8);
 }
 
 // clear the text screen
 void clrscr() {
-    vdpmemset(GIMAGE, ' ', 960);
+    gpufill_f18a(GIMAGE, ' ', 960);
 }
 
 // clear the text screen bottom three rows
@@ -431,26 +435,6 @@ repeatDir:
     }
 }
 
-// wait for joystick key to be released
-// there's a timeout to provide a crude auto-repeat
-void waitRelease() {
-    for (;;) {
-        readkeypad();
-        if ((MY_JOYY == 0) && (MY_JOYX == 0)) {
-            repeatTimeout = 45;     // hold this long before next repeat starts
-            break;
-        } else {
-            --repeatTimeout;
-            if (repeatTimeout == 0) {
-                repeatTimeout = 5;  // faster repeat if you keep holding
-                break;
-            }
-            // VDP vblank wait
-            waitVblanks(1);
-        }
-    }
-}
-
 // display the list of titles
 void drawTitles() {
     unsigned char idx;
@@ -668,17 +652,24 @@ void loadCartridgeRom() {
 }
 
 // copy 32k from phoenix page a to phoenix page b
+// the SRAM copy engine does this without the CPU, page n is at n*32k
 void copyPage(unsigned char a, unsigned char b) {
-    // since we already have loaded the program by this point,
-    // let's reuse path2 as a 512 byte buffer
-    unsigned char *off = (unsigned char*)0x8000;
-    while (off > 0) {   // watch for wrap around
-        phRAMBankSelect = a;
-        memcpy(path2, off, 512);
-        phRAMBankSelect = b;
-        memcpy(off, path2, 512);
-        off += 512;
-    }
+    phCopySrcLo = 0;
+    phCopySrcMid = a<<7;
+    phCopySrcHi = a>>1;
+    phCopyDstLo = 0;
+    phCopyDstMid = b<<7;
+    phCopyDstHi = b>>1;
+    phCopyLenLo = 0;
+    phCopyLenMid = 0x80;
+    phCopyLenHi = 0;
+    phCopyControl = PH_COPY_START;
+    while (phCopyControl & PH_COPY_BUSY) { }
+}
+
+// draw a bar across the bottom row showing cnt out of total steps
+void drawProgress(unsigned char cnt, unsigned char total) {
+    vdpmemset(GIMAGE+(40*23)+4, '=', ((unsigned int)cnt*32)/total);
 }
 
 // reads the rest of a Megacart into memory
@@ -686,9 +677,11 @@ void copyPage(unsigned char a, unsigned char b) {
 // note it's likely both the initial block reads are wasted
 // on return (failure), we return the page we reached, which
 // lets us decide whether to reload the directory
+
 unsigned char loadMegacartRom(unsigned char fsize) {
     unsigned char *p;
     unsigned char page;
+    unsigned char cnt;
     UINT br;
     FSIZE_t ofs;
 
@@ -718,22 +711,28 @@ unsigned char loadMegacartRom(unsigned char fsize) {
         return page;
     }
 
-    // - read in the cart as specified above
+    // - read in the cart as specified above, 16k at a time. Whole
+    // sectors are moved by the SD DMA, so we only wait for each
+    // chunk and update the progress bar.
+    DmaEnable = 1;
+    cnt = 0;
     for (;;) {
         FRESULT res;
 
-        res = f_read(&fil, p, 512, &br);
+        res = f_read(&fil, p, 0x4000, &br);
         if (res != FR_OK) {
+            DmaEnable = 0;
             f_close(&fil);
             displayErrorString("Cartridge load failed.", res);
             return page;
         }
-        if (br < 512) {
+        if (br < 0x4000) {
             // end of file
             break;
         }
         // else, keep reading
-        p+=512;
+        drawProgress(++cnt, fsize);
+        p+=0x4000;
         if (p < (unsigned char*)0x8000) {
             // time for the next page!
             ++page;
@@ -744,6 +743,7 @@ unsigned char loadMegacartRom(unsigned char fsize) {
                     break;
                 } else {
                     // we ran out of space
+                    DmaEnable = 0;
                     f_close(&fil);
                     displayErrorString("Megacart ROM too large", 0);
                     return page;
@@ -755,6 +755,7 @@ unsigned char loadMegacartRom(unsigned char fsize) {
         }
     }
 
+    DmaEnable = 0;
     f_close(&fil);
 
     // instead of the fixed size approach, we just set a register mask
@@ -816,7 +817,9 @@ void drawSelect() {
     attr = vdpreadchar(adr);            // get the current attribute (for text color)
     attr = (attr&0xf0) | COLORHILITE;    // highlight the background
     
-    vdpmemset(adr, attr, 40);           // write out the whole line the same
+    // write out the whole line the same at the next vblank - a queued
+    // fill on this line only changes the background, so the read is fine
+    vdpqFill(adr, attr, 40);
 }
 
 // erase the highlight on the current selection
@@ -838,7 +841,7 @@ void undrawSelect() {
 
     attr = vdpreadchar(adr);   // get the current attribute (for text color)
     attr = (attr&0xf0) | bg;    // highlight the background
-    vdpmemset(adr, attr, 40);  // write out the whole line the same
+    vdpqFill(adr, attr, 40);   // write out the whole line the same at the next vblank
 }
 
 // handle the user input to the menu
@@ -848,58 +851,72 @@ void undrawSelect() {
 //  -1/-2  = user paged the directory (redraw needed, indicates which stick)
 char getUserSelection() {
     unsigned int cntDown = BLANK_TIME;
+    JOYSTATE ev;
 
     // draw the selection bar
     drawSelect();
 
     // start the loop
     for (;;) {
-        unsigned char oldSelect;
         // if we lose the SD card, abort
         if (disk_status() == STA_NODISK) {
+            vdpqFlush();
             return 0;
         }
 
-        // VDP vblank wait
-        waitVblanks(1);
+        // keep the hot keys working (config menu and palette)
+        readkeypad();
 
-        // so we can check if we moved
-        oldSelect = listSelect;
+        // moves and presses come from the vblank sampler, which also does the
+        // autorepeat of a held stick (both sticks work)
+        if (!joyGetEvent(&ev)) {
+            // nothing to do, VDP vblank wait
+            waitVblanks(1);
 
-        // scan the joysticks (both work)
-        readkeypad();
+            // check if it's time to blank the screen
+            --cntDown;
+            if (cntDown == 0) {
+                // yes, it is
+                vdpqFlush();
+                handleBlanking(0xf2);
+                // the input that woke us up isn't a move
+                joyFlushEvents();
+                cntDown = BLANK_TIME;
+            }
+            continue;
+        }
 
-        if (MY_JOYY == JOY_UP) {
+        if (ev.joyy == JOY_UP) {
             if (listSelect > 0) {
                 undrawSelect();     // clear the highlight
                 --listSelect;       // count down
                 if (listSelect < listOffset) {
                     listOffset--;
+                    vdpqFlush();
                     return -1;      // request redraw
                 }
                 drawSelect();
             }
-            waitRelease();
             cntDown = BLANK_TIME;
             continue;
         }
 
-        if (MY_JOYY == JOY_DOWN) {
+        if (ev.joyy == JOY_DOWN) {
             if (listSelect < listSize-1) {
                 undrawSelect();
                 ++listSelect;
                 if (listSelect > listOffset+23) {
                     listOffset++;
+                    vdpqFlush();
                     return -1;      // request redraw
                 }
                 drawSelect();
             }
-            waitRelease();
             cntDown = BLANK_TIME;
             continue;
         }
 
-        if (MY_JOYX == JOY_RIGHT) {
+        if (ev.joyx == JOY_RIGHT) {
             if (listOffset+23 < listSize-1) {
                 // page ahead, restrict to 8-bits
                 unsigned char add = listSize-1-listOffset;
@@ -910,18 +927,18 @@ char getUserSelection() {
                     listOffset += 24;
                     listSelect += 24;
                 }
+                vdpqFlush();
                 return -1;          // request redraw
             } else {
                 undrawSelect();
                 listSelect = listSize-1;
                 drawSelect();
             }
-            waitRelease();
             cntDown = BLANK_TIME;
             continue;
         }
 
-        if (MY_JOYX == JOY_LEFT) {
+        if (ev.joyx == JOY_LEFT) {
             if (listOffset > 0) {
                 // page back, restrict to 8 bits
                 if (listOffset < 24) {
@@ -931,37 +948,23 @@ char getUserSelection() {
                     listOffset -=24;
                     listSelect -=24;
                 }
+                vdpqFlush();
                 return -1;          // request redraw
             } else {
                 undrawSelect();
                 listSelect = 0;
                 drawSelect();
             }
-            waitRelease();
             cntDown = BLANK_TIME;
             continue;
         }
 
         // check fire button
-        if (MY_KEY == JOY_FIRE) {
+        if (ev.key == JOY_FIRE) {
+            vdpqFlush();
             return 1;   // selected
         }
 
-        if (oldSelect == listSelect) {
-            // no joystick move, so reset the auto-repeat
-            // a little hacky here, but it will work.
-            repeatTimeout = 45;
-        }
-
-        // check if it's time to blank the screen
-        --cntDown;
-        if (cntDown == 0) {
-            // yes, it is
-            handleBlanking(0xf2);
-            cntDown = BLANK_TIME;
-            continue;
-        }
-
         // and repeat
     }
 }
@@ -1087,11 +1090,9 @@ drawLoop:
             break;
         }
 
-        // and if the user paged (or scrolled), then redraw
+        // and if the user paged (or scrolled), then redraw - autorepeat
+        // comes from the vblank sampler
         drawTitles();
-
-        // and then wait for the autorepeat
-        waitRelease();
     }
 
     // in the event that the SD card was removed, jump back up
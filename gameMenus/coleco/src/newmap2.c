@@ -1,221 +1,131 @@
-//****************************************
-//* Character Patterns 
-//* these have been hand-manipulated from
-//* from Magellen to make the color layout
-//* consistent (some chars were inverted) 
-//****************************************
-// 
-// Basic RLE compression applied to PAT0
-// top two msbits are flags:
-// 00 - run of zeros
-// 01 - run of 0xff
-// 10 - run of next char
-// 11 - inline string
-// least significant 6 bits are the length
+// Generated by mkasset, edit the source images instead
 //
-// This RLE beat lz4 on the pattern table, so I'll take it.
+// PAT0: rle from ../assets/pat0.bin
+// MD0_LOGO: raw from ../assets/logo.bin
+// MD0_PHOENIX: raw from ../assets/phoenix.bin
 
 #ifdef HEADERS__
 extern const unsigned char PAT0[];
+#define SIZE_OF_PAT0RLE 1275
 extern const unsigned char MD0_LOGO[];
+#define SIZE_OF_MD0_LOGO 269
 extern const unsigned char MD0_PHOENIX[];
-#define SIZE_OF_PAT0RLE 1299
+#define SIZE_OF_MD0_PHOENIX 128
 #else
 const unsigned char PAT0[] = {
 // RLE encoded
-     0xC0,0x7E,0x85,0x18,0x00,0x85,0xC6,0xC2,0x7C,0x00,0xFC,0x82,0xC6,0xCB,0xFC,0xCC,   // 00000000 .~......|....... //
-     0xC6,0x00,0x7C,0xC6,0xC0,0x7C,0x06,0xC6,0x7C,0x00,0x86,0x18,0x08,0x82,0xC6,0xC5,   // 00000010 ..|..|..|....... //
-     0xD6,0xFE,0xEE,0xC6,0x00,0x7C,0x82,0xC6,0xCA,0xFE,0xC6,0xC6,0x00,0x7C,0xC6,0xC0,   // 00000020 .....|.......|.. //
-     0x7C,0x06,0xC6,0x7C,0x08,0x82,0xC6,0xC0,0xFE,0x82,0xC6,0xC9,0x00,0xFE,0xC0,0xC0,   // 00000030 |..|............ //
-     0xFC,0xC0,0xC0,0xFE,0x00,0xFC,0x82,0xC6,0xCD,0xFC,0xCC,0xC6,0x00,0xFE,0xC0,0xC0,   // 00000040 ................ //
-     0xFC,0xC0,0xC0,0xFE,0x00,0x07,0x01,0x02,0xC4,0x11,0x0F,0x07,0xC0,0xE0,0x83,0xF0,   // 00000050 ................ //
-     0xC5,0xE0,0xC0,0xFE,0xC0,0xC0,0xFC,0x82,0xC0,0xC1,0x00,0x7C,0x84,0xC6,0xC2,0x7C,	// 00000060 ...........|...| //
-	 0x00,0xFC,0x82,0xC6,0xC2,0xFC,0xCC,0xC6,0x08,0x85,0x60,0xC1,0x7E,0x00,0x85,0xC6,	// 00000070 ..........`.~... //
-	 0xCA,0x7C,0x00,0xC6,0xE6,0xF6,0xDE,0xCE,0xC6,0xC6,0x00,0x7C,0x82,0xC6,0xC2,0xFE,	// 00000080 .|.........|.XXX //
-	 0xC6,0xC6,0x08,0x46,0xC0,0x80,0x46,0xC1,0x00,0xFE,0x45,0xC5,0x7F,0x07,0x07,0x87,	// 00000090 ...F..F...E..... //
-	 0xC7,0xC7,0x82,0xE7,0x87,0xFE,0x88,0x01,0xC2,0x87,0x87,0x8F,0x83,0x9F,0x4E,0xC2,	// 000000A0 ..............N. //
-	 0xF0,0xF8,0xFE,0x45,0x82,0x0F,0xC1,0x8F,0x8F,0x82,0xCF,0x46,0x86,0xFC,0xC1,0xF8,	// 000000B0 ...E.......F.... //
-	 0x00,0x46,0xC4,0x0F,0x81,0xE1,0xF1,0xF1,0x83,0xF9,0xC4,0x8F,0x87,0x83,0x81,0x81,	// 000000C0 .F.............. //
-	 0x82,0x80,0xC0,0xFE,0x44,0xCF,0x7F,0x3F,0x00,0x00,0x80,0x80,0xC0,0xE0,0xF0,0xF9,	// 000000D0 ....D..?........ //
-	 0x07,0x0F,0x1F,0x3F,0x7F,0x7F,0x42,0xC6,0xFE,0xFC,0xF8,0xF0,0xE0,0xE0,0xC0,0x42,	// 000000E0 ...?..B........B //
-	 0x84,0x80,0x42,0x04,0xC2,0xFF,0xFF,0xFC,0x04,0xC0,0x87,0x86,0x07,0x42,0x84,0xFE,	// 000000F0 ..B..........B.. //
-	 0x42,0x84,0x01,0x87,0x9F,0x85,0xF0,0x41,0x05,0x41,0x85,0x7F,0x41,0x87,0xCF,0x41,	// 00000100 B......A.A..A..A //
-	 0x83,0xFC,0x43,0x03,0xC3,0xFF,0xFF,0xF0,0xF0,0x03,0xC1,0xF8,0xFC,0x87,0x80,0x87,	// 00000110 ..C............. //
-	 0x0F,0x87,0xF9,0x86,0x80,0xC6,0x81,0x07,0x0F,0x1F,0x1F,0x3F,0x7F,0x45,0xC3,0xF9,	// 00000120 ...........?.E.. //
-	 0xF1,0xF0,0xE0,0x02,0xC4,0x80,0xC0,0xE0,0xE0,0xF0,0x83,0x80,0x43,0x03,0x43,0x83,	// 00000130 ............C.C. //
-	 0x7F,0x43,0x85,0xE7,0xC1,0xC7,0xC7,0x83,0xFE,0x43,0x83,0x01,0x43,0x87,0xF0,0x87,	// 00000140 .C.......C..C... //
-	 0x7F,0x82,0xFC,0x44,0x02,0x44,0x02,0xC0,0xE0,0x83,0xF0,0xCB,0x1F,0x0F,0x07,0x07,	// 00000150 ...D.D.......... //
-	 0x03,0x01,0x01,0x03,0xFF,0xFF,0xFE,0xFC,0x82,0xF8,0xC1,0xFC,0x80,0x06,0x44,0x02,	// 00000160 ..............D. //
-	 0x84,0x80,0x02,0x84,0x07,0x02,0x83,0xFE,0xC0,0xFC,0x02,0x84,0x01,0x02,0xC4,0x9F,	// 00000170 ................ //
-	 0x8F,0x8F,0x87,0x01,0x02,0x42,0xC1,0xFE,0xFC,0x02,0xC3,0x87,0x87,0x03,0x01,0x03,	// 00000180 .....B.......... //
-	 0x43,0xC0,0x7F,0x02,0x83,0xFC,0xC0,0xF8,0x02,0x84,0x0F,0x02,0x84,0xF9,0x02,0xC4,	// 00000190 C............... //
-	 0x81,0x83,0x87,0x8F,0x8F,0x02,0x43,0xC0,0xFE,0x02,0xC2,0xC0,0x80,0x80,0x04,0xC4,	// 000001A0 ......C......... //
-	 0x3F,0x3F,0x1F,0x0F,0x07,0x02,0xC4,0xF8,0xFC,0xFE,0xFE,0xFF,0x02,0x77,0x07,0xC2,	// 000001B0 ??...........w.. //
-	 0x3F,0x7F,0x7F,0x84,0x3F,0xC1,0xFE,0xFE,0x45,0x03,0xC3,0x80,0xF0,0xFC,0xFC,0x04,	// 000001C0 ?...?...E....... //
-	 0xC2,0x01,0x01,0x07,0x4A,0x84,0xFE,0xC0,0x80,0x06,0xC0,0x7F,0x86,0x3F,0xC7,0x83,	// 000001D0 ....J........?.. //
-	 0x81,0xC1,0xC1,0xA0,0xA0,0x80,0xC0,0x84,0xF8,0xC2,0xFC,0x7C,0x7C,0x05,0xC1,0x01,	// 000001E0 ...........||... //
-	 0x01,0x02,0xC5,0x01,0x03,0x8F,0xFF,0xFF,0x7F,0x46,0xC2,0xF0,0xF8,0xFC,0x44,0xC2,	// 000001F0 .........F....D. //
-	 0x00,0x00,0x7E,0x44,0x04,0xC2,0x80,0xC0,0xC0,0x03,0xC5,0x01,0x03,0x0F,0x1F,0x3F,	// 00000200 ..~D...........? //
-	 0x7F,0x42,0xCA,0xFE,0xFC,0xF8,0xF0,0xE0,0xC0,0xC1,0x80,0x00,0x01,0x01,0x02,0xC4,	// 00000210 .B.............. //
-	 0x80,0xF0,0xF0,0xE0,0xE0,0x83,0x0F,0x83,0x07,0xD1,0xF0,0xF8,0xF8,0xFC,0xFE,0xF9,	// 00000220 ................ //
-	 0xE1,0xE0,0xF0,0x78,0x28,0x14,0x08,0x04,0x80,0xC0,0x03,0x01,0x05,0x42,0xC5,0x1F,	// 00000230 ...x(........B.. //
-	 0x0F,0x03,0x01,0x00,0x8F,0x4D,0xCB,0xFE,0xFE,0xF8,0xF0,0xE0,0xC0,0x80,0x00,0x00,	// 00000240 .....M.......... //
-	 0x03,0x07,0x07,0x03,0xCB,0x01,0xF0,0xC1,0x03,0x07,0x0F,0x3F,0xFF,0xFF,0xF8,0xF9,	// 00000250 ...........?.... //
-	 0xF9,0x49,0xC7,0xFE,0xFE,0xFC,0xFE,0xFE,0xFC,0x98,0x10,0x02,0xC7,0x33,0x40,0x80,	// 00000260 .I...........3@. //
-	 0x00,0x00,0x01,0x03,0x07,0x83,0x7F,0x43,0xC1,0xF0,0xFC,0x45,0xC2,0x1F,0x1F,0x0F,	// 00000270 .......C...E.... //
-	 0x82,0x1F,0xC5,0x01,0x00,0xFE,0xFF,0xFE,0xFE,0x43,0xC8,0x60,0x30,0x98,0x4C,0x22,	// 00000280 .........C.`0.L" //
-	 0x80,0xC0,0x80,0x07,0x06,0xC0,0x10,0x06,0xC1,0x1F,0x1C,0x05,0xC0,0xE0,0x0B,0xC7,	// 00000290 ................ //
-	 0x01,0x07,0x1F,0x05,0x03,0x07,0x1F,0x7F,0x42,0xC1,0xC0,0xC0,0x82,0x80,0x02,0x86,	// 000002A0 ........B....... //
-	 0x01,0xC8,0x00,0xFE,0xFC,0xFE,0xFC,0xFE,0xFF,0xFF,0x1F,0x02,0xC4,0x08,0x01,0x80,	// 000002B0 ................ //
-	 0xC0,0xF8,0x04,0xC0,0x20,0x06,0xCA,0x07,0x00,0x00,0x1E,0x78,0x07,0x1F,0xFF,0x8F,	// 000002C0 .... ......x.... //
-	 0x1F,0xE7,0x44,0xC6,0xFE,0xFC,0xF8,0x80,0xC0,0x80,0x80,0x03,0x83,0x07,0xC4,0x0F,	// 000002D0 ..D............. //
-	 0x0F,0x06,0x00,0xFC,0x44,0xC3,0x7F,0x7F,0x00,0x00,0x45,0x02,0xC4,0xF8,0xF8,0xF0,	// 000002E0 ....D.....E..... //
-	 0xF8,0xF8,0x02,0xC4,0x04,0x06,0x07,0x07,0x03,0x04,0xC6,0x81,0xF1,0xFF,0x00,0x00,	// 000002F0 ................ //
-	 0xF0,0xFE,0x43,0xC3,0x0F,0x0F,0x7F,0x3F,0x48,0xC2,0xF1,0xC0,0x80,0x43,0xCC,0xF1,	// 00000300 ..C....?H....C.. //
-	 0xE0,0x00,0x00,0xFE,0xFE,0xFC,0xF8,0xF8,0xF0,0x00,0x00,0x3C,0x06,0x82,0x07,0x84,	// 00000310 ...........<.... //
-	 0x03,0x87,0xF0,0x03,0xC5,0x70,0x70,0x78,0x78,0x00,0x01,0x05,0xCA,0xC0,0xC0,0xD0,	// 00000320 .....ppxx....... //
-	 0xD0,0xD3,0xF3,0xFB,0x7B,0xFF,0x7F,0x7F,0x44,0xC0,0xC0,0x82,0x80,0x83,0xC0,0xC0,	// 00000330 ....{...D....... //
-	 0x01,0x06,0xC7,0xFF,0xCF,0x0F,0x07,0x07,0x03,0x01,0x00,0x42,0xC7,0xFE,0xFC,0xF8,	// 00000340 ...........B.... //
-	 0xE0,0x00,0xFF,0x8F,0x07,0x04,0xC4,0xFF,0xFF,0x3F,0x1F,0x0F,0x03,0x82,0x80,0x08,	// 00000350 .........?...... //
-	 0xC2,0x0F,0x0F,0x1F,0x03,0xC3,0x06,0x1E,0xFE,0xFE,0x02,0xC4,0x18,0x3E,0x7F,0x7F,	// 00000360 .............>.. //
-	 0xFF,0x02,0xC1,0x04,0x0E,0x42,0x05,0xC3,0xC0,0xC0,0x3F,0x3F,0x84,0x7F,0xC4,0x3F,	// 00000370 .....B....??...? //
-	 0xFF,0xFF,0xCF,0x8F,0x82,0xC7,0xC0,0xC3,0x84,0xFC,0xCA,0xFE,0xFE,0xFF,0x00,0x00,	// 00000380 ................ //
-	 0x08,0x0C,0x1C,0x3C,0x7E,0x7F,0x06,0xC0,0xE0,0x82,0x3F,0x82,0x1F,0xC1,0x3F,0x3F,	// 00000390 ...<~.....?...?? //
-	 0x45,0xC3,0xFC,0xF0,0xFE,0xFE,0x83,0xFC,0xC2,0x7E,0x7E,0x0F,0x86,0x1F,0x45,0xD5,	// 000003A0 E........~~...E. //
-	 0xF1,0xF0,0xC0,0xE0,0xE0,0xD0,0xC0,0xE0,0xE0,0xF0,0x3E,0x3F,0x1F,0x1F,0x0F,0x0F,	// 000003B0 ..........>?.... //
-	 0x07,0x07,0x00,0x00,0xFC,0xFC,0x82,0xFE,0x40,0x05,0xC0,0x01,0x84,0x03,0xC2,0x07,	// 000003C0 ........@....... //
-	 0x07,0x0F,0x44,0xC7,0xFC,0xF0,0xC0,0x00,0xFF,0xFF,0xFE,0xB8,0x02,0xC8,0x01,0xFF,	// 000003D0 ..D............. //
-	 0x87,0x03,0x0F,0x1F,0x7F,0xFF,0xFD,0x82,0xE0,0x83,0xF0,0xC0,0xF8,0x02,0xC7,0x01,	// 000003E0 ................ //
-	 0x1F,0x7F,0xFF,0xFF,0x1F,0x3F,0x7F,0x44,0xCF,0xF8,0xF0,0xF0,0xE0,0xC0,0x80,0x80,	// 000003F0 .....?.D........ //
-	 0x00,0x03,0x03,0x07,0x07,0x0F,0x0F,0x1F,0x3F,0x87,0xE0,0xC0,0x3F,0x44,0xEC,0x7F,	// 00000400 ........?...?D.. //
-	 0x3F,0xE0,0xF0,0xF8,0xFC,0xFE,0xFF,0xF9,0xFC,0x60,0x30,0x18,0x0C,0x06,0x00,0x80,	// 00000410 ?........`0..... //
-	 0xC0,0x7F,0x3F,0x1F,0x0F,0x03,0x01,0x00,0x00,0xFC,0xF8,0xF9,0xFB,0xFF,0x3F,0x3F,	// 00000420 ..?...........?? //
-	 0x0F,0x00,0x40,0xE0,0xF4,0xFC,0xFC,0xF8,0xF8,0x07,0x1F,0x7F,0x42,0xC1,0xDF,0x1F,	// 00000430 ..@.........B... //
-	 0x45,0xC1,0xFE,0xF8,0x43,0xC7,0xFE,0xFC,0xF0,0x00,0xF8,0xE0,0xC0,0x80,0x03,0xCF,	// 00000440 E...C........... //
-	 0x07,0x0F,0x1E,0x3C,0x78,0x01,0x01,0x02,0xFF,0xFF,0x7F,0x7F,0xFF,0xFF,0xBF,0x7F,	// 00000450 ...<x........... //
-	 0x44,0xC2,0xF3,0xF1,0xE1,0x82,0x80,0x82,0xC0,0xC4,0x80,0x80,0xFF,0xFF,0x03,0x84,	// 00000460 D............... //
-	 0x01,0x82,0x80,0xC7,0xC0,0xE0,0xF8,0xFC,0xFE,0x00,0x01,0x01,0x04,0xC2,0xFF,0xFF,	// 00000470 ................ //
-	 0x81,0x02,0xCC,0x01,0x07,0xEF,0xDF,0x3F,0x7F,0x7F,0xFF,0xBF,0x3F,0xFF,0xFE,0xFE,	// 00000480 .......?....?... //
-	 0x44,0x06,0xC2,0x80,0x1F,0x1F,0x82,0x0F,0x82,0x07,0xC3,0xFE,0xF7,0xF0,0xF0,0x82,	// 00000490 D............... //
-	 0xF8,0xC5,0xFC,0x30,0x86,0x00,0x00,0x04,0x07,0xCC,0x06,0x00,0x07,0x1F,0x38,0x03,	// 000004A0 ...0..........8. //
-	 0x3F,0x7F,0x3F,0x1F,0xFF,0x87,0x1F,0x45,0xC1,0xF0,0xF0,0x82,0xE0,0xC2,0xE3,0xFF,	// 000004B0 ?.?....E........ //
-	 0xFF,0x83,0x3F,0xC3,0x3E,0x3E,0x7E,0x7E,0x42,0xC5,0x7F,0x3F,0x1F,0x0F,0x0F,0xE1,	// 000004C0 ..?.>>~~B..?.... //
-	 0x46,0x86,0xF8,0xC5,0xF0,0x03,0x03,0x01,0x81,0x81,0x82,0x80,0x45,0xC5,0xE6,0xC6,	// 000004D0 F...........E... //
-	 0xFF,0xF1,0xC0,0x80,0x03,0x42,0xC1,0xFE,0x3C,0x02,0x82,0x03,0xC1,0x01,0x01,0x02,	// 000004E0 .....B..<....... //
-	 0x45,0xC5,0x3F,0x03,0xE0,0xE0,0xF8,0xF8,0x43,0xC4,0x78,0xF8,0xF9,0xFD,0xFD,0x42,	// 000004F0 E.?.....C.x....B //
-	 0xC9,0x00,0x00,0x20,0x30,0x90,0x9C,0xFD,0xFF,0x7F,0x7F,0x46,0x82,0xFE,0xC3,0xFC,	// 00000500 ... 0......F.... //
-	 0xF8,0xF0,0xC0 																	// 00000510 ... //
+	 0x80,0x7E,0x85,0x18,0x00,0x85,0xC6,0xC2,0x7C,0x00,0xFC,0x82,0xC6,0xCA,0xFC,0xCC,	// 00000000 .~......|....... //
+	 0xC6,0x00,0x7C,0xC6,0xC0,0x7C,0x06,0xC6,0x7C,0x00,0x86,0x18,0x08,0x82,0xC6,0xC5,	// 00000010 ..|..|..|....... //
+	 0xD6,0xFE,0xEE,0xC6,0x00,0x7C,0x82,0xC6,0xCA,0xFE,0xC6,0xC6,0x00,0x7C,0xC6,0xC0,	// 00000020 .....|.......|.. //
+	 0x7C,0x06,0xC6,0x7C,0x08,0x82,0xC6,0x80,0xFE,0x82,0xC6,0x00,0xC8,0xFE,0xC0,0xC0,	// 00000030 |..|............ //
+	 0xFC,0xC0,0xC0,0xFE,0x00,0xFC,0x82,0xC6,0xCD,0xFC,0xCC,0xC6,0x00,0xFE,0xC0,0xC0,	// 00000040 ................ //
+	 0xFC,0xC0,0xC0,0xFE,0x00,0x07,0x01,0x02,0xC4,0x11,0x0F,0x07,0xC0,0xE0,0x83,0xF0,	// 00000050 ................ //
+	 0xC5,0xE0,0xC0,0xFE,0xC0,0xC0,0xFC,0x82,0xC0,0x00,0x80,0x7C,0x84,0xC6,0xC2,0x7C,	// 00000060 ...........|...| //
+	 0x00,0xFC,0x82,0xC6,0xC2,0xFC,0xCC,0xC6,0x08,0x85,0x60,0x80,0x7E,0x00,0x85,0xC6,	// 00000070 ..........`.~... //
+	 0xCA,0x7C,0x00,0xC6,0xE6,0xF6,0xDE,0xCE,0xC6,0xC6,0x00,0x7C,0x82,0xC6,0x80,0xFE,	// 00000080 .|.........|.... //
+	 0x81,0xC6,0x08,0x46,0x80,0x80,0x46,0x00,0x80,0xFE,0x45,0xC3,0x7F,0x07,0x07,0x87,	// 00000090 ...F..F...E..... //
+	 0x81,0xC7,0x82,0xE7,0x87,0xFE,0x88,0x01,0x81,0x87,0x80,0x8F,0x83,0x9F,0x4E,0xC2,	// 000000A0 ..............N. //
+	 0xF0,0xF8,0xFE,0x45,0x82,0x0F,0x81,0x8F,0x82,0xCF,0x46,0x86,0xFC,0x80,0xF8,0x00,	// 000000B0 ...E......F..... //
+	 0x46,0xC2,0x0F,0x81,0xE1,0x81,0xF1,0x83,0xF9,0xC2,0x8F,0x87,0x83,0x81,0x81,0x82,	// 000000C0 F............... //
+	 0x80,0x80,0xFE,0x44,0xC1,0x7F,0x3F,0x01,0x81,0x80,0xC7,0xC0,0xE0,0xF0,0xF9,0x07,	// 000000D0 ...D..?......... //
+	 0x0F,0x1F,0x3F,0x81,0x7F,0x42,0xC6,0xFE,0xFC,0xF8,0xF0,0xE0,0xE0,0xC0,0x42,0x84,	// 000000E0 ..?..B........B. //
+	 0x80,0x42,0x04,0x41,0x80,0xFC,0x04,0x80,0x87,0x86,0x07,0x42,0x84,0xFE,0x42,0x84,	// 000000F0 .B.A.......B..B. //
+	 0x01,0x87,0x9F,0x85,0xF0,0x41,0x05,0x41,0x85,0x7F,0x41,0x87,0xCF,0x41,0x83,0xFC,	// 00000100 .....A.A..A..A.. //
+	 0x43,0x03,0x41,0x81,0xF0,0x03,0xC1,0xF8,0xFC,0x87,0x80,0x87,0x0F,0x87,0xF9,0x86,	// 00000110 C.A............. //
+	 0x80,0xC6,0x81,0x07,0x0F,0x1F,0x1F,0x3F,0x7F,0x45,0xC3,0xF9,0xF1,0xF0,0xE0,0x02,	// 00000120 .......?.E...... //
+	 0xC4,0x80,0xC0,0xE0,0xE0,0xF0,0x83,0x80,0x43,0x03,0x43,0x83,0x7F,0x43,0x85,0xE7,	// 00000130 ........C.C..C.. //
+	 0x81,0xC7,0x83,0xFE,0x43,0x83,0x01,0x43,0x87,0xF0,0x87,0x7F,0x82,0xFC,0x44,0x02,	// 00000140 ....C..C......D. //
+	 0x44,0x02,0x80,0xE0,0x83,0xF0,0xC7,0x1F,0x0F,0x07,0x07,0x03,0x01,0x01,0x03,0x41,	// 00000150 D..............A //
+	 0xC1,0xFE,0xFC,0x82,0xF8,0xC1,0xFC,0x80,0x06,0x44,0x02,0x84,0x80,0x02,0x84,0x07,	// 00000160 .........D...... //
+	 0x02,0x83,0xFE,0x80,0xFC,0x02,0x84,0x01,0x02,0xC4,0x9F,0x8F,0x8F,0x87,0x01,0x02,	// 00000170 ................ //
+	 0x42,0xC1,0xFE,0xFC,0x02,0x81,0x87,0xC1,0x03,0x01,0x03,0x43,0x80,0x7F,0x02,0x83,	// 00000180 B..........C.... //
+	 0xFC,0x80,0xF8,0x02,0x84,0x0F,0x02,0x84,0xF9,0x02,0xC2,0x81,0x83,0x87,0x81,0x8F,	// 00000190 ................ //
+	 0x02,0x43,0x80,0xFE,0x02,0x80,0xC0,0x81,0x80,0x04,0x81,0x3F,0xC2,0x1F,0x0F,0x07,	// 000001A0 .C.........?.... //
+	 0x02,0xC1,0xF8,0xFC,0x81,0xFE,0x40,0x02,0x77,0x07,0x80,0x3F,0x81,0x7F,0x84,0x3F,	// 000001B0 ......@.w..?...? //
+	 0x81,0xFE,0x45,0x03,0xC1,0x80,0xF0,0x81,0xFC,0x04,0x81,0x01,0x80,0x07,0x4A,0x84,	// 000001C0 ..E...........J. //
+	 0xFE,0x80,0x80,0x06,0x80,0x7F,0x86,0x3F,0xC7,0x83,0x81,0xC1,0xC1,0xA0,0xA0,0x80,	// 000001D0 .......?........ //
+	 0xC0,0x84,0xF8,0x80,0xFC,0x81,0x7C,0x05,0x81,0x01,0x02,0xC2,0x01,0x03,0x8F,0x41,	// 000001E0 ......|........A //
+	 0x80,0x7F,0x46,0xC2,0xF0,0xF8,0xFC,0x44,0x01,0x80,0x7E,0x44,0x04,0x80,0x80,0x81,	// 000001F0 ..F....D..~D.... //
+	 0xC0,0x03,0xC5,0x01,0x03,0x0F,0x1F,0x3F,0x7F,0x42,0xC7,0xFE,0xFC,0xF8,0xF0,0xE0,	// 00000200 .......?.B...... //
+	 0xC0,0xC1,0x80,0x00,0x81,0x01,0x02,0x80,0x80,0x81,0xF0,0x81,0xE0,0x83,0x0F,0x83,	// 00000210 ................ //
+	 0x07,0xD1,0xF0,0xF8,0xF8,0xFC,0xFE,0xF9,0xE1,0xE0,0xF0,0x78,0x28,0x14,0x08,0x04,	// 00000220 ...........x(... //
+	 0x80,0xC0,0x03,0x01,0x05,0x42,0xC5,0x1F,0x0F,0x03,0x01,0x00,0x8F,0x4D,0x81,0xFE,	// 00000230 .....B.......M.. //
+	 0xC4,0xF8,0xF0,0xE0,0xC0,0x80,0x01,0x80,0x03,0x81,0x07,0x03,0xC6,0x01,0xF0,0xC1,	// 00000240 ................ //
+	 0x03,0x07,0x0F,0x3F,0x41,0x80,0xF8,0x81,0xF9,0x49,0x81,0xFE,0xC5,0xFC,0xFE,0xFE,	// 00000250 ...?A....I...... //
+	 0xFC,0x98,0x10,0x02,0xC2,0x33,0x40,0x80,0x01,0xC2,0x01,0x03,0x07,0x83,0x7F,0x43,	// 00000260 .....3@........C //
+	 0xC1,0xF0,0xFC,0x45,0x81,0x1F,0x80,0x0F,0x82,0x1F,0xC2,0x01,0x00,0xFE,0x40,0x81,	// 00000270 ...E..........@. //
+	 0xFE,0x43,0xC8,0x60,0x30,0x98,0x4C,0x22,0x80,0xC0,0x80,0x07,0x06,0x80,0x10,0x06,	// 00000280 .C.`0.L"........ //
+	 0xC1,0x1F,0x1C,0x05,0x80,0xE0,0x0B,0xC7,0x01,0x07,0x1F,0x05,0x03,0x07,0x1F,0x7F,	// 00000290 ................ //
+	 0x42,0x81,0xC0,0x82,0x80,0x02,0x86,0x01,0x00,0xC4,0xFE,0xFC,0xFE,0xFC,0xFE,0x41,	// 000002A0 B..............A //
+	 0x80,0x1F,0x02,0xC4,0x08,0x01,0x80,0xC0,0xF8,0x04,0x80,0x20,0x06,0x80,0x07,0x01,	// 000002B0 ........... .... //
+	 0xC7,0x1E,0x78,0x07,0x1F,0xFF,0x8F,0x1F,0xE7,0x44,0xC4,0xFE,0xFC,0xF8,0x80,0xC0,	// 000002C0 ..x......D...... //
+	 0x81,0x80,0x03,0x83,0x07,0x81,0x0F,0xC2,0x06,0x00,0xFC,0x44,0x81,0x7F,0x01,0x45,	// 000002D0 ...........D...E //
+	 0x02,0x81,0xF8,0x80,0xF0,0x81,0xF8,0x02,0xC4,0x04,0x06,0x07,0x07,0x03,0x04,0xC1,	// 000002E0 ................ //
+	 0x81,0xF1,0x40,0x01,0xC1,0xF0,0xFE,0x43,0x81,0x0F,0xC1,0x7F,0x3F,0x48,0xC2,0xF1,	// 000002F0 ..@....C....?H.. //
+	 0xC0,0x80,0x43,0xC1,0xF1,0xE0,0x01,0x81,0xFE,0xC3,0xFC,0xF8,0xF8,0xF0,0x01,0x80,	// 00000300 ..C............. //
+	 0x3C,0x06,0x82,0x07,0x84,0x03,0x87,0xF0,0x03,0x81,0x70,0x81,0x78,0x00,0x80,0x01,	// 00000310 <.........p.x... //
+	 0x05,0x81,0xC0,0x81,0xD0,0xC3,0xD3,0xF3,0xFB,0x7B,0x40,0x81,0x7F,0x44,0x80,0xC0,	// 00000320 .........{@..D.. //
+	 0x82,0x80,0x83,0xC0,0x80,0x01,0x06,0x40,0xC5,0xCF,0x0F,0x07,0x07,0x03,0x01,0x00,	// 00000330 .......@........ //
+	 0x42,0xC7,0xFE,0xFC,0xF8,0xE0,0x00,0xFF,0x8F,0x07,0x04,0x41,0xC2,0x3F,0x1F,0x0F,	// 00000340 B..........A.?.. //
+	 0x03,0x82,0x80,0x08,0x81,0x0F,0x80,0x1F,0x03,0xC1,0x06,0x1E,0x81,0xFE,0x02,0xC1,	// 00000350 ................ //
+	 0x18,0x3E,0x81,0x7F,0x40,0x02,0xC1,0x04,0x0E,0x42,0x05,0x81,0xC0,0x81,0x3F,0x84,	// 00000360 .>..@....B....?. //
+	 0x7F,0x80,0x3F,0x41,0xC1,0xCF,0x8F,0x82,0xC7,0x80,0xC3,0x84,0xFC,0x81,0xFE,0x40,	// 00000370 ..?A...........@ //
+	 0x01,0xC5,0x08,0x0C,0x1C,0x3C,0x7E,0x7F,0x06,0x80,0xE0,0x82,0x3F,0x82,0x1F,0x81,	// 00000380 .....<~.....?... //
+	 0x3F,0x45,0xC1,0xFC,0xF0,0x81,0xFE,0x83,0xFC,0x81,0x7E,0x80,0x0F,0x86,0x1F,0x45,	// 00000390 ?E........~....E //
+	 0xCB,0xF1,0xF0,0xC0,0xE0,0xE0,0xD0,0xC0,0xE0,0xE0,0xF0,0x3E,0x3F,0x81,0x1F,0x81,	// 000003A0 ...........>?... //
+	 0x0F,0x81,0x07,0x01,0x81,0xFC,0x82,0xFE,0x40,0x05,0x80,0x01,0x84,0x03,0x81,0x07,	// 000003B0 ........@....... //
+	 0x80,0x0F,0x44,0xC2,0xFC,0xF0,0xC0,0x00,0x41,0xC1,0xFE,0xB8,0x02,0xC8,0x01,0xFF,	// 000003C0 ..D.....A....... //
+	 0x87,0x03,0x0F,0x1F,0x7F,0xFF,0xFD,0x82,0xE0,0x83,0xF0,0x80,0xF8,0x02,0xC2,0x01,	// 000003D0 ................ //
+	 0x1F,0x7F,0x41,0xC2,0x1F,0x3F,0x7F,0x44,0xCF,0xF8,0xF0,0xF0,0xE0,0xC0,0x80,0x80,	// 000003E0 ..A..?.D........ //
+	 0x00,0x03,0x03,0x07,0x07,0x0F,0x0F,0x1F,0x3F,0x87,0xE0,0x80,0x3F,0x44,0xD7,0x7F,	// 000003F0 ........?...?D.. //
+	 0x3F,0xE0,0xF0,0xF8,0xFC,0xFE,0xFF,0xF9,0xFC,0x60,0x30,0x18,0x0C,0x06,0x00,0x80,	// 00000400 ?........`0..... //
+	 0xC0,0x7F,0x3F,0x1F,0x0F,0x03,0x01,0x01,0xD2,0xFC,0xF8,0xF9,0xFB,0xFF,0x3F,0x3F,	// 00000410 ..?...........?? //
+	 0x0F,0x00,0x40,0xE0,0xF4,0xFC,0xFC,0xF8,0xF8,0x07,0x1F,0x7F,0x42,0xC1,0xDF,0x1F,	// 00000420 ..@.........B... //
+	 0x45,0xC1,0xFE,0xF8,0x43,0xC7,0xFE,0xFC,0xF0,0x00,0xF8,0xE0,0xC0,0x80,0x03,0xC7,	// 00000430 E...C........... //
+	 0x07,0x0F,0x1E,0x3C,0x78,0x01,0x01,0x02,0x41,0x81,0x7F,0x41,0xC1,0xBF,0x7F,0x44,	// 00000440 ...<x...A..A...D //
+	 0xC2,0xF3,0xF1,0xE1,0x82,0x80,0x82,0xC0,0x81,0x80,0x41,0x80,0x03,0x84,0x01,0x82,	// 00000450 ..........A..... //
+	 0x80,0xC4,0xC0,0xE0,0xF8,0xFC,0xFE,0x00,0x81,0x01,0x04,0x41,0x80,0x81,0x02,0xC9,	// 00000460 ...........A.... //
+	 0x01,0x07,0xEF,0xDF,0x3F,0x7F,0x7F,0xFF,0xBF,0x3F,0x40,0x81,0xFE,0x44,0x06,0x80,	// 00000470 ....?....?@..D.. //
+	 0x80,0x81,0x1F,0x82,0x0F,0x82,0x07,0xC1,0xFE,0xF7,0x81,0xF0,0x82,0xF8,0xC2,0xFC,	// 00000480 ................ //
+	 0x30,0x86,0x01,0x80,0x04,0x07,0xCC,0x06,0x00,0x07,0x1F,0x38,0x03,0x3F,0x7F,0x3F,	// 00000490 0..........8.?.? //
+	 0x1F,0xFF,0x87,0x1F,0x45,0x81,0xF0,0x82,0xE0,0x80,0xE3,0x41,0x83,0x3F,0x81,0x3E,	// 000004A0 ....E......A.?.> //
+	 0x81,0x7E,0x42,0xC5,0x7F,0x3F,0x1F,0x0F,0x0F,0xE1,0x46,0x86,0xF8,0xC3,0xF0,0x03,	// 000004B0 .~B..?....F..... //
+	 0x03,0x01,0x81,0x81,0x82,0x80,0x45,0xC5,0xE6,0xC6,0xFF,0xF1,0xC0,0x80,0x03,0x42,	// 000004C0 ......E........B //
+	 0xC1,0xFE,0x3C,0x02,0x82,0x03,0x81,0x01,0x02,0x45,0xC1,0x3F,0x03,0x81,0xE0,0x81,	// 000004D0 ..<......E.?.... //
+	 0xF8,0x43,0xC2,0x78,0xF8,0xF9,0x81,0xFD,0x42,0x01,0xC4,0x20,0x30,0x90,0x9C,0xFD,	// 000004E0 .C.x....B.. 0... //
+	 0x40,0x81,0x7F,0x46,0x82,0xFE,0xC3,0xFC,0xF8,0xF0,0xC0                          	// 000004F0 @..F.......      //
 };
 
-//****************************************
-//* Map: 
-//****************************************
-
-// illegal characters in logo
-// 16+2=154 and U10+4=236
-
 const unsigned char MD0_LOGO[] = {
-// logo is flipped bottom to top and hand-compressed
-// using this syntax: <#spaces (0x68)>,<cnt>,<literal bytes>
-// Note: tried compressing the middle space too, but the code
-// to display it ate more space than we saved.
-
-//* -- Map Row 16 --
-12,6,0xB2,0xB3,0xB4,0xB5,0xB6,0xB7,
-
-//* -- Map Row 15 -- 
-11,7,0xF9,0xFA,0xFB,0xFC,0xFD,0xFE,
-0xFF,
-
-//* -- Map Row 14 -- 
-10,9,0xAA,0xAB,0x6D,0xAC,0xAD,0xAE,
-0xAF,0xB0,0xB1,
-
-//* -- Map Row 13 -- 
-10,11,0xF1,0xF2,0xF3,0xF4,0x68,0x68,
-0xF5,0x6D,0xF6,0xF7,0xF8,
-
-//* -- Map Row 12 -- 
-9,15,0x9F,0xA0,0xA1,0xA2,0x68,0x68,0x68,
-0xA3,0xA4,0xA5,0xA6,0x6D,0xA7,0xA8,0xA9,
-
-//* -- Map Row 11 -- 
-9,15,0xEA,0xEB,0x68,0x68,0x68,0x68,0x68,
-0x68,0x68,0x68,0xED,0xEE,0xEF,0x6D,0xF0,
-
-//* -- Map Row 10 -- 
-8,17,0x97,0x98,0x99,0x68,0x68,0x68,0x68,
-0x68,0x68,0x68,0x68,0x68,0x9B,0x9C,0x75,
-0x9D,0x9E,
-
-//* -- Map Row 9 -- 
-8,17,0xE3,0xE4,0x68,0x68,0x68,0x68,0x68,
-0x68,0x68,0x68,0x68,0x68,0xE5,0xE6,0xE7,
-0xE8,0xE9,
-
-//* -- Map Row 8 -- 
-7,18,0x8D,0x8E,0x8F,0x68,0x68,0x68,0x90,
-0x91,0x68,0x92,0x93,0x68,0x68,0x68,0x94,
-0x95,0x6D,0x96,
-
-//* -- Map Row 7 -- 
-7,19,0xD5,0xD6,0xD7,0x68,0x68,0xD8,0xD9,
-0xDA,0x68,0xDB,0xDC,0xDD,0xDE,0x68,0x68,
-0xDF,0xE0,0xE1,0xE2,
-
-//* -- Map Row 6 -- 
-7,18,0x7D,0x7E,0x7F,0x80,0x81,0x82,0x83,
-0x84,0x68,0x85,0x86,0x87,0x88,0x89,0x68,
-0x8A,0x8B,0x8C,
-
-//* -- Map Row 5 -- 
-7,18,0xC5,0xC6,0xC7,0xC8,0xC9,0xCA,0xCB,
-0x6D,0xCC,0xCD,0xCE,0xCF,0xD0,0xD1,0xD2,
-0xD3,0x6D,0xD4,
-
-//* -- Map Row 4 -- 
-8,17,0x70,0x71,0x72,0x68,0x68,0x73,0x74,
-0x75,0x76,0x77,0x78,0x68,0x79,0x7A,0x7B,
-0x6A,0x7C,
-
-//* -- Map Row 3 -- 
-8,16,0xBD,0xBE,0xBF,0x68,0x68,0x68,0x68,
-0xC0,0xC1,0x68,0x68,0x68,0x68,0xC2,0xC3,
-0xC4,
-
-//* -- Map Row 2 -- 
-8,17,0x69,0x6A,0x6B,0x68,0x68,0x68,0x68,
-0x68,0x68,0x68,0x68,0x68,0x68,0x6C,0x6D,
-0x6E,0x6F,
-
-//* -- Map Row 1 -- 
-8,17,0xB8,0xB9,0x68,0x68,0x68,0x68,0x68,
-0x68,0x68,0x68,0x68,0x68,0x68,0x68,0xBA,
-0xBB,0xBC
+// raw
+	 0x0C,0x06,0xB2,0xB3,0xB4,0xB5,0xB6,0xB7,0x0B,0x07,0xF9,0xFA,0xFB,0xFC,0xFD,0xFE,	// 00000000 ................ //
+	 0xFF,0x0A,0x09,0xAA,0xAB,0x6D,0xAC,0xAD,0xAE,0xAF,0xB0,0xB1,0x0A,0x0B,0xF1,0xF2,	// 00000010 .....m.......... //
+	 0xF3,0xF4,0x68,0x68,0xF5,0x6D,0xF6,0xF7,0xF8,0x09,0x0F,0x9F,0xA0,0xA1,0xA2,0x68,	// 00000020 ..hh.m.........h //
+	 0x68,0x68,0xA3,0xA4,0xA5,0xA6,0x6D,0xA7,0xA8,0xA9,0x09,0x0F,0xEA,0xEB,0x68,0x68,	// 00000030 hh....m.......hh //
+	 0x68,0x68,0x68,0x68,0x68,0x68,0xED,0xEE,0xEF,0x6D,0xF0,0x08,0x11,0x97,0x98,0x99,	// 00000040 hhhhhh...m...... //
+	 0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x9B,0x9C,0x75,0x9D,0x9E,0x08,0x11,	// 00000050 hhhhhhhhh..u.... //
+	 0xE3,0xE4,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0xE5,0xE6,0xE7,0xE8,	// 00000060 ..hhhhhhhhhh.... //
+	 0xE9,0x07,0x12,0x8D,0x8E,0x8F,0x68,0x68,0x68,0x90,0x91,0x68,0x92,0x93,0x68,0x68,	// 00000070 ......hhh..h..hh //
+	 0x68,0x94,0x95,0x6D,0x96,0x07,0x13,0xD5,0xD6,0xD7,0x68,0x68,0xD8,0xD9,0xDA,0x68,	// 00000080 h..m......hh...h //
+	 0xDB,0xDC,0xDD,0xDE,0x68,0x68,0xDF,0xE0,0xE1,0xE2,0x07,0x12,0x7D,0x7E,0x7F,0x80,	// 00000090 ....hh......}~.. //
+	 0x81,0x82,0x83,0x84,0x68,0x85,0x86,0x87,0x88,0x89,0x68,0x8A,0x8B,0x8C,0x07,0x12,	// 000000A0 ....h.....h..... //
+	 0xC5,0xC6,0xC7,0xC8,0xC9,0xCA,0xCB,0x6D,0xCC,0xCD,0xCE,0xCF,0xD0,0xD1,0xD2,0xD3,	// 000000B0 .......m........ //
+	 0x6D,0xD4,0x08,0x11,0x70,0x71,0x72,0x68,0x68,0x73,0x74,0x75,0x76,0x77,0x78,0x68,	// 000000C0 m...pqrhhstuvwxh //
+	 0x79,0x7A,0x7B,0x6A,0x7C,0x08,0x10,0xBD,0xBE,0xBF,0x68,0x68,0x68,0x68,0xC0,0xC1,	// 000000D0 yz{j|.....hhhh.. //
+	 0x68,0x68,0x68,0x68,0xC2,0xC3,0xC4,0x08,0x11,0x69,0x6A,0x6B,0x68,0x68,0x68,0x68,	// 000000E0 hhhh.....ijkhhhh //
+	 0x68,0x68,0x68,0x68,0x68,0x68,0x6C,0x6D,0x6E,0x6F,0x08,0x11,0xB8,0xB9,0x68,0x68,	// 000000F0 hhhhhhlmno....hh //
+	 0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0xBA,0xBB,0xBC                	// 00000100 hhhhhhhhhh...    //
 };
 
 const unsigned char MD0_PHOENIX[] = {
-// This part could be compressed, but at only 128 bytes
-// it wouldn't save very much. It is just straight copied though.
-//* -- Map Row 18 -- 
-0x18,0x20,0x19,0x1A,0x1B,0x1C,0x1D,0x18, 	// PHOENIX LETTERS
-0x1E,0x20,0x1F,0x21,0x1A,0x1A,0x22,0x23,
-0x24,0x1A,0x1A,0x25,0x20,0x19,0x1A,0x26,
-0x27,0x20,0x28,0x29,0x2A,0x2B,0x2C,0x18,
-//* -- Map Row 19 -- 
-0x18,0x20,0x42,0x43,0x44,0x45,0x46,0x43,
-0x47,0x20,0x33,0x48,0x18,0x18,0x49,0x37,
-0x4A,0x4B,0x4B,0x4C,0x20,0x3B,0x18,0x3C,
-0x3D,0x20,0x3B,0x4D,0x20,0x4E,0x4F,0x18,
-//* -- Map Row 20 -- 
-0x18,0x20,0x2D,0x2E,0x2F,0x30,0x31,0x2E,
-0x32,0x20,0x33,0x34,0x35,0x35,0x36,0x37,
-0x38,0x39,0x39,0x3A,0x20,0x3B,0x18,0x3C,
-0x3D,0x20,0x3E,0x3F,0x40,0x1B,0x41,0x18,
-//* -- Map Row 21 -- 
-0x18,0x50,0x51,0x18,0x18,0x52,0x53,0x18,
-0x54,0x50,0x55,0x50,0x50,0x50,0x56,0x57,
-0x58,0x50,0x50,0x59,0x50,0x51,0x18,0x5A,
-0x5B,0x50,0x5C,0x5D,0x5E,0x5F,0x60,0x18
+// raw
+	 0x18,0x20,0x19,0x1A,0x1B,0x1C,0x1D,0x18,0x1E,0x20,0x1F,0x21,0x1A,0x1A,0x22,0x23,	// 00000000 . ....... .!.."# //
+	 0x24,0x1A,0x1A,0x25,0x20,0x19,0x1A,0x26,0x27,0x20,0x28,0x29,0x2A,0x2B,0x2C,0x18,	// 00000010 $..% ..&' ()*+,. //
+	 0x18,0x20,0x42,0x43,0x44,0x45,0x46,0x43,0x47,0x20,0x33,0x48,0x18,0x18,0x49,0x37,	// 00000020 . BCDEFCG 3H..I7 //
+	 0x4A,0x4B,0x4B,0x4C,0x20,0x3B,0x18,0x3C,0x3D,0x20,0x3B,0x4D,0x20,0x4E,0x4F,0x18,	// 00000030 JKKL ;.<= ;M NO. //
+	 0x18,0x20,0x2D,0x2E,0x2F,0x30,0x31,0x2E,0x32,0x20,0x33,0x34,0x35,0x35,0x36,0x37,	// 00000040 . -./01.2 345567 //
+	 0x38,0x39,0x39,0x3A,0x20,0x3B,0x18,0x3C,0x3D,0x20,0x3E,0x3F,0x40,0x1B,0x41,0x18,	// 00000050 899: ;.<= >?@.A. //
+	 0x18,0x50,0x51,0x18,0x18,0x52,0x53,0x18,0x54,0x50,0x55,0x50,0x50,0x50,0x56,0x57,	// 00000060 .PQ..RS.TPUPPPVW //
+	 0x58,0x50,0x50,0x59,0x50,0x51,0x18,0x5A,0x5B,0x50,0x5C,0x5D,0x5E,0x5F,0x60,0x18 	// 00000070 XPPYPQ.Z[P.]^_`. //
 };
 #endif
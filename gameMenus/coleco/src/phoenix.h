@@ -24,12 +24,54 @@ volatile __sfr __at 0x55 phBankingScheme;       // cartridge emulation control (
 volatile __sfr __at 0x56 phSDControl;         // SD card control
 #define PH_SD_CE_OFF        1                 // CE control, active low (RW)
 #define PH_SD_LOW_SPEED     2                 // set for 400Khz, clear for 12MHz (RW)
+#define PH_SD_HIGH_SPEED    4                 // set for 25MHz after CMD6 High-Speed switch, ignored at 400KHz (RW)
+#define PH_SD_PREFETCH      8                 // set to read ahead into a FIFO after a data read, no wait states (RW)
+#define PH_SD_CRC_RESTART   0x10              // set after the data token to check the next 512+2 bytes read (W)
+#define PH_SD_CRC_OK        0x10              // data block and CRC read, CRC-16 good (R)
 #define PH_SD_CARD_DETECT   0x80              // read for card detect (other bits?)
 
 volatile __sfr __at 0x57 phSDData;            // SD card read/write data
 volatile __sfr __at 0x58 phMachineID;         // reads as 8 for Phoenix
+volatile __sfr __at 0x58 phCPUClock;          // CPU clock while the loader is enabled (W)
+#define PH_CPU_3M58         0                 // stock 3.58MHz, always used once the loader is disabled
+#define PH_CPU_7M16         1                 // 2x
+#define PH_CPU_12M5         2                 // about 3.5x, as fast as the external SRAM allows
+#define PH_CPU_NO_WAIT      4                 // no M1 wait-state, or with one of the clocks
 volatile __sfr __at 0x59 phCartMask;          // cartridge page mask for megacarts 0x01-1F
 
+volatile __sfr __at 0x5A phDMABlockLo;        // SD DMA SRAM destination, 512-byte block bits 7-0 (RW, reads current)
+volatile __sfr __at 0x5B phDMABlockHi;        // SD DMA SRAM destination, 512-byte block bits 9-8 (RW, reads current)
+volatile __sfr __at 0x5C phDMACountLo;        // SD DMA block count bits 7-0 (RW, reads remaining)
+volatile __sfr __at 0x5D phDMACountHi;        // SD DMA block count bits 10-8 (RW, reads remaining)
+volatile __sfr __at 0x5E phDMAControl;        // SD DMA control (W) and status (R), loader only
+#define PH_DMA_START        1                 // start the transfer, card must be selected after CMD17/CMD18 (W)
+#define PH_DMA_ABORT        2                 // stop the transfer (W)
+#define PH_DMA_BUSY         0x80              // transfer in progress (R)
+#define PH_DMA_ERROR        0x40              // error token, token timeout or bad CRC, count shows the failed block (R)
+volatile __sfr __at 0x5F phPerfCounters;      // performance counter control (W) and latched bytes (R)
+#define PH_PERF_LATCH       0x80              // copy all four counters so they can be read (W)
+#define PH_PERF_RESET       0x40              // zero the counters, after the latch (W)
+#define PH_PERF_CYCLES      0                 // read pointers, 32-bit little-endian: 3.58MHz CPU cycles
+#define PH_PERF_WAITS       4                 // cycles the CPU was held in a wait state
+#define PH_PERF_SD_BYTES    8                 // SD-card bytes, CPU and DMA
+#define PH_PERF_VDP         12                // VDP port reads and writes
+
+volatile __sfr __at 0x40 phCopySrcLo;        // SRAM copy source address bits 7-0 (RW, reads current)
+volatile __sfr __at 0x41 phCopySrcMid;       // SRAM copy source address bits 15-8
+volatile __sfr __at 0x42 phCopySrcHi;        // SRAM copy source address bits 18-16
+volatile __sfr __at 0x43 phCopyDstLo;        // SRAM copy destination address bits 7-0 (RW, reads current)
+volatile __sfr __at 0x44 phCopyDstMid;       // SRAM copy destination address bits 15-8
+volatile __sfr __at 0x45 phCopyDstHi;        // SRAM copy destination address bits 18-16
+volatile __sfr __at 0x46 phCopyLenLo;        // SRAM copy length bits 7-0 (RW, reads remaining)
+volatile __sfr __at 0x47 phCopyLenMid;       // SRAM copy length bits 15-8
+volatile __sfr __at 0x48 phCopyLenHi;        // SRAM copy length bits 19-16
+volatile __sfr __at 0x49 phCopyFill;         // SRAM fill byte
+volatile __sfr __at 0x4A phCopyControl;      // SRAM copy control (W) and status (R), loader only
+#define PH_COPY_START       1                 // start a copy (W)
+#define PH_COPY_ABORT       2                 // stop the transfer (W)
+#define PH_COPY_FILL        5                 // start a fill with the fill byte (W)
+#define PH_COPY_BUSY        0x80              // transfer in progress (R)
+
 volatile __sfr __at 0x7f sgmBIOSMap;          // swaps RAM with the Coleco BIOS
 #define SGM_CFG_ENABLE_BIOS 0x02
 
@@ -44,6 +86,7 @@ volatile __sfr __at 0x7f sgmBIOSMap;          // swaps RAM with the Coleco BIOS
 //#define COLECO_FONT_ADR (0x158b + 0x4000)
 
 void dly_50us(unsigned char n);
+unsigned long perfRead(unsigned char cnt);
 
 // Just some convenient loader defines to improve the code
 // some tables that we never move - a constant will get better code out of SDCC
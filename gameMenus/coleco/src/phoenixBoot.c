@@ -10,6 +10,9 @@
 #include "phoenix.h"
 #include "f18a.h"
 #include "joykey.h"
+#include "vdpqueue.h"
+#include "fatFs/ff.h"			/* Obtains integer types */
+#include "fatFs/diskio.h"		/* Declarations of disk functions */
 
 #define HEADERS__
 #include "newmap2.c"
@@ -27,8 +30,14 @@ extern void inc_palette();
 // fast memcpy, since we don't need delays on the F18A
 extern void vdpmemcpyfast(unsigned int pAddr, const unsigned char *pSrc, unsigned int cnt);
 #define vdpmemcpy vdpmemcpyfast
+extern void vdpmemsetfast(unsigned int pAddr, unsigned int ch, unsigned int cnt);
+#define vdpmemset vdpmemsetfast
+extern void vdpmemreadfast(unsigned int pAddr, unsigned char *pDest, unsigned int cnt);
+#define vdpmemread vdpmemreadfast
 // menu function
 extern void menu();
+// menu's 512 byte load temporary, free whenever the config menu is up
+extern char path2[];
 
 // --- hardware ---
 static volatile __sfr __at 0xc0 port3;  // joystick reset strobe
@@ -108,55 +117,8 @@ unsigned char my_set_graphics(unsigned char sprite_mode) {
 	return VDP_MODE1_16K | VDP_MODE1_UNBLANK | VDP_MODE1_INT | sprite_mode;
 }
 
-// unRLE CPU to VDP handler
-// Basic RLE compression applied to PAT0
-// top two msbits are flags:
-// 00 - run of zeros
-// 01 - run of 0xff
-// 10 - run of next char
-// 11 - inline string
-// least significant 6 bits are the length
-// Warning: No sanity checking takes place
-void unrle(unsigned int vdpAdr, unsigned char *pSrc, unsigned int rleCnt) {
-    unsigned char *pEnd;
-    
-    VDP_SET_ADDRESS_WRITE(vdpAdr);
-    pEnd = pSrc + rleCnt;
-
-    while (pSrc < pEnd) {
-        unsigned char cnt = *(pSrc++);
-        unsigned char byte = 0;
-        switch (cnt&0xc0) {
-            case 0x00:
-                // run of zeros
-                byte = 0;
-                break;
-
-            case 0x40:
-                // run of 0xffs
-                byte = 0xff;
-                break;
-
-            case 0x80:
-                // run of next byte
-                byte = *(pSrc++);
-                break;
-
-            case 0xc0:
-                // inline string (special case)
-                cnt = (cnt & 0x3f) + 1;
-                while (cnt--) {
-                    VDPWD = *(pSrc++);
-                }
-                continue;
-        }
-        // all other cases come down here to be a run of bytes
-        cnt = (cnt & 0x3f) + 1;
-        while (cnt--) {
-            VDPWD = byte;
-        }
-    }
-}
+// unRLE CPU to VDP handler, in vdp_unpack.c
+extern void unrle(unsigned int vdpAdr, const unsigned char *pSrc, unsigned int rleCnt);
 
 // delay for 'x' vblanks - zero will just clear any pending
 // beware of calling this in a loop - if the time between calls
@@ -164,20 +126,226 @@ void unrle(unsigned int vdpAdr, unsigned char *pSrc, unsigned int rleCnt) {
 // entry and wait for another one (ie: you may wait a frame
 // longer than you expect).
 void waitVblanks(unsigned char cnt) {
-    // clear any vblank we may have missed
-    VDP_CLEAR_VBLANK;
+    // clear any vblank we may have missed, ackVblank() is in
+    // fatFs/diskio_ticks.c so the disk code shares it
+    ackVblank();
 
     while (cnt-- > 0) {
     	// wait as instructed
     	VDP_WAIT_VBLANK_CRU;
-    	VDP_CLEAR_VBLANK;
+    	ackVblank();
+
+        // queued menu updates go out at the top of the blank
+        vdpqFlush();
+    }
+}
+
+// clear the config menu window, which is 8 lines in text mode and
+// the bottom 16 lines in graphics mode
+void clearCfgWindow(unsigned int pos) {
+    if (text_width == 32) {
+        vdpmemset(pos, 0x18, 16*32);
+    } else {
+        vdpmemset(pos, ' ', 8*40);
+    }
+}
+
+// draw the config menu options, returns the address of the flicker state
+unsigned int drawCfgMenu(unsigned int pos) {
+    unsigned int onoff;
+
+    clearCfgWindow(pos);
+
+    // We might be in gfx or text mode, so we'll just left-align, sort of
+    pos += text_width+3;
+    vdpmemcpy(pos, "PRESS:", 6);
+    pos += text_width+2;
+    vdpmemcpy(pos, "1 TOGGLE SCANLINES", 18);
+    pos += text_width;
+    vdpmemcpy(pos, "2 TOGGLE FLICKER (   )", 22);
+    onoff = pos+18;
+    pos += text_width;
+    vdpmemcpy(pos, "3 DISK DIAGNOSTICS", 18);
+    pos += text_width + text_width;
+    vdpmemcpy(pos, "9 EXIT MENU", 11);
+
+    return onoff;
+}
+
+// write a number as 'digits' right-aligned decimal characters
+void diagDec(unsigned int pos, unsigned int n, unsigned char digits) {
+    unsigned char first = 1;
+
+    pos += digits;
+    while (digits--) {
+        vdpchar(--pos, (n || first) ? '0'+(n%10) : ' ');
+        n /= 10;
+        first = 0;
+    }
+}
+
+// write a byte as two hex characters
+void diagHex(unsigned int pos, unsigned char n) {
+    static const char hex[] = "0123456789ABCDEF";
+    vdpchar(pos, hex[n>>4]);
+    vdpchar(pos+1, hex[n&0x0f]);
+}
+
+// write one poll histogram line, counts stop at 999 to fit 32 columns
+void diagHist(unsigned int pos, const char *label, WORD *hist) {
+    unsigned char i;
+
+    vdpmemcpy(pos, label, 4);
+    for (i=0; i<DSTAT_BUCKETS; ++i) {
+        diagDec(pos+4+i*4, hist[i] > 999 ? 999 : hist[i], 4);
+    }
+}
+
+// read one latched performance counter (PH_PERF_*), returns 0 on a core
+// without the counters
+unsigned long perfRead(unsigned char cnt) {
+    unsigned long n;
+
+    phPerfCounters = cnt;
+    n = phPerfCounters;
+    n |= (unsigned long)phPerfCounters << 8;
+    n |= (unsigned long)phPerfCounters << 16;
+    n |= (unsigned long)phPerfCounters << 24;
+    return n;
+}
+
+// sequential read test - reads the first 128K of the card one sector at
+// a time, as f_read() does for data that is not sector aligned. Returns
+// the rate in KB/s (60 frames per second), or 0 if a read failed.
+unsigned int diskSpeedTest() {
+    WORD ticks;
+    unsigned int sector;
+    unsigned long cycles;
+
+    waitVblanks(0);
+    phPerfCounters = PH_PERF_LATCH;
+    cycles = perfRead(PH_PERF_CYCLES);
+    ticks = disk_ticks();
+    for (sector = 0; sector < 256; ++sector) {
+        if (disk_read((BYTE*)path2, sector, 1) != RES_OK) {
+            return 0;
+        }
+        disk_ticks();
+    }
+    ticks = disk_ticks() - ticks;
+    phPerfCounters = PH_PERF_LATCH;
+    cycles = perfRead(PH_PERF_CYCLES) - cycles;
+
+    // 128K in cycles of 3579545Hz, fall back to vblank ticks on an older
+    // core. disk_read() acknowledges vblanks too, so count them with
+    // disk_ticks() rather than the flag.
+    if (cycles != 0) {
+        return 458181760UL / cycles;
+    }
+    if (ticks == 0) ticks = 1;
+
+    return (128*60) / ticks;
+}
+
+// draw the diagnostics page, rate is the last speed test result
+// (0xffff when not run yet)
+void drawDiskDiag(unsigned int pos, unsigned int rate) {
+    clearCfgWindow(pos);
+
+    // 32 columns in either mode
+    if (text_width == 40) pos += 4;
+
+    vdpmemcpy(pos, "CARD", 4);
+    if (CardType & CT_SD2) {
+        vdpmemcpy(pos+5, "SD2", 3);
+    } else if (CardType & CT_SD1) {
+        vdpmemcpy(pos+5, "SD1", 3);
+    } else if (CardType & CT_MMC) {
+        vdpmemcpy(pos+5, "MMC", 3);
+    } else {
+        vdpmemcpy(pos+5, "---", 3);
+    }
+    if (CardType & CT_BLOCK) vdpmemcpy(pos+9, "BLK", 3);
+    if (csLow & PH_SD_HIGH_SPEED) vdpmemcpy(pos+13, "HS", 2);
+    vdpmemcpy(pos+16, "OCR", 3);
+    diagHex(pos+20, DiskStats.ocr[0]);
+    diagHex(pos+22, DiskStats.ocr[1]);
+    diagHex(pos+24, DiskStats.ocr[2]);
+    diagHex(pos+26, DiskStats.ocr[3]);
+    pos += text_width;
+
+    // poll count histograms, buckets are powers of two
+    vdpmemcpy(pos, "POLL   1   2   4   8  16  32  64", 32);
+    pos += text_width;
+    diagHist(pos, "CMD ", DiskStats.cmd);
+    pos += text_width;
+    diagHist(pos, "TOKN", DiskStats.token);
+    pos += text_width;
+    diagHist(pos, "WAIT", DiskStats.ready);
+    pos += text_width;
+
+    vdpmemcpy(pos, "RETR", 4);
+    diagDec(pos+5, DiskStats.retries, 5);
+    vdpmemcpy(pos+11, "CRC", 3);
+    diagDec(pos+15, DiskStats.crcErrors, 5);
+    vdpmemcpy(pos+21, "TMO", 3);
+    diagDec(pos+25, DiskStats.timeouts, 5);
+    pos += text_width;
+
+    vdpmemcpy(pos, "READ", 4);
+    if (rate == 0xffff) {
+        vdpmemcpy(pos+8, "--- KB/S", 8);
+    } else if (rate == 0) {
+        vdpmemcpy(pos+8, "ERR", 3);
+    } else {
+        diagDec(pos+5, rate, 6);
+        vdpmemcpy(pos+12, "KB/S", 4);
+    }
+    // last card init time in ms, from CPU cycles or else frames, and W if
+    // reused after a reset
+    vdpmemcpy(pos+18, "INIT", 4);
+    if (DiskStats.initCycles != 0) {
+        diagDec(pos+22, DiskStats.initCycles > 59607000UL ? 16650 : DiskStats.initCycles / 3580, 5);
+    } else {
+        diagDec(pos+22, DiskStats.initTicks > 999 ? 16650 : DiskStats.initTicks*50/3, 5);
+    }
+    vdpmemcpy(pos+27, "MS", 2);
+    if (DiskStats.warm) vdpchar(pos+30, 'W');
+    pos += text_width;
+
+    vdpmemcpy(pos, "1 SPEED TEST    9 BACK", 22);
+}
+
+// storage diagnostics page for qualifying SD cards in the field - shows
+// the card type, OCR, the diskio poll and error statistics and the card
+// init time, and can run a read speed test. Called from cfgMenu() with the window address.
+void diskDiag(unsigned int pos) {
+    JOYSTATE ev;
+    unsigned int rate = 0xffff;
+
+    drawDiskDiag(pos, rate);
+
+    for (;;) {
+        waitVblanks(1);
+
+        while (joyGetEvent(&ev)) {
+            if (ev.key == '9') {
+                return;
+            } else if (ev.key == '1') {
+                rate = diskSpeedTest();
+                drawDiskDiag(pos, rate);
+                // keys pressed during the test don't count
+                joyFlushEvents();
+            }
+        }
     }
 }
 
 // simple config menu for scanlines and flicker that we can activate
 // even before a cartridge boots - called ONLY from readkeypad()
 void cfgMenu() {
-    unsigned char lastkey = 0xff;
+    JOYSTATE ev;
+    unsigned char done = 0;
     unsigned int pos = GIMAGE+8*40;
     unsigned int onoff;
     unsigned char de1 = 0, de2 = 0;
@@ -189,26 +357,15 @@ void cfgMenu() {
     // FATFONT starts at char 29, and I want starting at char 48...
 	if (text_width == 32) {
 		vdpmemread(GIMAGE+8*32, lineBuffer, 16*32);		// backup screen
-		vdpmemset(GIMAGE+8*32, 0x18, 16*32);			// clear it
         vdpmemcpy(GPATTERN+' '*8, &FATFONT[(' '-29)*8], ('X'-' '+1)*8);		// fix char set
         pos = GIMAGE+8*32;
     } else {
 		vdpmemread(GIMAGE+8*40, lineBuffer, 8*40);		// backup screen
-		vdpmemset(GIMAGE+8*40, ' ', 8*40);				// clear it
 	}
 
-    // We might be in gfx or text mode, so we'll just left-align, sort of
-    pos += text_width+3;
-    vdpmemcpy(pos, "PRESS:", 6);
-    pos += text_width+2;
-    vdpmemcpy(pos, "1 TOGGLE SCANLINES", 18);
-    pos += text_width;
-    vdpmemcpy(pos, "2 TOGGLE FLICKER (   )", 22);
-    onoff = pos+18;
-    pos += text_width + text_width;
-    vdpmemcpy(pos, "9 EXIT MENU", 11);
+    onoff = drawCfgMenu(pos);
 
-    for (;;) {
+    while (!done) {
 		waitVblanks(1);
 		if (useFlicker) {
 			vdpmemcpy(onoff, "ON ", 3);
@@ -218,25 +375,27 @@ void cfgMenu() {
 		if (de1) --de1;
 		if (de2) --de2;
 
-        readkeypad();
-        if (MY_KEY != lastkey) {
-            lastkey = MY_KEY;
-
-            if (lastkey == '9') {
+        // key presses from the vblank sampler, so none are lost between reads
+        while (joyGetEvent(&ev)) {
+            if (ev.key == '9') {
+                done = 1;
                 break;
-            } else if (lastkey == '1') {
+            } else if (ev.key == '1') {
 				if (de1 == 0) {
 					// toggle scanlines - this is pretty obvious so no feedback needed
 					useScanlines ^= SCANLINES_ON;
 					VDP_SET_REGISTER(0x32, useScanlines);
 					de1 = 15;
 				}
-            } else if (lastkey == '2') {
+            } else if (ev.key == '2') {
 				if (de2 == 0) {
 					// toggle flicker and update display
 					useFlicker = !useFlicker;
 					de2 = 15;
 				}
+            } else if (ev.key == '3') {
+                diskDiag(pos);
+                onoff = drawCfgMenu(pos);
             }
         }
     }
@@ -260,10 +419,17 @@ void readkeypad() {
     static unsigned char lastret = 0xff;
     static unsigned char inCfg = 0;
     
-    readinputs(1);
-    if ((MY_KEY == 0xff)&&(MY_JOYX==0)&&(MY_JOYY==0)) {
-        // try joystick 2
-        readinputs(2);
+    if (joySamplerOn) {
+        // the sampler owns the ports, just take its state. Give it any
+        // pending vblank first, for loops that poll without waiting.
+        ackVblank();
+        joyGetState();
+    } else {
+        readinputs(1);
+        if ((MY_KEY == 0xff)&&(MY_JOYX==0)&&(MY_JOYY==0)) {
+            // try joystick 2
+            readinputs(2);
+        }
     }
 
     // check only when changed
@@ -420,6 +586,9 @@ void centerString(unsigned char line, char *p) {
 void startTitle() {
     unsigned int idx;
 
+    // the cartridge gets the NMI and the controller ports from here on
+    joyStop();
+
     // - execute title
     // -    disable screen and interrupts
     // VDP_SET_REGISTER(VDP_REG_MODE1, VDP_MODE1_16K); - done by prepare_f18a()
@@ -515,7 +684,10 @@ void startTitle() {
         // -                LD A,D
         // -                OR E
         // -                JR NZ,FILL
-        vdpmemset(0, 0, 16384);
+        // (we let the F18A GPU do it, briefly unlocking it to do so)
+        unlock_f18a();
+        gpufill_f18a(0, 0, 16384);
+        lock_f18a();
 
         // -                CALL READ_REGISTER (0x1fdc)
         // -                    IN A,[CTRL_PORT] (0xbf) // Read VDP Status
@@ -693,6 +865,9 @@ void startTitle() {
     // -        IN 0x55,A           DB55
     // -        LD HL,[0x800A]      2A800A
     // -        JP [HL]             E9
+    // the cartridge expects the stock clock and wait-state - reading port 0x55 in the
+    // trampoline drops it anyway, this is just not to depend on it
+    phCPUClock = PH_CPU_3M58;
     memcpy((void*)0x6000, trampoline, sizeof(trampoline));
     ((void(*)())0x6000)();  // never returns
 }
@@ -866,8 +1041,16 @@ void runCartHeader() {
     // - wait 4 seconds, allow abort
     cntdown = 255;
     while (cntdown-- > 0) {
+        JOYSTATE ev;
+        unsigned char fire = 0;
+
         readkeypad();   // read joystick fire buttons
         if (MY_KEY == JOY_FIRE) break;
+        // and catch a quick tap since the last frame
+        while (joyGetEvent(&ev)) {
+            if (ev.key == JOY_FIRE) fire = 1;
+        }
+        if (fire) break;
         waitVblanks(1);
     }
 
@@ -882,8 +1065,10 @@ void main() {
     // disable interrupt processing
     VDP_INT_DISABLE;
 
-    // we expect VRAM to be cleared out
-    vdpmemset(0, 0, 16384);
+    // nothing in the menu needs cycle-exact timing, so run the CPU
+    // as fast as it goes until startTitle(), and skip the opcode fetch
+    // wait-state the F18A has no use for
+    phCPUClock = PH_CPU_12M5 | PH_CPU_NO_WAIT;
 
     // I'm told we don't need to mute the AY or the SEX, and reset also turns off the SGM.
 
@@ -893,6 +1078,10 @@ void main() {
     reset_f18a();
     unlock_f18a();
 
+    // we expect VRAM to be cleared out - the GPU does this in a fraction
+    // of the time, but needs the F18A unlocked first
+    gpufill_f18a(0, 0, 16384);
+
     // ask the F18A to turn off the sprite limit
     VDP_SET_REGISTER(0x1e, 32); // stop sprite is #32
 	
@@ -929,6 +1118,9 @@ void main() {
 	// turn the screen on
 	VDP_SET_REGISTER(VDP_REG_MODE1, x);
 
+    // and with the VDP interrupt on, start sampling the controllers each vblank
+    joyStart();
+
 	// wait for the first two vblanks
     waitVblanks(2);
 
@@ -1,6 +1,8 @@
 #include "vdp.h"
 
 extern void vdpmemcpyfast(unsigned int pAddr, const unsigned char *pSrc, unsigned int cnt);
+extern void vdpmemsetfast(unsigned int pAddr, unsigned int ch, unsigned int cnt);
+extern void vdpmemreadfast(unsigned int pAddr, unsigned char *pDest, unsigned int cnt);
 void dummyfunc() {
 __asm
 ; stack has ret, pAddr, source, count
@@ -69,3 +71,174 @@ $0003:
 
 __endasm;
 }
+
+// cost per byte at 3.58MHz, no VDP delays so these are for the F18A only:
+//   vdpmemcpyfast  OTIR            21T (16T on the last of each run)
+//   vdpmemsetfast  16x OUT (n),A   11T + 13T DJNZ per 16 = ~11.8T
+//   vdpmemreadfast INIR            21T (16T on the last of each run)
+// the libti99 C loops are around 60-80T per byte
+void vdpmemsetfast_dummy() {
+__asm
+; stack has ret, pAddr, ch, count
+; fill byte sits in A for OUT (n),A, which is 1T faster than OUT (C),A
+_vdpmemsetfast::
+; save regs
+    push hl
+    push bc
+    push de
+    push af
+
+; point sp at pAddr
+    ld hl,#10
+    add hl,sp
+    ld sp,hl	; sp pointing at pAddr
+
+; set the VDP address
+	pop de		; sp pointing at ch
+	ld a,e
+	out (_VDPWA),a
+	ld a,d
+	set 6,a
+	out (_VDPWA),a
+
+; get fill byte into l
+	pop hl		; sp pointing at cnt
+
+; get count into de
+	pop de		; sp above stack frame
+
+; count mod 16 a byte at a time
+	ld a,e
+	and #0x0f
+	jr Z,$0102
+	ld b,a
+	ld a,l
+$0101:
+	out (_VDPWD),a
+	djnz $0101
+
+; de = count / 16
+$0102:
+	ld b,#4
+$0103:
+	srl d
+	rr e
+	djnz $0103
+
+	ld a,e
+	or d
+	jr Z,$0106	; no blocks left
+
+; b counts blocks in this pass (0 = 256), d counts passes
+	ld b,e
+	inc e
+	dec e
+	jr Z,$0104
+	inc d		; short first pass
+$0104:
+	ld a,l
+
+; 16 bytes per DJNZ, 189T
+$0105:
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	djnz $0105
+
+	dec d
+	jr NZ,$0105
+
+; restore the stack and return
+$0106:
+	ld hl,#-16	; pointing at af
+    add hl,sp
+    ld sp,hl
+
+	pop af
+	pop de
+	pop bc
+	pop hl
+
+__endasm;
+}
+
+void vdpmemreadfast_dummy() {
+__asm
+; stack has ret, pAddr, dest, count
+; for INIR we need port in C, dest in HL and count in B
+_vdpmemreadfast::
+; save regs
+    push hl
+    push bc
+    push de
+    push af
+
+; point sp at pAddr
+    ld hl,#10
+    add hl,sp
+    ld sp,hl	; sp pointing at pAddr
+
+; set the VDP read address
+	pop de		; sp pointing at pDest
+	ld a,e
+	out (_VDPWA),a
+	ld a,d
+	and #0x3f
+	out (_VDPWA),a
+
+; get dest into hl
+	pop hl		; sp pointing at cnt
+
+; get count into de
+	pop de		; sp above stack frame
+
+; get port into c
+    ld c,#_VDPRD
+
+; outer loop, 256 at a time
+$0201:
+	inc d
+	dec d
+	jr Z,$0202
+
+	xor a
+	ld b,a
+	inir		; runs 256
+
+	dec d
+	jr $0201
+
+; last pass
+$0202:
+    inc e
+    dec e
+    jr Z,$0203  ; 0 bytes remaining
+	ld b,e
+	inir
+
+; restore the stack and return
+$0203:
+	ld hl,#-16	; pointing at af
+    add hl,sp
+    ld sp,hl
+
+	pop af
+	pop de
+	pop bc
+	pop hl
+
+__endasm;
+}
@@ -0,0 +1,163 @@
+#include "vdp.h"
+
+// LZ decoder for boot graphics built with the lz codec of mkasset
+// (Utils/src_mkasset). Nothing uses it yet, so it isn't in MAIN_OBJS -
+// add it there if an asset is switched to lz.
+// No VDP delays, so this is for the F18A only.
+
+// byte oriented LZ77 over the last 256 bytes written:
+// 0lllllll          - l+1 literal bytes follow
+// 1lllllll oooooooo - copy l+3 bytes from o+1 bytes back
+// Warning: No sanity checking takes place
+//
+// Literals go out with OTIR. Matches are read back out of VRAM into a
+// buffer on the stack with INIR and written again with OTIR, in chunks no
+// longer than the distance so overlapping matches repeat correctly. That
+// is about 42T per byte plus 16 port writes per chunk.
+extern void unlz(unsigned int vdpAdr, const unsigned char *pSrc, unsigned int lzCnt);
+void unlz_dummy() {
+__asm
+; stack has ret, vdpAdr, source, count
+_unlz::
+; save regs, ix is the frame
+    push hl
+    push bc
+    push de
+    push af
+    push iy
+    push ix
+    ld ix,#0
+    add ix,sp	; 14(ix) vdpAdr, 16(ix) pSrc, 18(ix) cnt
+
+; 130 byte match buffer below the frame, iy points at it
+    ld hl,#-130
+    add hl,sp
+    ld sp,hl
+    ld iy,#0
+    add iy,sp
+
+; end of source goes over the count, hl is the source
+	ld l,16(ix)
+	ld h,17(ix)
+	ld e,18(ix)
+	ld d,19(ix)
+	ex de,hl
+	add hl,de
+	ld 18(ix),l
+	ld 19(ix),h
+	ex de,hl
+
+; de tracks the VDP write address
+	ld e,14(ix)
+	ld d,15(ix)
+	ld a,e
+	out (_VDPWA),a
+	ld a,d
+	or #0x40
+	out (_VDPWA),a
+
+; next code, stop at the end of the source
+$0401:
+	ld a,l
+	cp 18(ix)
+	jr NZ,$0402
+	ld a,h
+	cp 19(ix)
+	jp Z,$0409
+
+$0402:
+	ld a,(hl)
+	inc hl
+	or a
+	jp M,$0403
+
+; literals, a+1 of them
+	inc a
+	ld b,a
+	add a,e
+	ld e,a
+	jr NC,$0407
+	inc d
+$0407:
+	ld c,#_VDPWD
+	otir
+	jr $0401
+
+; match, the vdpAdr slot holds the length left and the distance-1
+$0403:
+	and #0x7f
+	add a,#3
+	ld 14(ix),a
+	ld a,(hl)
+	inc hl
+	ld 15(ix),a
+	push hl
+
+; chunk is the smaller of the length left and the distance
+$0404:
+	ld b,14(ix)
+	ld a,b
+	dec a
+	cp 15(ix)
+	jr C,$0405
+	ld b,15(ix)
+	inc b
+$0405:
+	ld a,14(ix)
+	sub b
+	ld 14(ix),a
+
+; read address is de-distance
+	ld a,15(ix)
+	cpl
+	ld l,a
+	ld h,#0xff
+	add hl,de
+	ld a,l
+	out (_VDPWA),a
+	ld a,h
+	and #0x3f
+	out (_VDPWA),a
+
+	push iy
+	pop hl
+	ld c,#_VDPRD
+	push bc
+	inir
+	pop bc
+
+; back to writing at de
+	ld a,e
+	out (_VDPWA),a
+	ld a,d
+	or #0x40
+	out (_VDPWA),a
+	ld a,e
+	add a,b
+	ld e,a
+	jr NC,$0406
+	inc d
+$0406:
+	push iy
+	pop hl
+	ld c,#_VDPWD
+	otir
+
+	ld a,14(ix)
+	or a
+	jr NZ,$0404
+	pop hl
+	jp $0401
+
+; drop the buffer, restore and return
+$0409:
+	ld sp,ix
+	pop ix
+	pop iy
+	pop af
+	pop de
+	pop bc
+	pop hl
+
+__endasm;
+}
@@ -0,0 +1,202 @@
+#include "vdp.h"
+
+// Z80 decoders for the compressed boot graphics, see Utils/src_mkasset.
+// None of these have VDP delays, so they are for the F18A only.
+
+// Basic RLE compression applied to PAT0
+// top two msbits are flags:
+// 00 - run of zeros
+// 01 - run of 0xff
+// 10 - run of next char
+// 11 - inline string
+// least significant 6 bits are the length
+// Warning: No sanity checking takes place
+//
+// Inline strings go out with OTIR (21T per byte). Runs of 8 or more jump
+// into 64 unrolled OUT (n),A for 11T per byte, shorter runs aren't worth
+// the setup and use a DJNZ loop (24T per byte).
+extern void unrle(unsigned int vdpAdr, const unsigned char *pSrc, unsigned int rleCnt);
+void unrle_dummy() {
+__asm
+; stack has ret, vdpAdr, source, count
+_unrle::
+; save regs
+    push hl
+    push bc
+    push de
+    push af
+    push ix
+
+; point sp at vdpAdr
+    ld hl,#12
+    add hl,sp
+    ld sp,hl	; sp pointing at vdpAdr
+
+; set the VDP address
+	pop de		; sp pointing at pSrc
+	ld a,e
+	out (_VDPWA),a
+	ld a,d
+	set 6,a
+	out (_VDPWA),a
+
+; get source into hl
+	pop hl		; sp pointing at cnt
+
+; get end of source into de
+	pop de		; sp above stack frame
+	ex de,hl
+	add hl,de
+	ex de,hl
+
+; next code, stop at the end of the source
+$0301:
+	ld a,l
+	cp e
+	jr NZ,$0302
+	ld a,h
+	cp d
+	jp Z,$0309
+
+$0302:
+	ld a,(hl)
+	inc hl
+	ld b,a
+	and #0x3f
+	inc a		; a is the count, b the flags
+	bit 7,b
+	jr NZ,$0303
+
+; 00 zeros or 01 0xffs
+	bit 6,b
+	ld b,a
+	ld a,#0
+	jr Z,$0305
+	dec a
+	jr $0305
+
+$0303:
+	bit 6,b
+	ld b,a
+	jr NZ,$0304
+
+; 10 run of next byte
+	ld a,(hl)
+	inc hl
+	jr $0305
+
+; 11 inline string
+$0304:
+	ld c,#_VDPWD
+	otir
+	jr $0301
+
+; run of a, b times
+$0305:
+	ld c,a
+	ld a,b
+	cp #8
+	ld a,c
+	jr NC,$0307
+$0306:
+	out (_VDPWD),a
+	djnz $0306
+	jr $0301
+
+; long run, jump in b OUTs from the end of the block
+; SP is above the frame, and the NMI needs what is below
+; it, so nothing is pushed here: the jump goes through IX
+; and HL/DE stay as they are
+$0307:
+	ld a,#64
+	sub b
+	add a,a		; OUT (n),A is two bytes
+	ld b,c
+	ld c,a		; c = offset from the first OUT
+	ld a,b		; a = the byte to write
+	ld b,#0
+	ld ix,#$0308-128
+	add ix,bc
+	jp (ix)
+
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+	out (_VDPWD),a
+$0308:
+	jp $0301
+
+; restore the stack and return
+$0309:
+	ld hl,#-18	; pointing at ix
+    add hl,sp
+    ld sp,hl
+
+	pop ix
+	pop af
+	pop de
+	pop bc
+	pop hl
+
+__endasm;
+}
@@ -0,0 +1,130 @@
+// VDP update queue for the menu
+#include <vdp.h>
+#include "vdpqueue.h"
+
+// fast VRAM kernels, since we don't need delays on the F18A
+extern void vdpmemcpyfast(unsigned int pAddr, const unsigned char *pSrc, unsigned int cnt);
+extern void vdpmemsetfast(unsigned int pAddr, unsigned int ch, unsigned int cnt);
+
+#define VDPQ_COPY 0
+#define VDPQ_FILL 1
+#define VDPQ_REG  2
+
+struct VDPQ_ENTRY {
+    unsigned char op;
+    unsigned char val;      // fill byte or register value
+    unsigned int adr;       // VRAM address or register number
+    const unsigned char *src;
+    unsigned int cnt;
+};
+
+struct VDPQ_ENTRY vdpqList[VDPQ_SIZE];
+unsigned char vdpqCount = 0;
+
+unsigned int vdpqLastBytes = 0;
+unsigned int vdpqPeakBytes = 0;
+
+// get a free entry, flushing early if we ran out
+struct VDPQ_ENTRY *vdpqNext() {
+    if (vdpqCount >= VDPQ_SIZE) {
+        vdpqFlush();
+    }
+    return &vdpqList[vdpqCount++];
+}
+
+void vdpqCopy(unsigned int adr, const unsigned char *pSrc, unsigned int cnt) {
+    struct VDPQ_ENTRY *p;
+
+    // continues the last copy in both VRAM and source, so save an address setup
+    if (vdpqCount) {
+        p = &vdpqList[vdpqCount-1];
+        if ((p->op == VDPQ_COPY) && (p->adr+p->cnt == adr) && (p->src+p->cnt == pSrc)) {
+            p->cnt += cnt;
+            return;
+        }
+    }
+
+    p = vdpqNext();
+    p->op = VDPQ_COPY;
+    p->adr = adr;
+    p->src = pSrc;
+    p->cnt = cnt;
+}
+
+void vdpqFill(unsigned int adr, unsigned char ch, unsigned int cnt) {
+    struct VDPQ_ENTRY *p;
+    unsigned char idx;
+
+    // the same area filled again this frame (like moving the selection
+    // bar back and forth) just takes the new value. That's only safe while
+    // fills are all that follow it, and it then moves to the end so it
+    // still lands last.
+    for (idx=vdpqCount; idx>0; --idx) {
+        p = &vdpqList[idx-1];
+        if (p->op != VDPQ_FILL) break;
+        if ((p->adr == adr) && (p->cnt == cnt)) {
+            p->val = ch;
+            if (idx != vdpqCount) {
+                struct VDPQ_ENTRY tmp = *p;
+                for (; idx<vdpqCount; ++idx) {
+                    vdpqList[idx-1] = vdpqList[idx];
+                }
+                vdpqList[vdpqCount-1] = tmp;
+            }
+            return;
+        }
+    }
+
+    // continues the last fill with the same byte
+    if (vdpqCount) {
+        p = &vdpqList[vdpqCount-1];
+        if ((p->op == VDPQ_FILL) && (p->adr+p->cnt == adr) && (p->val == ch)) {
+            p->cnt += cnt;
+            return;
+        }
+    }
+
+    p = vdpqNext();
+    p->op = VDPQ_FILL;
+    p->val = ch;
+    p->adr = adr;
+    p->cnt = cnt;
+}
+
+void vdpqReg(unsigned char r, unsigned char v) {
+    struct VDPQ_ENTRY *p = vdpqNext();
+
+    p->op = VDPQ_REG;
+    p->adr = r;
+    p->val = v;
+}
+
+void vdpqFlush() {
+    unsigned char idx;
+    unsigned int bytes = 0;
+
+    if (vdpqCount == 0) return;
+
+    for (idx=0; idx<vdpqCount; ++idx) {
+        struct VDPQ_ENTRY *p = &vdpqList[idx];
+        switch (p->op) {
+            case VDPQ_COPY:
+                vdpmemcpyfast(p->adr, p->src, p->cnt);
+                bytes += p->cnt;
+                break;
+
+            case VDPQ_FILL:
+                vdpmemsetfast(p->adr, p->val, p->cnt);
+                bytes += p->cnt;
+                break;
+
+            case VDPQ_REG:
+                VDP_SET_REGISTER(p->adr, p->val);
+                break;
+        }
+    }
+    vdpqCount = 0;
+
+    vdpqLastBytes = bytes;
+    if (bytes > vdpqPeakBytes) vdpqPeakBytes = bytes;
+}
@@ -0,0 +1,21 @@
+// VDP update queue - the menu queues writes during its logic and they go
+// out in one burst from waitVblanks(), right after the vblank, so there's
+// no tearing mid-frame. Anything written directly to VRAM must call
+// vdpqFlush() first so the order is kept.
+
+// entries the queue holds before it flushes on its own
+#define VDPQ_SIZE 8
+
+// queue a copy of cnt bytes from pSrc (must stay valid until the flush)
+void vdpqCopy(unsigned int adr, const unsigned char *pSrc, unsigned int cnt);
+// queue a fill of cnt bytes with ch
+void vdpqFill(unsigned int adr, unsigned char ch, unsigned int cnt);
+// queue a VDP register write
+void vdpqReg(unsigned char r, unsigned char v);
+// write out everything queued
+void vdpqFlush();
+
+// bytes written by the last flush and the largest flush so far, to see
+// how much of the vblank the menu uses
+extern unsigned int vdpqLastBytes;
+extern unsigned int vdpqPeakBytes;
@@ -65,7 +65,10 @@ generic
 port
    ( clk_25m0_i            : in  std_logic
    ; clk_100m0_i           : in  std_logic
+   ; clk_50m0_i            : in  std_logic -- SD-card SPI clock source
    ; clk_3m58_en_i         : in  std_logic
+   ; clk_7m16_en_i         : in  std_logic -- turbo CPU clock-enables, loader only
+   ; clk_12m5_en_i         : in  std_logic
    ; reset_i               : in  std_logic -- Soft Reset, active high
    ; por_n_i               : in  std_logic -- Power-on Reset, active low
 
@@ -115,6 +118,13 @@ port
    ; sd_cs_n_o             : out std_logic
    ; sd_cd_n_i             : in  std_logic -- Card detect, active low.
 
+   -- Configuration flash SPI interface
+   ; flash_miso_i          : in  std_logic
+   ; flash_mosi_o          : out std_logic
+   ; flash_sclk_o          : out std_logic
+   ; flash_cs_n_o          : out std_logic
+   ; flash_wp_n_o          : out std_logic
+
    ; led_o                 : out std_logic -- debug LED
 );
 end entity;
@@ -125,6 +135,12 @@ architecture rtl of colecovision is
 
    -- Z80 CPU
    signal clk_en_cpu_s                    : std_logic;
+   signal clk_en_cpu_base_s               : std_logic;        -- 3.58MHz, or turbo in the loader
+   signal cpu_hold_s                      : std_logic;        -- CPU held by a slow device
+   signal turbo_r                         : std_logic_vector( 1 downto 0) := "00";
+   signal turbo_x                         : std_logic_vector( 1 downto 0);
+   signal zero_wait_r                     : std_logic := '0'; -- no M1 wait-state in the loader
+   signal zero_wait_x                     : std_logic;
    signal nmi_n_s                         : std_logic;
    signal int_n_s                         : std_logic;
    signal iorq_n_s                        : std_logic;
@@ -181,6 +197,8 @@ architecture rtl of colecovision is
    signal ext_ram_en_s                    : std_logic := '0';
    signal ext_ram_we_n_s                  : std_logic;
    signal d_from_ext512_s                 : std_logic_vector( 7 downto 0);
+   signal ext_ram_rdy_s                   : std_logic;
+   signal ext_wait_n_s                    : std_logic;
 
    -- Data and IO bus
    signal io_decode_s                     : std_logic_vector( 2 downto 0);
@@ -205,8 +223,63 @@ architecture rtl of colecovision is
    signal sd_detect_r                     : std_logic := '0'; -- default no card.
    signal sd_slow_clk_r                   : std_logic := '1'; -- start SPI with slow clock
    signal sd_slow_clk_x                   : std_logic;
+   signal sd_high_clk_r                   : std_logic := '0'; -- 25MHz SPI, after High-Speed switch
+   signal sd_high_clk_x                   : std_logic;
+   signal sd_prefetch_r                   : std_logic := '0'; -- SPI read-ahead into the FIFO
+   signal sd_prefetch_x                   : std_logic;
    signal sd_spi_ss_n_r                   : std_logic := '1'; -- SD-card SPI device select
    signal sd_spi_ss_n_x                   : std_logic;
+   signal sd_crc_clr_r                    : std_logic := '0'; -- restart the data block CRC check
+   signal sd_crc_clr_x                    : std_logic;
+   signal sd_crc_clr_s                    : std_logic;
+   signal sd_crc_ok_s                     : std_logic;        -- data block CRC good
+   signal sd_dma_req_s                    : std_logic;
+   signal sd_dma_ack_s                    : std_logic;
+   signal d_sd_dma_s                      : std_logic_vector( 7 downto 0);
+
+   -- SD-card to SRAM DMA
+   signal dma_cs_n_s                      : std_logic;
+   signal d_from_dma_s                    : std_logic_vector( 7 downto 0);
+   signal dma_busy_s                      : std_logic;
+   signal dma_crc_clr_s                   : std_logic;
+   signal dma_ram_req_s                   : std_logic;
+   signal dma_ram_ack_s                   : std_logic;
+   signal dma_ram_addr_s                  : std_logic_vector(18 downto 0);
+   signal dma_ram_data_s                  : std_logic_vector( 7 downto 0);
+
+   -- Configuration flash SPI
+   signal flash_cs_n_s                    : std_logic;        -- flash data port selected
+   signal flash_wait_n_s                  : std_logic;        -- CPU should wait for the flash
+   signal d_from_flash_s                  : std_logic_vector( 7 downto 0);
+   signal flash_ss_n_r                    : std_logic := '1'; -- flash SPI device select
+   signal flash_ss_n_x                    : std_logic;
+   signal flash_ss_n_s                    : std_logic;
+   signal flash_wp_n_r                    : std_logic := '0'; -- flash write-protect pin
+   signal flash_wp_n_x                    : std_logic;
+
+   -- SRAM block copy and fill
+   signal copy_cs_n_s                     : std_logic;
+   signal d_from_copy_s                   : std_logic_vector( 7 downto 0);
+   signal copy_ram_req_s                  : std_logic;
+   signal copy_ram_ack_s                  : std_logic;
+   signal copy_ram_we_n_s                 : std_logic;
+   signal copy_ram_addr_s                 : std_logic_vector(18 downto 0);
+   signal copy_ram_data_s                 : std_logic_vector( 7 downto 0);
+
+   -- External SRAM DMA port, shared by the SD DMA and the copy engine
+   signal ext_dma_gnt_r                   : std_logic := '0'; -- '1' = copy engine
+   signal ext_dma_req_s                   : std_logic;
+   signal ext_dma_ack_s                   : std_logic;
+   signal ext_dma_we_n_s                  : std_logic;
+   signal ext_dma_addr_s                  : std_logic_vector(18 downto 0);
+   signal ext_dma_data_s                  : std_logic_vector( 7 downto 0);
+   signal d_from_ext_dma_s                : std_logic_vector( 7 downto 0);
+
+   -- Performance counters
+   signal perf_cs_n_s                     : std_logic;
+   signal d_from_perf_s                   : std_logic_vector( 7 downto 0);
+   signal perf_wait_s                     : std_logic;
+   signal vdp_cs_n_s                      : std_logic;
 
    -- Machine ID
    constant machine_id_c                  : std_logic_vector( 7 downto 0) := std_logic_vector(to_unsigned(mach_id_g, 8));
@@ -258,6 +331,11 @@ begin
    -- It is unclear why this is necessary, but that mystery will have to be
    -- solved later.
    --
+   -- The loader can turn it off, port >58.  Nothing in the Phoenix needs it,
+   -- the F18A takes back-to-back VDP writes at any CPU speed, and it makes
+   -- every OTIR byte 23 cycles instead of 21 (both opcode fetches wait).
+   -- Like the turbo clock, it is always back on once the loader is disabled.
+   --
    m1_wait: process (clk_25m0_i, reset_n_s, m1_n_s)
    begin
    if rising_edge(clk_25m0_i) then
@@ -265,7 +343,8 @@ begin
       m1_n_r <= m1_n_s;
 
       -- Disable during reset or non-instruction fetch cycles.
-      if reset_n_s = '0' or m1_n_s = '1' then
+      if reset_n_s = '0' or m1_n_s = '1' or
+         (zero_wait_r = '1' and rom_loader_en_r = '1') then
          m1_wait_n_r <= '1';
 
       -- Edge-detect the instruction-fetch signal and assert the wait.
@@ -273,7 +352,7 @@ begin
          m1_wait_n_r <= '0';
 
       -- Remove the wait on the next machine cycle.
-      elsif clk_3m58_en_i = '1' then
+      elsif clk_en_cpu_base_s = '1' then
          m1_wait_n_r <= '1';
       end if;
    end if;
@@ -288,8 +367,21 @@ begin
    -- Why is the wait being created via the clock enable instead of the
    -- real WAIT_n input to the CPU?  Is the T80 core WAIT_n broken?
    --
+   -- The loader can run the CPU at 7.16MHz or 12.5MHz, port >58.  Reading
+   -- port >55 to start a cartridge always drops back to 3.58MHz.
+   clk_en_cpu_base_s <=
+      clk_3m58_en_i when rom_loader_en_r = '0' else
+      clk_7m16_en_i when turbo_r = "01" else
+      clk_12m5_en_i when turbo_r(1) = '1' else
+      clk_3m58_en_i;
+
    -- Modified CPU clock enable based on slow devices or the wait state.
-   clk_en_cpu_s <= clk_3m58_en_i and sn489_ready_s and m1_wait_n_r and sd_wait_n_s;
+   cpu_hold_s   <= not (sn489_ready_s and m1_wait_n_r and sd_wait_n_s and flash_wait_n_s and ext_wait_n_s);
+   clk_en_cpu_s <= clk_en_cpu_base_s and not cpu_hold_s;
+
+   -- A turbo CPU reads the external SRAM faster than the data is registered,
+   -- the 3.58MHz enable is always late enough.
+   ext_wait_n_s <= '0' when ext_ram_en_s = '1' and ext_ram_rdy_s = '0' else '1';
 
    -- CPU maskable interrupt input, currently only the controllers.
    int_n_s <= ctrl_int_n_s;
@@ -442,17 +534,29 @@ begin
    --
    -- SD-card SPI interface
    --
+   sd_crc_clr_s <= sd_crc_clr_r or dma_crc_clr_s;
+
    sdcard: entity work.sdcard
    port map
-   ( clk_i        => clk_25m0_i
+   ( clk_i        => clk_50m0_i    -- SPI FSM clock, related to the system clock
    , reset_n_i    => reset_n_s
    , slow_clk_i   => sd_slow_clk_r -- '1' = use slow SPI clock
+   , high_clk_i   => sd_high_clk_r -- '1' = use high-speed SPI clock
+   , prefetch_i   => sd_prefetch_r -- '1' = read ahead after a CPU read
    , spi_ss_n_i   => sd_spi_ss_n_r
    , cs_n_i       => sd_cs_n_s
    , wait_n_o     => sd_wait_n_s
    , wr_n_i       => wr_n_s
    , data_i       => d_from_cpu_s
    , data_o       => d_from_sd_s
+   -- DMA
+   , dma_en_i     => dma_busy_s
+   , dma_req_i    => sd_dma_req_s
+   , dma_ack_o    => sd_dma_ack_s
+   , dma_data_o   => d_sd_dma_s
+   -- Data block CRC
+   , crc_clr_i    => sd_crc_clr_s
+   , crc_ok_o     => sd_crc_ok_s
    -- SD card interface
    , spi_cs_n_o   => sd_cs_n_o
    , spi_sclk_o   => sd_sclk_o
@@ -461,6 +565,130 @@ begin
    );
 
 
+   --
+   -- Configuration flash SPI interface
+   --
+   -- The flash is always deselected once the ROM loader is disabled.
+   flash_ss_n_s <= flash_ss_n_r or not rom_loader_en_r;
+   flash_wp_n_o <= flash_wp_n_r;
+
+   flash: entity work.spiflash
+   port map
+   ( clk_i        => clk_50m0_i    -- SPI FSM clock, related to the system clock
+   , reset_n_i    => reset_n_s
+   , spi_ss_n_i   => flash_ss_n_s
+   , cs_n_i       => flash_cs_n_s
+   , wait_n_o     => flash_wait_n_s
+   , wr_n_i       => wr_n_s
+   , data_i       => d_from_cpu_s
+   , data_o       => d_from_flash_s
+   -- Flash interface
+   , spi_cs_n_o   => flash_cs_n_o
+   , spi_sclk_o   => flash_sclk_o
+   , spi_mosi_o   => flash_mosi_o
+   , spi_miso_i   => flash_miso_i
+   );
+
+
+   --
+   -- SD-card to external SRAM DMA
+   --
+   sdcard_dma : entity work.sddma
+   port map
+   ( clk_i        => clk_25m0_i
+   , reset_n_i    => reset_n_s
+   -- CPU
+   , cs_n_i       => dma_cs_n_s
+   , wr_n_i       => wr_n_s
+   , addr_i       => cpu_addr_s(3 downto 0)
+   , data_i       => d_from_cpu_s
+   , data_o       => d_from_dma_s
+   , busy_o       => dma_busy_s
+   -- SD-card
+   , sd_req_o     => sd_dma_req_s
+   , sd_ack_i     => sd_dma_ack_s
+   , sd_data_i    => d_sd_dma_s
+   , sd_crc_clr_o => dma_crc_clr_s
+   , sd_crc_ok_i  => sd_crc_ok_s
+   -- External SRAM
+   , ram_req_o    => dma_ram_req_s
+   , ram_ack_i    => dma_ram_ack_s
+   , ram_addr_o   => dma_ram_addr_s
+   , ram_data_o   => dma_ram_data_s
+   );
+
+
+   --
+   -- External SRAM block copy and fill
+   --
+   sram_copy : entity work.ramdma
+   port map
+   ( clk_i        => clk_25m0_i
+   , reset_n_i    => reset_n_s
+   -- CPU
+   , cs_n_i       => copy_cs_n_s
+   , wr_n_i       => wr_n_s
+   , addr_i       => cpu_addr_s(3 downto 0)
+   , data_i       => d_from_cpu_s
+   , data_o       => d_from_copy_s
+   , busy_o       => open
+   -- External SRAM
+   , ram_req_o    => copy_ram_req_s
+   , ram_ack_i    => copy_ram_ack_s
+   , ram_we_n_o   => copy_ram_we_n_s
+   , ram_addr_o   => copy_ram_addr_s
+   , ram_data_o   => copy_ram_data_s
+   , ram_data_i   => d_from_ext_dma_s
+   );
+
+   -- The SRAM DMA port goes to one engine at a time.  The grant only moves
+   -- while the current engine has no request, which also means no access in
+   -- progress, since a request is held until the acknowledge.
+   process (clk_25m0_i)
+   begin
+   if rising_edge(clk_25m0_i) then
+      if reset_n_s = '0' then
+         ext_dma_gnt_r <= '0';
+      elsif ext_dma_gnt_r = '0' and dma_ram_req_s = '0' and copy_ram_req_s = '1' then
+         ext_dma_gnt_r <= '1';
+      elsif ext_dma_gnt_r = '1' and copy_ram_req_s = '0' and dma_ram_req_s = '1' then
+         ext_dma_gnt_r <= '0';
+      end if;
+   end if;
+   end process;
+
+   ext_dma_req_s  <= copy_ram_req_s  when ext_dma_gnt_r = '1' else dma_ram_req_s;
+   ext_dma_we_n_s <= copy_ram_we_n_s when ext_dma_gnt_r = '1' else '0';
+   ext_dma_addr_s <= copy_ram_addr_s when ext_dma_gnt_r = '1' else dma_ram_addr_s;
+   ext_dma_data_s <= copy_ram_data_s when ext_dma_gnt_r = '1' else dma_ram_data_s;
+   dma_ram_ack_s  <= ext_dma_ack_s and not ext_dma_gnt_r;
+   copy_ram_ack_s <= ext_dma_ack_s and ext_dma_gnt_r;
+
+
+   --
+   -- Performance counters
+   --
+   perf_wait_s <= cpu_hold_s;
+   vdp_cs_n_s  <= vdp_r_n_s and vdp_w_n_s;
+
+   perf : entity work.perfcnt
+   port map
+   ( clk_i        => clk_25m0_i
+   , clk_en_i     => clk_3m58_en_i
+   , reset_n_i    => reset_n_s
+   -- CPU
+   , cs_n_i       => perf_cs_n_s
+   , wr_n_i       => wr_n_s
+   , data_i       => d_from_cpu_s
+   , data_o       => d_from_perf_s
+   -- Events
+   , cpu_wait_i   => perf_wait_s
+   , sd_cs_n_i    => sd_cs_n_s
+   , sd_dma_ack_i => sd_dma_ack_s
+   , vdp_cs_n_i   => vdp_cs_n_s
+   );
+
+
    --
    -- The loader ROM and BIOS have different addresses at PoR to give the
    -- loader extra room, contain interrupt vectors, and make development
@@ -537,6 +765,14 @@ begin
    , cpu_we_n_i   => ext_ram_we_n_s -- active low
    , cpu_data_i   => d_from_cpu_s
    , cpu_data_o   => d_from_ext512_s
+   , cpu_rdy_o    => ext_ram_rdy_s
+   -- DMA
+   , dma_req_i    => ext_dma_req_s
+   , dma_ack_o    => ext_dma_ack_s
+   , dma_we_n_i   => ext_dma_we_n_s
+   , dma_addr_i   => ext_dma_addr_s
+   , dma_data_i   => ext_dma_data_s
+   , dma_data_o   => d_from_ext_dma_s
    -- External SRAM Interface
    , sram_addr_o  => sram_addr_o
    , sram_data_io => sram_data_io
@@ -964,12 +1200,21 @@ begin
    --
    --  >56  xxxxxx_W (W) SD-card CE_n (AKA SS_n), 0=enable
    --       xxxxxxW_ (W) SD-card speed, 1=400KHz, 0=12MHz
-   --       RxxxxxRR (R) SD-card card-detect, bit >80 1=card inserted
+   --       xxxxxWxx (W) SD-card high speed, 1=25MHz, 0=12MHz (ignored when 400KHz)
+   --       xxxxWxxx (W) SD-card read prefetch, 1=read ahead after a data read
+   --       xxxWxxxx (W) SD-card CRC restart, 1=check the next 512+2 bytes read
+   --       RxxRRRRR (R) SD-card card-detect, bit >80 1=card inserted
+   --                    SD-card CRC, bit >10 1=data block and CRC read, CRC good
    --
    --  >57  WWWWWWWW (W) SD-card Data Write
    --       RRRRRRRR (R) SD-card Data Read
    --
    --  >58  00001000 (R) Machine ID, Phoenix = 8
+   --       xxxxxxWW (W) CPU clock while the ROM loader is enabled
+   --             00     3.58MHz
+   --             01     7.16MHz
+   --             1x     12.5MHz
+   --       xxxxxWxx (W) 1 = no M1 wait-state while the ROM loader is enabled
    --
    --  >59  xxxWWWWW (W) MegaCart memory size
    --          other     512K
@@ -979,13 +1224,62 @@ begin
    --          00011      64K,  4 16K-banks
    --          00001      32K,  2 16K-banks (same as original cart)
    --
+   --  >5A  WWWWWWWW (W) SD DMA destination 512-byte block bits 7..0, SRAM A16..A9
+   --       RRRRRRRR (R) current block
+   --  >5B  xxxxxxWW (W) SD DMA destination 512-byte block bits 9..8, SRAM A18..A17
+   --       000000RR (R) current block
+   --  >5C  WWWWWWWW (W) SD DMA block count bits 7..0
+   --       RRRRRRRR (R) blocks remaining
+   --  >5D  xxxxxWWW (W) SD DMA block count bits 10..8
+   --       00000RRR (R) blocks remaining
+   --  >5E  xxxxxxWW (W) SD DMA >01 start, >02 abort
+   --       RR000000 (R) SD DMA >80 busy, >40 error
+   --
+   --       The DMA ports are only decoded while the ROM loader is enabled.
+   --
+   --  >40  WWWWWWWW (W) SRAM copy source address bits 7..0
+   --  >41  WWWWWWWW (W) SRAM copy source address bits 15..8
+   --  >42  xxxxxWWW (W) SRAM copy source address bits 18..16
+   --  >43  WWWWWWWW (W) SRAM copy destination address bits 7..0
+   --  >44  WWWWWWWW (W) SRAM copy destination address bits 15..8
+   --  >45  xxxxxWWW (W) SRAM copy destination address bits 18..16
+   --  >46  WWWWWWWW (W) SRAM copy length bits 7..0
+   --  >47  WWWWWWWW (W) SRAM copy length bits 15..8
+   --  >48  xxxxWWWW (W) SRAM copy length bits 19..16
+   --  >49  WWWWWWWW (W) SRAM fill byte
+   --  >4A  xxxxxWWW (W) SRAM >01 start copy, >05 start fill, >02 abort
+   --       R0000000 (R) SRAM copy >80 busy
+   --
+   --       The registers read back, and the copy ports are only decoded
+   --       while the ROM loader is enabled.  See peripheral/ramdma.vhd.
+   --
+   --  >4C  xxxxxxxW (W) Config flash CS_n, 0=enable
+   --       xxxxxxWx (W) Config flash WP_n, 0=write-protect pin asserted
+   --       000000RR (R) read back
+   --
+   --  >4D  WWWWWWWW (W) Config flash data write, clocks the byte out
+   --       RRRRRRRR (R) Config flash data read, clocks a byte in (sends >FF)
+   --
+   --       The flash ports are only decoded while the ROM loader is
+   --       enabled.  See peripheral/spiflash.vhd.
+   --
+   --  >5F  Wxxxxxxx (W) Performance counters, 1 = latch all four
+   --       xWxxxxxx (W) 1 = reset the counters to zero
+   --       xxxxWWWW (W) read pointer, byte 0..15 of the latched counters
+   --       RRRRRRRR (R) latched byte, the read pointer increments
+   --
+   --       Four 32-bit counters, little-endian: CPU cycles, wait states,
+   --       SD-card bytes, VDP port accesses.  See peripheral/perfcnt.vhd.
+   --
    --  >7F  xxxxxxWx (W) 0 = 8K SGM RAM, 1 = 8K CV BIOS
    --
    process
    ( cpu_addr_s, iorq_n_s, m1_n_s, wr_n_s, rd_n_s
    , d_from_cpu_s, d_from_wsg_s, sgm_en_r, sgm_8k_en_r
-   , ext_ram_bank_r, rom_loader_en_r
-   , d_from_sd_s, sd_detect_r, sd_slow_clk_r, sd_spi_ss_n_r
+   , ext_ram_bank_r, rom_loader_en_r, turbo_r, zero_wait_r
+   , d_from_sd_s, sd_detect_r, sd_slow_clk_r, sd_high_clk_r, sd_spi_ss_n_r
+   , sd_prefetch_r, sd_crc_ok_s, d_from_dma_s, d_from_perf_s, d_from_copy_s
+   , flash_ss_n_r, flash_wp_n_r, d_from_flash_s
    , real_cart_r, bank_mode_r, upmem_mode_r
    , mc_mem_size_r, mc_en_r
    ) begin
@@ -995,6 +1289,8 @@ begin
       ext_ram_bank_x    <= ext_ram_bank_r;
 
       rom_loader_en_x   <= rom_loader_en_r;
+      turbo_x           <= turbo_r;
+      zero_wait_x       <= zero_wait_r;
 
       wsg_bdir_s        <= '0';  -- bus direction
       wsg_bc_s          <= '0';  -- bus control
@@ -1002,7 +1298,16 @@ begin
       -- SD-card
       sd_cs_n_s         <= '1';
       sd_slow_clk_x     <= sd_slow_clk_r;
+      sd_high_clk_x     <= sd_high_clk_r;
+      sd_prefetch_x     <= sd_prefetch_r;
       sd_spi_ss_n_x     <= sd_spi_ss_n_r;
+      sd_crc_clr_x      <= '0';           -- strobe, only during the write
+      dma_cs_n_s        <= '1';
+      perf_cs_n_s       <= '1';
+      copy_cs_n_s       <= '1';
+      flash_cs_n_s      <= '1';
+      flash_ss_n_x      <= flash_ss_n_r;
+      flash_wp_n_x      <= flash_wp_n_r;
 
       ex_data_mux_s     <= (others => '0');
 
@@ -1019,6 +1324,35 @@ begin
       if iorq_n_s = '0' and m1_n_s = '1' then
          case cpu_addr_s(7 downto 4) is
 
+         when x"4" =>                     -- ports >40 .. >4A SRAM copy, >4C .. >4D flash
+
+            if rom_loader_en_r = '1' and unsigned(cpu_addr_s(3 downto 0)) <= 10 then
+               copy_cs_n_s <= '0';
+
+               if rd_n_s = '0' then
+                  ex_data_mux_s  <= d_from_copy_s;
+               end if;
+
+            elsif rom_loader_en_r = '1' and cpu_addr_s(3 downto 0) = x"C" then
+
+               if rd_n_s = '0' then       -- port >4C config flash control
+                  ex_data_mux_s  <= "000000" & flash_wp_n_r & flash_ss_n_r;
+               end if;
+
+               if wr_n_s = '0' then
+                  flash_wp_n_x   <= d_from_cpu_s(1);
+                  flash_ss_n_x   <= d_from_cpu_s(0);
+               end if;
+
+            elsif rom_loader_en_r = '1' and cpu_addr_s(3 downto 0) = x"D" then
+
+               flash_cs_n_s <= '0';       -- port >4D config flash data
+
+               if rd_n_s = '0' then
+                  ex_data_mux_s  <= d_from_flash_s;
+               end if;
+            end if;
+
          when x"5" =>
             case cpu_addr_s(3 downto 0) is
 
@@ -1083,11 +1417,14 @@ begin
             when x"6" =>                  -- port >56 SD-card control
 
                if rd_n_s = '0' then
-                  ex_data_mux_s  <= sd_detect_r & "00000" &
-                                    sd_slow_clk_r & sd_spi_ss_n_r;
+                  ex_data_mux_s  <= sd_detect_r & "00" & sd_crc_ok_s & sd_prefetch_r &
+                                    sd_high_clk_r & sd_slow_clk_r & sd_spi_ss_n_r;
                end if;
 
                if wr_n_s = '0' then
+                  sd_crc_clr_x  <= d_from_cpu_s(4);
+                  sd_prefetch_x <= d_from_cpu_s(3);
+                  sd_high_clk_x <= d_from_cpu_s(2);
                   sd_slow_clk_x <= d_from_cpu_s(1);
                   sd_spi_ss_n_x <= d_from_cpu_s(0);
                end if;
@@ -1100,18 +1437,41 @@ begin
                   ex_data_mux_s  <= d_from_sd_s;
                end if;
 
-            when x"8" =>                  -- port >58 machine ID
+            when x"8" =>                  -- port >58 machine ID, CPU clock
 
                if rd_n_s = '0' then
                   ex_data_mux_s  <= machine_id_c;
                end if;
 
+               if wr_n_s = '0' and rom_loader_en_r = '1' then
+                  turbo_x        <= d_from_cpu_s(1 downto 0);
+                  zero_wait_x    <= d_from_cpu_s(2);
+               end if;
+
             when x"9" =>                  -- port >59 MegaCart memory size
 
                if wr_n_s = '0' then
                   mc_mem_size_x  <= d_from_cpu_s(4 downto 0);
                end if;
 
+            when x"A" | x"B" | x"C" | x"D" | x"E" =>  -- ports >5A .. >5E SD DMA
+
+               if rom_loader_en_r = '1' then
+                  dma_cs_n_s <= '0';
+
+                  if rd_n_s = '0' then
+                     ex_data_mux_s  <= d_from_dma_s;
+                  end if;
+               end if;
+
+            when x"F" =>                  -- port >5F performance counters
+
+               perf_cs_n_s <= '0';
+
+               if rd_n_s = '0' then
+                  ex_data_mux_s  <= d_from_perf_s;
+               end if;
+
             when others => null;
             end case;
 			when x"3" =>
@@ -1137,7 +1497,9 @@ begin
 
 
    -- System reset and register transfer.
-   process (clk_25m0_i, reset_i, clk_3m58_en_i)
+   -- Registers follow the CPU clock-enable, so a turbo IO cycle cannot be
+   -- missed between two 3.58MHz enables.
+   process (clk_25m0_i, reset_i, clk_en_cpu_base_s)
    begin
    if rising_edge(clk_25m0_i) then
       if reset_i = '1' then
@@ -1145,9 +1507,16 @@ begin
          sgm_8k_en_r       <= '0';           -- BIOS over SGM 8K RAM at >0000
          ext_ram_bank_r    <= "0001";        -- external RAM bank select
          rom_loader_en_r   <= '1';           -- enabled ROM loader
+         turbo_r           <= "00";          -- stock CPU clock
+         zero_wait_r       <= '0';           -- stock M1 wait-state
          sd_detect_r       <= '0';           -- no card until sampled
          sd_slow_clk_r     <= '1';           -- fall-back to SD-card SPI slow clock
+         sd_high_clk_r     <= '0';           -- card must be switched to High-Speed again
+         sd_prefetch_r     <= '0';           -- no read-ahead
          sd_spi_ss_n_r     <= '1';           -- de-select the SD-card device
+         sd_crc_clr_r      <= '0';
+         flash_ss_n_r      <= '1';           -- de-select the config flash
+         flash_wp_n_r      <= '0';           -- flash write-protect pin asserted
          real_cart_r       <= '1';           -- default to a real cartridge
          bank_mode_r       <= "00";          -- no banking
          upmem_mode_r      <= "00";          -- upper memory selection does not matter
@@ -1156,14 +1525,21 @@ begin
          mc_addr_r         <= "11111";       -- default to top of 512K memory
          mc_en_r           <= '0';           -- disable MegaCart
 
-      elsif clk_3m58_en_i = '1' then
+      elsif clk_en_cpu_base_s = '1' then
          sgm_en_r          <= sgm_en_x;
          sgm_8k_en_r       <= sgm_8k_en_x;
          ext_ram_bank_r    <= ext_ram_bank_x;
          rom_loader_en_r   <= rom_loader_en_x;
+         turbo_r           <= turbo_x;
+         zero_wait_r       <= zero_wait_x;
          sd_detect_r       <= not sd_cd_n_i; -- sample and invert input directly
          sd_slow_clk_r     <= sd_slow_clk_x;
+         sd_high_clk_r     <= sd_high_clk_x;
+         sd_prefetch_r     <= sd_prefetch_x;
          sd_spi_ss_n_r     <= sd_spi_ss_n_x;
+         sd_crc_clr_r      <= sd_crc_clr_x;
+         flash_ss_n_r      <= flash_ss_n_x;
+         flash_wp_n_r      <= flash_wp_n_x;
          real_cart_r       <= real_cart_x;
          bank_mode_r       <= bank_mode_x;
          upmem_mode_r      <= upmem_mode_x;
@@ -59,6 +59,7 @@
 -- CLK_OUT2___100.000______0.000______50.0______234.661____230.333
 -- CLK_OUT3___125.000______0.000______50.0______223.810____230.333
 -- CLK_OUT4___125.000____180.000______50.0______223.810____230.333
+-- CLK_OUT5____50.000______0.000______50.0______274.364____230.333
 --
 ------------------------------------------------------------------------------
 -- "Input Clock   Freq (MHz)    Input Jitter (UI)"
@@ -82,13 +83,14 @@ port
   clk_25m0_o          : out    std_logic;
   clk_100m0_o          : out    std_logic;
   clk_125m0_o          : out    std_logic;
-  clk_125m0_n_o          : out    std_logic
+  clk_125m0_n_o          : out    std_logic;
+  clk_50m0_o          : out    std_logic
  );
 end clk_sys_pll;
 
 architecture xilinx of clk_sys_pll is
   attribute CORE_GENERATION_INFO : string;
-  attribute CORE_GENERATION_INFO of xilinx : architecture is "clk_sys_pll,clk_wiz_v3_6,{component_name=clk_sys_pll,use_phase_alignment=false,use_min_o_jitter=false,use_max_i_jitter=false,use_dyn_phase_shift=false,use_inclk_switchover=false,use_dyn_reconfig=false,feedback_source=FDBK_AUTO,primtype_sel=PLL_BASE,num_out_clk=4,clkin1_period=20.000,clkin2_period=20.000,use_power_down=false,use_reset=false,use_locked=false,use_inclk_stopped=false,use_status=false,use_freeze=false,use_clk_valid=false,feedback_type=SINGLE,clock_mgr_type=MANUAL,manual_override=false}";
+  attribute CORE_GENERATION_INFO of xilinx : architecture is "clk_sys_pll,clk_wiz_v3_6,{component_name=clk_sys_pll,use_phase_alignment=false,use_min_o_jitter=false,use_max_i_jitter=false,use_dyn_phase_shift=false,use_inclk_switchover=false,use_dyn_reconfig=false,feedback_source=FDBK_AUTO,primtype_sel=PLL_BASE,num_out_clk=5,clkin1_period=20.000,clkin2_period=20.000,use_power_down=false,use_reset=false,use_locked=false,use_inclk_stopped=false,use_status=false,use_freeze=false,use_clk_valid=false,feedback_type=SINGLE,clock_mgr_type=MANUAL,manual_override=false}";
   -- Input clock buffering / unused connectors
   signal clkin1      : std_logic;
   -- Output clock buffering / unused connectors
@@ -97,7 +99,7 @@ architecture xilinx of clk_sys_pll is
   signal clkout1          : std_logic;
   signal clkout2          : std_logic;
   signal clkout3          : std_logic;
-  signal clkout4_unused   : std_logic;
+  signal clkout4          : std_logic;
   signal clkout5_unused   : std_logic;
   -- Unused status signals
   signal locked_unused    : std_logic;
@@ -139,6 +141,9 @@ begin
     CLKOUT3_DIVIDE       => 4,
     CLKOUT3_PHASE        => 180.000,
     CLKOUT3_DUTY_CYCLE   => 0.500,
+    CLKOUT4_DIVIDE       => 10,
+    CLKOUT4_PHASE        => 0.000,
+    CLKOUT4_DUTY_CYCLE   => 0.500,
     CLKIN_PERIOD         => 20.000,
     REF_JITTER           => 0.010)
   port map
@@ -148,7 +153,7 @@ begin
     CLKOUT1             => clkout1,
     CLKOUT2             => clkout2,
     CLKOUT3             => clkout3,
-    CLKOUT4             => clkout4_unused,
+    CLKOUT4             => clkout4,
     CLKOUT5             => clkout5_unused,
     LOCKED              => locked_unused,
     RST                 => '0',
@@ -182,4 +187,9 @@ begin
    (O   => clk_125m0_n_o,
     I   => clkout3);
 
+  clkout5_buf : BUFG
+  port map
+   (O   => clk_50m0_o,
+    I   => clkout4);
+
 end xilinx;
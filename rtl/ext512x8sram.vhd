@@ -34,10 +34,18 @@
 
 --
 -- A memory cycle takes two clock cycles, so the clock must be at least twice
--- as fast as the CPU expects a cycles to take.
+-- as fast as the CPU expects a cycles to take.  A faster CPU can use
+-- cpu_rdy_o as a wait-state.
 --
 -- Maximum clock is 100MHz.  Tested up to 25MHz.
 --
+-- A second port allows a DMA engine to use the memory when the CPU is not
+-- accessing it.  The CPU always has priority, and a DMA read or write takes
+-- three clock cycles, so a CPU access is delayed by no more than that.  The
+-- DMA engine holds dma_req_i, dma_we_n_i and its address and data until
+-- dma_ack_o, which is asserted for one clock at the end of the access.  Read
+-- data is valid on dma_data_o with the acknowledge, until the next read.
+--
 
 
 library ieee;
@@ -53,6 +61,14 @@ port
    ; cpu_we_n_i         : in     std_logic
    ; cpu_data_i         : in     std_logic_vector(7 downto 0)
    ; cpu_data_o         : out    std_logic_vector(7 downto 0)
+   ; cpu_rdy_o          : out    std_logic -- '1' once cpu_data_o is valid
+   -- DMA
+   ; dma_req_i          : in     std_logic
+   ; dma_ack_o          : out    std_logic
+   ; dma_we_n_i         : in     std_logic
+   ; dma_addr_i         : in     std_logic_vector(18 downto 0)
+   ; dma_data_i         : in     std_logic_vector(7 downto 0)
+   ; dma_data_o         : out    std_logic_vector(7 downto 0)
    -- External SRAM Interface
    ; sram_addr_o        : out    std_logic_vector(18 downto 0)
    ; sram_data_io       : inout  std_logic_vector(7 downto 0)
@@ -70,12 +86,16 @@ architecture rtl of ext512x8sram is
    signal d_to_ext_x          : std_logic_vector( 7 downto 0);
    signal d_from_ext_r        : std_logic_vector( 7 downto 0) := (others => '0');
    signal d_from_ext_x        : std_logic_vector( 7 downto 0);
+   signal d_from_dma_r        : std_logic_vector( 7 downto 0) := (others => '0');
+   signal d_from_dma_x        : std_logic_vector( 7 downto 0);
    signal ce_n_r              : std_logic := '1';
    signal ce_n_x              : std_logic;
    signal we_n_r              : std_logic := '1';
    signal we_n_x              : std_logic;
+   signal rdy_r               : std_logic := '0';
+   signal rdy_x               : std_logic;
 
-   type ramfsm_t is (st_idle, st_rdwr);
+   type ramfsm_t is (st_idle, st_rdwr, st_dma_addr, st_dma_wr, st_dma_end);
    signal ram_st_r            : ramfsm_t := st_idle;
    signal ram_st_x            : ramfsm_t;
 
@@ -97,15 +117,26 @@ begin
 
    cpu_data_o  <= d_from_ext_r;
 
+   -- Read data is registered one clock into the access, which a CPU faster
+   -- than a quarter of the clock, or delayed by a DMA write, must wait for.
+   rdy_x       <= '1' when ram_st_r = st_rdwr and cpu_en_i = '1' else '0';
+   cpu_rdy_o   <= rdy_r;
+
+   -- The DMA write is done once WE has gone high with the address held.
+   dma_ack_o   <= '1' when ram_st_r = st_dma_end else '0';
+   dma_data_o  <= d_from_dma_r;
+
 
    process ( ram_st_r, cpu_en_i, cpu_addr_i, cpu_we_n_i, cpu_data_i,
-             d_from_ext_r, sram_data_io )
+             dma_req_i, dma_we_n_i, dma_addr_i, dma_data_i, d_from_ext_r,
+             d_from_dma_r, sram_data_io )
    begin
 
       ram_st_x       <= ram_st_r;
       addr_x         <= cpu_addr_i;
       d_to_ext_x     <= cpu_data_i;
       d_from_ext_x   <= d_from_ext_r;
+      d_from_dma_x   <= d_from_dma_r;
       ce_n_x         <= '1';
       we_n_x         <= '1';
 
@@ -117,6 +148,12 @@ begin
          if cpu_en_i = '1' then
             ram_st_x <= st_rdwr;
             ce_n_x   <= '0';
+
+         elsif dma_req_i = '1' then
+            ram_st_x    <= st_dma_addr;
+            addr_x      <= dma_addr_i;
+            d_to_ext_x  <= dma_data_i;
+            ce_n_x      <= '0';
          end if;
 
       when st_rdwr =>
@@ -137,6 +174,32 @@ begin
 
          end if;
 
+      -- DMA write: set up the address, strobe WE, then release WE with the
+      -- address still held.  DMA read: the same without WE, and register the
+      -- data at the end.
+      when st_dma_addr =>
+
+         ram_st_x    <= st_dma_wr;
+         addr_x      <= dma_addr_i;
+         d_to_ext_x  <= dma_data_i;
+         ce_n_x      <= '0';
+         we_n_x      <= dma_we_n_i;
+
+      when st_dma_wr =>
+
+         ram_st_x    <= st_dma_end;
+         addr_x      <= dma_addr_i;
+         d_to_ext_x  <= dma_data_i;
+         ce_n_x      <= '0';
+
+         if dma_we_n_i = '1' then
+            d_from_dma_x <= sram_data_io;
+         end if;
+
+      when st_dma_end =>
+
+         ram_st_x    <= st_idle;
+
       end case;
    end process;
 
@@ -147,8 +210,10 @@ begin
          addr_r         <= addr_x;
          d_to_ext_r     <= d_to_ext_x;
          d_from_ext_r   <= d_from_ext_x;
+         d_from_dma_r   <= d_from_dma_x;
          ce_n_r         <= ce_n_x;
          we_n_r         <= we_n_x;
+         rdy_r          <= rdy_x;
       end if;
    end process;
 
@@ -468,9 +468,11 @@ begin
       '1' when ctrl_en_key_n_i = '1' and ctrl_en_joy_n_i = '0' else
       keyjoy_sel_r;
 
-   process ( clk_i, clk_3m58_en_i )
+   -- Sampled every clock, the select strobe of a turbo CPU IO cycle can be
+   -- shorter than the 3.58MHz enable period.
+   process ( clk_i )
    begin
-      if rising_edge(clk_i) and clk_3m58_en_i = '1' then
+      if rising_edge(clk_i) then
          if reset_n_i = '0' then
             keyjoy_sel_r <= '0';
          else
@@ -0,0 +1,206 @@
+--
+-- Performance counters for firmware profiling.
+--
+
+-- Released under the 3-Clause BSD License:
+--
+-- Copyright 2020 Phoenix contributors
+--
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+--
+-- 1. Redistributions of source code must retain the above copyright notice,
+-- this list of conditions and the following disclaimer.
+--
+-- 2. Redistributions in binary form must reproduce the above copyright
+-- notice, this list of conditions and the following disclaimer in the
+-- documentation and/or other materials provided with the distribution.
+--
+-- 3. Neither the name of the copyright holder nor the names of its
+-- contributors may be used to endorse or promote products derived from this
+-- software without specific prior written permission.
+--
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+-- ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+-- LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+-- CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+-- SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+-- INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+-- CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+-- ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+-- POSSIBILITY OF SUCH DAMAGE.
+
+--
+-- Four free-running 32-bit counters that the Z80 can snapshot and read back,
+-- to time code paths in CPU cycles instead of vblank ticks:
+--
+--   0  CPU cycles, every 3.58MHz clock enable (279.4ns each)
+--   1  Wait states, cycles the CPU clock enable was held off (VDP, SD-card,
+--      M1 wait)
+--   2  SD-card bytes, CPU data port accesses plus DMA engine bytes
+--   3  VDP port accesses, reads and writes
+--
+-- The cycle counter wraps after about 20 minutes.  The counters are not
+-- readable directly, a latch copies all four at the same time so the bytes
+-- read back are always consistent, and the counters keep running.
+--
+-- Register (a single I/O port):
+--
+--  >5F  Wxxxxxxx (W) 1 = latch all counters
+--       xWxxxxxx (W) 1 = reset all counters to zero (after the latch)
+--       xxxxWWWW (W) read pointer, byte 0..15 of the latched counters
+--       RRRRRRRR (R) latched byte at the read pointer, then increment it
+--
+-- The latched bytes are little-endian, counter 0 first, so a write of >80
+-- followed by 16 reads (INIR) gives the four counters in order.
+--
+-- The CPU select is held for the whole IO cycle.  A write is applied on
+-- the first clock it is seen, as in ramdma.vhd, so a latch and reset in
+-- one write latches the running counters and then zeroes them.  The read
+-- pointer moves when the select is released.
+--
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity perfcnt is
+port
+   ( clk_i              : in     std_logic -- system clock
+   ; clk_en_i           : in     std_logic -- CPU clock enable, before wait states
+   ; reset_n_i          : in     std_logic -- active low
+
+   -- CPU
+   ; cs_n_i             : in     std_logic -- '0' for the duration of a register access
+   ; wr_n_i             : in     std_logic
+   ; data_i             : in     std_logic_vector( 7 downto 0)
+   ; data_o             : out    std_logic_vector( 7 downto 0)
+
+   -- Events
+   ; cpu_wait_i         : in     std_logic -- '1' when the CPU clock enable is held off
+   ; sd_cs_n_i          : in     std_logic -- SD-card data port select
+   ; sd_dma_ack_i       : in     std_logic -- SD-card DMA byte handshake
+   ; vdp_cs_n_i         : in     std_logic -- VDP port select, read or write
+);
+end entity;
+
+architecture rtl of perfcnt is
+
+   type cnt_t is array (0 to 3) of unsigned(31 downto 0);
+   signal cnt_r, cnt_x           : cnt_t := (others => (others => '0'));
+   signal lat_r, lat_x           : cnt_t := (others => (others => '0'));
+   signal ptr_r, ptr_x           : unsigned( 3 downto 0) := (others => '0');
+
+   -- Previous values for edge detection.
+   signal cs_n_r                 : std_logic := '1';
+   signal rd_r, rd_x             : std_logic := '0'; -- the access is a read
+   signal sd_cs_n_r              : std_logic := '1';
+   signal sd_dma_ack_r           : std_logic := '0';
+   signal vdp_cs_n_r             : std_logic := '1';
+
+
+begin
+
+   -- Register read, byte ptr_r(1 downto 0) of counter ptr_r(3 downto 2).
+   process ( lat_r, ptr_r )
+      variable lat_v : unsigned(31 downto 0);
+   begin
+      lat_v := lat_r(to_integer(ptr_r(3 downto 2)));
+
+      case ptr_r(1 downto 0) is
+      when "00"   => data_o <= std_logic_vector(lat_v( 7 downto  0));
+      when "01"   => data_o <= std_logic_vector(lat_v(15 downto  8));
+      when "10"   => data_o <= std_logic_vector(lat_v(23 downto 16));
+      when others => data_o <= std_logic_vector(lat_v(31 downto 24));
+      end case;
+   end process;
+
+
+   process ( cnt_r, lat_r, ptr_r, rd_r, cs_n_r, sd_cs_n_r, sd_dma_ack_r, vdp_cs_n_r
+           , clk_en_i, cs_n_i, wr_n_i, data_i, cpu_wait_i, sd_cs_n_i, sd_dma_ack_i, vdp_cs_n_i )
+      variable sd_v : unsigned( 1 downto 0);
+   begin
+
+      cnt_x <= cnt_r;
+      lat_x <= lat_r;
+      ptr_x <= ptr_r;
+      rd_x  <= rd_r;
+
+      if clk_en_i = '1' then
+         cnt_x(0) <= cnt_r(0) + 1;
+
+         if cpu_wait_i = '1' then
+            cnt_x(1) <= cnt_r(1) + 1;
+         end if;
+      end if;
+
+      -- A CPU data port access and a DMA byte can end in the same clock.
+      sd_v := "00";
+      if sd_cs_n_r = '1' and sd_cs_n_i = '0' then
+         sd_v := sd_v + 1;
+      end if;
+      if sd_dma_ack_r = '0' and sd_dma_ack_i = '1' then
+         sd_v := sd_v + 1;
+      end if;
+      cnt_x(2) <= cnt_r(2) + sd_v;
+
+      if vdp_cs_n_r = '1' and vdp_cs_n_i = '0' then
+         cnt_x(3) <= cnt_r(3) + 1;
+      end if;
+
+      -- Register access.  The write acts on its first clock only, so the
+      -- counters latched by >C0 are the ones from before the reset.
+      if cs_n_i = '0' then
+         rd_x <= wr_n_i;
+
+         if wr_n_i = '0' and (cs_n_r = '1' or rd_r = '1') then
+            ptr_x <= unsigned(data_i(3 downto 0));
+
+            if data_i(7) = '1' then
+               lat_x <= cnt_r;
+            end if;
+
+            if data_i(6) = '1' then
+               cnt_x <= (others => (others => '0'));
+            end if;
+         end if;
+
+      elsif cs_n_r = '0' and rd_r = '1' then
+         ptr_x <= ptr_r + 1;
+      end if;
+
+   end process;
+
+
+   process ( clk_i )
+   begin
+      if rising_edge(clk_i) then
+         if reset_n_i = '0' then
+
+            cnt_r          <= (others => (others => '0'));
+            lat_r          <= (others => (others => '0'));
+            ptr_r          <= (others => '0');
+            rd_r           <= '0';
+            cs_n_r         <= '1';
+            sd_cs_n_r      <= '1';
+            sd_dma_ack_r   <= '0';
+            vdp_cs_n_r     <= '1';
+
+         else
+
+            cnt_r          <= cnt_x;
+            lat_r          <= lat_x;
+            ptr_r          <= ptr_x;
+            rd_r           <= rd_x;
+            cs_n_r         <= cs_n_i;
+            sd_cs_n_r      <= sd_cs_n_i;
+            sd_dma_ack_r   <= sd_dma_ack_i;
+            vdp_cs_n_r     <= vdp_cs_n_i;
+
+         end if;
+      end if;
+   end process;
+
+end rtl;
@@ -0,0 +1,262 @@
+--
+-- External SRAM block copy and fill engine.
+--
+
+-- Released under the 3-Clause BSD License:
+--
+-- Copyright 2020 Phoenix contributors
+--
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+--
+-- 1. Redistributions of source code must retain the above copyright notice,
+-- this list of conditions and the following disclaimer.
+--
+-- 2. Redistributions in binary form must reproduce the above copyright
+-- notice, this list of conditions and the following disclaimer in the
+-- documentation and/or other materials provided with the distribution.
+--
+-- 3. Neither the name of the copyright holder nor the names of its
+-- contributors may be used to endorse or promote products derived from this
+-- software without specific prior written permission.
+--
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+-- ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+-- LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+-- CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+-- SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+-- INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+-- CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+-- ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+-- POSSIBILITY OF SUCH DAMAGE.
+
+--
+-- Copies or fills a block of the 512K external SRAM without the Z80, for bank
+-- to bank copies, RAM clears and MegaCart relocation.  Addresses are physical
+-- SRAM addresses, so 32K RAM bank n (port >54) starts at n * >8000.
+--
+-- A copy reads one byte and writes it, a fill only writes the fill byte.
+-- Both go through the ext512x8sram DMA port between CPU memory cycles, at
+-- about 10 clocks per copied byte and 5 per filled byte, so a 32K bank copy
+-- takes about 13ms and a 32K fill about 7ms at 25MHz.  Copies always run
+-- upwards, so an overlapping copy to a higher address repeats the source.
+--
+-- Registers (addr_i is the LS nibble of the I/O port):
+--
+--  >40  WWWWWWWW (W) Source address bits 7..0
+--  >41  WWWWWWWW (W) Source address bits 15..8
+--  >42  xxxxxWWW (W) Source address bits 18..16
+--  >43  WWWWWWWW (W) Destination address bits 7..0
+--  >44  WWWWWWWW (W) Destination address bits 15..8
+--  >45  xxxxxWWW (W) Destination address bits 18..16
+--  >46  WWWWWWWW (W) Length bits 7..0
+--  >47  WWWWWWWW (W) Length bits 15..8
+--  >48  xxxxWWWW (W) Length bits 19..16, 512K max
+--  >49  WWWWWWWW (W) Fill byte
+--  >4A  xxxxxWxW (W) >01 start a copy, >05 start a fill
+--       xxxxxxWx (W) >02 abort
+--       R0000000 (R) >80 busy
+--
+-- All registers read back, and the address and length registers track the
+-- transfer.  They can only be written while the engine is idle, and a start
+-- with a zero length is ignored.
+--
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity ramdma is
+port
+   ( clk_i              : in     std_logic -- system clock
+   ; reset_n_i          : in     std_logic -- active low
+
+   -- CPU
+   ; cs_n_i             : in     std_logic -- '0' for the duration of a register access
+   ; wr_n_i             : in     std_logic
+   ; addr_i             : in     std_logic_vector( 3 downto 0)
+   ; data_i             : in     std_logic_vector( 7 downto 0)
+   ; data_o             : out    std_logic_vector( 7 downto 0)
+   ; busy_o             : out    std_logic
+
+   -- SRAM byte reads and writes
+   ; ram_req_o          : out    std_logic
+   ; ram_ack_i          : in     std_logic
+   ; ram_we_n_o         : out    std_logic
+   ; ram_addr_o         : out    std_logic_vector(18 downto 0)
+   ; ram_data_o         : out    std_logic_vector( 7 downto 0)
+   ; ram_data_i         : in     std_logic_vector( 7 downto 0)
+);
+end entity;
+
+architecture rtl of ramdma is
+
+   type state_t is (st_idle, st_read, st_write);
+   signal state_r, state_x       : state_t;
+
+   signal src_r, src_x           : unsigned(18 downto 0) := (others => '0');
+   signal dst_r, dst_x           : unsigned(18 downto 0) := (others => '0');
+   signal len_r, len_x           : unsigned(19 downto 0) := (others => '0');
+   signal fill_r, fill_x         : std_logic_vector( 7 downto 0) := (others => '0');
+   signal data_r, data_x         : std_logic_vector( 7 downto 0) := (others => '0');
+   signal mode_r, mode_x         : std_logic := '0'; -- '1' = fill
+
+   signal ram_req_r, ram_req_x   : std_logic := '0';
+
+   -- The CPU select is held for the whole IO cycle, so only act on the
+   -- first clock of a control register write.
+   signal cs_n_r                 : std_logic := '1';
+   signal busy_s                 : std_logic;
+
+
+begin
+
+   busy_s      <= '0' when state_r = st_idle else '1';
+   busy_o      <= busy_s;
+
+   ram_req_o   <= ram_req_r;
+   ram_we_n_o  <= '1' when state_r = st_read else '0';
+   ram_addr_o  <= std_logic_vector(src_r) when state_r = st_read else
+                  std_logic_vector(dst_r);
+   ram_data_o  <= data_r;
+
+   -- Register reads.
+   process ( addr_i, src_r, dst_r, len_r, fill_r, busy_s )
+   begin
+      case addr_i is
+      when x"0"   => data_o <= std_logic_vector(src_r( 7 downto  0));
+      when x"1"   => data_o <= std_logic_vector(src_r(15 downto  8));
+      when x"2"   => data_o <= "00000" & std_logic_vector(src_r(18 downto 16));
+      when x"3"   => data_o <= std_logic_vector(dst_r( 7 downto  0));
+      when x"4"   => data_o <= std_logic_vector(dst_r(15 downto  8));
+      when x"5"   => data_o <= "00000" & std_logic_vector(dst_r(18 downto 16));
+      when x"6"   => data_o <= std_logic_vector(len_r( 7 downto  0));
+      when x"7"   => data_o <= std_logic_vector(len_r(15 downto  8));
+      when x"8"   => data_o <= "0000" & std_logic_vector(len_r(19 downto 16));
+      when x"9"   => data_o <= fill_r;
+      when others => data_o <= busy_s & "0000000";
+      end case;
+   end process;
+
+
+   process ( state_r, src_r, dst_r, len_r, fill_r, data_r, mode_r
+           , ram_req_r, cs_n_r, busy_s
+           , cs_n_i, wr_n_i, addr_i, data_i, ram_ack_i, ram_data_i )
+   begin
+
+      state_x     <= state_r;
+      src_x       <= src_r;
+      dst_x       <= dst_r;
+      len_x       <= len_r;
+      fill_x      <= fill_r;
+      data_x      <= data_r;
+      mode_x      <= mode_r;
+      ram_req_x   <= ram_req_r;
+
+      -- Register writes.
+      if cs_n_i = '0' and wr_n_i = '0' and busy_s = '0' then
+         case addr_i is
+         when x"0"   => src_x( 7 downto  0) <= unsigned(data_i);
+         when x"1"   => src_x(15 downto  8) <= unsigned(data_i);
+         when x"2"   => src_x(18 downto 16) <= unsigned(data_i(2 downto 0));
+         when x"3"   => dst_x( 7 downto  0) <= unsigned(data_i);
+         when x"4"   => dst_x(15 downto  8) <= unsigned(data_i);
+         when x"5"   => dst_x(18 downto 16) <= unsigned(data_i(2 downto 0));
+         when x"6"   => len_x( 7 downto  0) <= unsigned(data_i);
+         when x"7"   => len_x(15 downto  8) <= unsigned(data_i);
+         when x"8"   => len_x(19 downto 16) <= unsigned(data_i(3 downto 0));
+         when x"9"   => fill_x              <= data_i;
+         when others => null;
+         end case;
+      end if;
+
+      -- Control, start only on the first clock of the write so a finished
+      -- transfer is not restarted.
+      if cs_n_i = '0' and wr_n_i = '0' and cs_n_r = '1' and addr_i = x"A" then
+         if data_i(1) = '1' then
+            -- Abort.  A byte in progress in the SRAM controller finishes on
+            -- its own.
+            state_x     <= st_idle;
+            ram_req_x   <= '0';
+
+         elsif data_i(0) = '1' and busy_s = '0' and len_r /= 0 then
+            mode_x      <= data_i(2);
+            data_x      <= fill_r;
+
+            if data_i(2) = '1' then
+               state_x  <= st_write;
+            else
+               state_x  <= st_read;
+            end if;
+         end if;
+      end if;
+
+      case state_r is
+
+      when st_idle =>
+         null;
+
+      when st_read =>
+
+         ram_req_x <= '1';
+
+         if ram_req_r = '1' and ram_ack_i = '1' then
+            ram_req_x   <= '0';
+            data_x      <= ram_data_i;
+            src_x       <= src_r + 1;
+            state_x     <= st_write;
+         end if;
+
+      when st_write =>
+
+         ram_req_x <= '1';
+
+         if ram_req_r = '1' and ram_ack_i = '1' then
+            ram_req_x   <= '0';
+            dst_x       <= dst_r + 1;
+            len_x       <= len_r - 1;
+
+            if len_r = 1 then
+               state_x  <= st_idle;
+            elsif mode_r = '0' then
+               state_x  <= st_read;
+            end if;
+         end if;
+
+      end case;
+   end process;
+
+
+   process ( clk_i )
+   begin
+      if rising_edge(clk_i) then
+         if reset_n_i = '0' then
+
+            state_r     <= st_idle;
+            src_r       <= (others => '0');
+            dst_r       <= (others => '0');
+            len_r       <= (others => '0');
+            fill_r      <= (others => '0');
+            mode_r      <= '0';
+            ram_req_r   <= '0';
+            cs_n_r      <= '1';
+
+         else
+
+            state_r     <= state_x;
+            src_r       <= src_x;
+            dst_r       <= dst_x;
+            len_r       <= len_x;
+            fill_r      <= fill_x;
+            data_r      <= data_x;
+            mode_r      <= mode_x;
+            ram_req_r   <= ram_req_x;
+            cs_n_r      <= cs_n_i;
+
+         end if;
+      end if;
+   end process;
+
+end rtl;
@@ -1,5 +1,5 @@
 --
--- SD-card SPI with two-speed clock support and CPU-wait signal.
+-- SD-card SPI with three-speed clock support and CPU-wait signal.
 --
 
 -- Released under the 3-Clause BSD License:
@@ -40,22 +40,32 @@
 --   MMC SPI  20MHz  2.5MB/s
 --   SD  SPI  25MHz  2.125MB/s
 --
--- The Phoenix system clock is around 25MHz, which is divided by two in the
--- SPI FSM to derive the SPI clock.  This easily stays under the 20MHz max
--- clock to support MMC.  When in slow-clock mode, the input clock is divided
--- by 64 to create a clock below the required 400KHz.
+-- The SPI FSM is clocked by a 50MHz clock from the system PLL, which is
+-- related to (and phase aligned with) the 25MHz system clock.  Each SPI clock
+-- phase is one FSM state, so the fastest SPI clock is the input clock divided
+-- by two.
+--
+-- In fast-clock mode the FSM only advances every other input clock, giving a
+-- 12.5MHz SPI clock that easily stays under the 20MHz max clock to support
+-- MMC.  In high-clock mode the FSM advances every input clock for a 25MHz SPI
+-- clock, which is the limit for an SD-card in Default Speed mode.  The host
+-- should only select it after the card has accepted a switch to High-Speed
+-- mode (CMD6), so MMC and older cards stay at the fast clock.  When in
+-- slow-clock mode, the input clock is divided by 128 to create a clock below
+-- the required 400KHz.  Slow-clock overrides high-clock.
 --
 -- Still, these clocks are fast enough to read or write a byte at the typical
 -- speed of the Z80; and able to read or write an entire 512K memory in about 1
 -- second.
 --
--- Assuming a system clock of 25MHz, the resulting clock speeds and Z80 I/O
+-- Assuming an input clock of 50MHz, the resulting clock speeds and Z80 I/O
 -- instruction comparison:
 --
 --         Clock     Period    8-bit transfer
 --       ------------------------------------
 -- Slow  390.62KHz    2.56us   23.52us
 -- Fast   12.5MHz    80.00ns  640.00ns
+-- High   25.0MHz    40.00ns  320.00ns
 -- Z80     3.58MHz  279.36ns    1.11us (4-cycle) I/O instruction
 --
 -- Using the fast clock, an 8-bit transfer should be fast enough to only cause
@@ -125,8 +135,8 @@
 --  |      ___|_________|_________|_________|_________|              } Write cycle
 -- -------X____________________________________________X-  Data Out /
 --  |         |         |         |         |         |
--- VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV  system clock, 25MHz max
--- \/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/  fast SPI clock, system clock/2
+-- VVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVVV  system clock, 25MHz
+-- \/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/\/  fast SPI clock, input clock/4
 -- _|_________|_    | | | | | | | |         |_________|__
 --              \__________________________/               cs_n_i (IOR_n + IO decode)
 -- _|_________|___  | | | | | | | |  _______|_________|__
@@ -143,7 +153,49 @@
 -- hold_n_o signal low, which will cause the CPU to wait.
 --
 -- The slow clock must be used to initialize the SD-card to SPI mode.
--- After that, the fast clock can be used.
+-- After that, the fast clock can be used, and the high clock once the card
+-- has accepted the switch to High-Speed mode.
+--
+--
+-- Read prefetch:
+--
+-- When prefetch_i is '1' and the card is selected, the first CPU read arms the
+-- prefetch, and the FSM keeps clocking dummy >FF bytes out of the card into a
+-- 4-byte FIFO without waiting for the CPU.  CPU reads are then served from
+-- the FIFO with no additional wait-states, and the SPI transfers overlap the
+-- CPU's INIR loop.  Prefetched bytes are always returned in order, so turning
+-- prefetch off only stops the clocking; any bytes still in the FIFO are read
+-- first.
+--
+-- A CPU write waits for any prefetch in progress, discards the FIFO and
+-- disarms the prefetch, so commands are never interleaved with dummy bytes.
+-- Deselecting the card also discards the FIFO.  The extra dummy bytes the card
+-- sees after a data block are idle bytes as far as the card is concerned.
+--
+-- Changes to spi_ss_n_i only take effect between transfers.
+--
+--
+-- DMA:
+--
+-- While dma_en_i is '1' the controller belongs to a DMA engine: prefetch is
+-- stopped and CPU accesses wait.  The DMA engine requests a read transfer by
+-- raising dma_req_i, the byte is valid on dma_data_o while dma_ack_o is '1',
+-- and dma_ack_o drops after dma_req_i is released (4-phase handshake, so the
+-- DMA engine can run from the related system clock).
+--
+--
+-- Data block CRC:
+--
+-- SD-card data blocks are followed by a CRC-16 (x^16 + x^12 + x^5 + 1, initial
+-- value 0, i.e. CRC-16/XMODEM).  Setting crc_clr_i to '1' after the start
+-- block token restarts the check, and the next 514 bytes handed to the CPU or
+-- DMA engine (512 data bytes and the 2 CRC bytes) are run through the CRC.
+-- Including the card's own CRC leaves a remainder of zero, so crc_ok_o is '1'
+-- once all 514 bytes have been received and the remainder is zero.
+--
+-- Bytes are checked when they are delivered rather than when they are clocked
+-- in from the card, so bytes the prefetch has read ahead only count once the
+-- CPU reads them.
 --
 
 library ieee;
@@ -153,12 +205,14 @@ use ieee.std_logic_unsigned.all;
 
 entity sdcard is
 port
-   ( clk_i              : in     std_logic -- 25MHz max
+   ( clk_i              : in     std_logic -- 50MHz max
    ; reset_n_i          : in     std_logic -- active low
 
    -- SD-card control
    ; slow_clk_i         : in     std_logic -- '1' = use slow SPI clock
+   ; high_clk_i         : in     std_logic -- '1' = use high SPI clock, slow_clk_i must be '0'
    ; spi_ss_n_i         : in     std_logic -- '0' to select the SD-card device
+   ; prefetch_i         : in     std_logic -- '1' = read ahead into the FIFO after a CPU read
 
    -- CPU
    ; cs_n_i             : in     std_logic -- '0' start an 8-bit transfer, hold low until wait_n_o = '1'
@@ -167,6 +221,16 @@ port
    ; data_i             : in     std_logic_vector( 7 downto 0)
    ; data_o             : out    std_logic_vector( 7 downto 0)
 
+   -- DMA
+   ; dma_en_i           : in     std_logic -- '1' = DMA owns the controller
+   ; dma_req_i          : in     std_logic -- '1' = start a read transfer
+   ; dma_ack_o          : out    std_logic -- '1' = dma_data_o is valid, wait for dma_req_i = '0'
+   ; dma_data_o         : out    std_logic_vector( 7 downto 0)
+
+   -- Data block CRC
+   ; crc_clr_i          : in     std_logic -- '1' = restart the check, hold until the token is taken
+   ; crc_ok_o           : out    std_logic -- '1' = 514 bytes checked and the CRC is good
+
    -- SD-card SPI
    ; spi_cs_n_o         : out    std_logic
    ; spi_sclk_o         : out    std_logic
@@ -177,7 +241,7 @@ end entity;
 
 architecture rtl of sdcard is
 
-   type state_t is (st_idle, st_clk1, st_clk0, st_wait_eoc);
+   type state_t is (st_idle, st_clk1, st_clk0, st_wait_eoc, st_dma_ack);
    signal state_r, state_x : state_t;
 
    signal rt_en_s                : std_logic := '1';
@@ -188,15 +252,56 @@ architecture rtl of sdcard is
    signal din_r, din_x           : std_logic := '0';
 
    signal wait_n_r, wait_n_x     : std_logic := '1';
+   signal done_r, done_x         : std_logic := '0'; -- CPU access satisfied, wait for end of cycle
 
    signal spi_ss_n_r             : std_logic := '1';
    signal clk_r, clk_x           : std_logic := '0';
    signal clk_en_s               : std_logic := '1';
 
-   -- Slow clock divides the input clock by 32.
-   signal slow_clk_r, slow_clk_x : unsigned( 4 downto 0) := "00000";
+   -- Slow clock divides the input clock by 64, fast clock uses the LSb to
+   -- divide the input clock by 2.  The high clock does not divide.
+   signal slow_clk_r, slow_clk_x : unsigned( 5 downto 0) := "000000";
+   signal div_s                  : unsigned( 5 downto 0);
    signal slow_en_s              : std_logic := '0';
 
+   -- Prefetch FIFO.
+   type fifo_t is array (0 to 3) of std_logic_vector( 7 downto 0);
+   signal fifo_r                 : fifo_t;
+   signal fifo_wr_r              : unsigned( 1 downto 0) := "00";
+   signal fifo_rd_r              : unsigned( 1 downto 0) := "00";
+   signal fifo_cnt_r             : unsigned( 2 downto 0) := "000";
+
+   signal pf_ok_s                : std_logic;
+   signal pf_r, pf_x             : std_logic := '0'; -- current transfer is a prefetch
+   signal dma_r, dma_x           : std_logic := '0'; -- current transfer is for the DMA
+   signal arm_r, arm_x           : std_logic := '0'; -- prefetch armed by a CPU read
+   signal pop_r, pop_x           : std_logic := '0'; -- pop at the end of the CPU cycle
+   signal pop_s                  : std_logic;
+   signal push_s                 : std_logic;
+   signal flush_s                : std_logic;
+
+   -- Data block CRC, counts the bytes delivered up to 512 data + 2 CRC.
+   signal crc_r                  : std_logic_vector(15 downto 0) := x"0000";
+   signal crc_cnt_r              : unsigned( 9 downto 0) := (others => '0');
+   signal crc_en_s               : std_logic;
+   signal crc_din_s              : std_logic_vector( 7 downto 0);
+
+   -- CRC-16/XMODEM of one more byte, MSb first.
+   function crc16_f(crc : std_logic_vector(15 downto 0); d : std_logic_vector(7 downto 0))
+   return std_logic_vector is
+      variable c : std_logic_vector(15 downto 0);
+   begin
+      c := crc;
+      for i in 7 downto 0 loop
+         if (c(15) xor d(i)) = '1' then
+            c := (c(14 downto 0) & '0') xor x"1021";
+         else
+            c := c(14 downto 0) & '0';
+         end if;
+      end loop;
+      return c;
+   end function;
+
 
 begin
 
@@ -209,45 +314,127 @@ begin
    -- for other SPI interfaces, i.e. tri-state.
    spi_mosi_o <= shift_r(7);
 
-   -- Data to the CPU and wait signal.
-   data_o   <= shift_r;
+   -- Data to the CPU and wait signal.  The FIFO is only ever non-empty when
+   -- prefetching, otherwise the data comes from the shift register.
+   data_o   <= fifo_r(to_integer(fifo_rd_r)) when fifo_cnt_r /= 0 else shift_r;
    wait_n_o <= wait_n_r;
 
+   -- DMA data and handshake.
+   dma_data_o  <= shift_r;
+   dma_ack_o   <= '1' when state_r = st_dma_ack else '0';
+
    -- Always write >FF on MOSI during a read operation.  The SD-card sees this
    -- values as a dummy byte and will ignore it.
    dmux_s <= data_i when wr_n_i = '0' else (others => '1');
 
+   -- Prefetch can only run with the card selected, both requested and actual,
+   -- and never during DMA.
+   pf_ok_s <= prefetch_i and (not spi_ss_n_i) and (not spi_ss_n_r) and (not dma_en_i);
+
+   -- The FIFO entry given to the CPU is removed at the end of its IO cycle.
+   pop_s <= '1' when pop_r = '1' and cs_n_i = '1' and fifo_cnt_r /= 0 else '0';
+
+   -- A byte is delivered when popped from the FIFO, on the first clock of a
+   -- direct CPU read in st_wait_eoc, or when the DMA engine releases it.
+   crc_en_s <=
+      '1' when pop_s = '1' else
+      '1' when state_r = st_wait_eoc and cs_n_i = '0' and done_r = '0' and wr_n_i = '1' else
+      '1' when state_r = st_dma_ack and dma_req_i = '0' else
+      '0';
+
+   crc_din_s <= fifo_r(to_integer(fifo_rd_r)) when pop_s = '1' else shift_r;
+
+   crc_ok_o <= '1' when crc_cnt_r = 514 and crc_r = x"0000" else '0';
+
    process ( state_r, shift_r, count_r, din_r, clk_r, dmux_s,
-             cs_n_i, data_i, spi_miso_i )
+             done_r, pf_r, dma_r, arm_r, pop_r, pf_ok_s, fifo_cnt_r, spi_ss_n_r,
+             cs_n_i, wr_n_i, prefetch_i, dma_en_i, dma_req_i, spi_miso_i )
    begin
 
       state_x     <= state_r;
       shift_x     <= shift_r;
       count_x     <= count_r;
       din_x       <= din_r;
+      done_x      <= done_r;
+      pf_x        <= pf_r;
+      dma_x       <= dma_r;
+      arm_x       <= arm_r;
+      pop_x       <= pop_r;
 
       clk_x       <= clk_r;         -- clock hold state
       wait_n_x    <= '1';           -- not waiting
       slow_en_s   <= '0';           -- not a slow clock state
+      push_s      <= '0';
+      flush_s     <= spi_ss_n_r;    -- discard the FIFO when the card is deselected
+
+      if prefetch_i = '0' or spi_ss_n_r = '1' then
+         arm_x    <= '0';
+      end if;
+
+      -- CPU side.  An access is pending until satisfied, either by the FIFO
+      -- or by a direct transfer (st_wait_eoc).
+      if cs_n_i = '1' then
+         done_x   <= '0';
+         pop_x    <= '0';
+
+      elsif done_r = '0' then
+         wait_n_x <= '0';           -- wait until satisfied
+
+         if wr_n_i = '0' then
+            flush_s  <= '1';        -- writes discard any read-ahead
+            arm_x    <= '0';
+
+         elsif fifo_cnt_r /= 0 then
+            wait_n_x <= '1';        -- read served from the FIFO, no wait
+            done_x   <= '1';
+            pop_x    <= '1';
+            arm_x    <= pf_ok_s;
+         end if;
+      end if;
 
       case state_r is
       when st_idle =>
 
          clk_x          <= '0';     -- clock idle low
 
-         if cs_n_i = '0' then
+         if dma_req_i = '1' then
+
+            -- DMA read, always has priority.
+            state_x     <= st_clk1;
+            shift_x     <= (others => '1');
+            count_x     <= "111";
+            slow_en_s   <= '1';
+            pf_x        <= '0';
+            dma_x       <= '1';
+
+         elsif dma_en_i = '0' and cs_n_i = '0' and done_r = '0' and
+         (wr_n_i = '0' or (fifo_cnt_r = 0 and pf_ok_s = '0')) then
+
+            -- Direct transfer for writes, and reads when not prefetching.
             state_x     <= st_clk1;
-            wait_n_x    <= '0';     -- wait until 8-bit transfer is done
             shift_x     <= dmux_s;  -- load data from CPU during write
             count_x     <= "111";   -- counter load not necessary, but just in case
             slow_en_s   <= '1';     -- slow clock can be enabled
+            pf_x        <= '0';
+            dma_x       <= '0';
+
+         elsif pf_ok_s = '1' and fifo_cnt_r /= 4 and
+         (arm_r = '1' or (cs_n_i = '0' and done_r = '0' and wr_n_i = '1')) then
+
+            -- Read ahead, or the first read that arms the prefetch.
+            state_x     <= st_clk1;
+            shift_x     <= (others => '1');
+            count_x     <= "111";
+            slow_en_s   <= '1';
+            pf_x        <= '1';
+            dma_x       <= '0';
+            arm_x       <= '1';
          end if;
 
       when st_clk1 =>
 
          state_x     <= st_clk0;
          slow_en_s   <= '1';        -- slow clock can be enabled
-         wait_n_x    <= '0';        -- keep waiting
          clk_x       <= '1';        -- clock high
          din_x       <= spi_miso_i; -- latch input data
 
@@ -256,21 +443,37 @@ begin
          state_x     <= st_clk1;
          slow_en_s   <= '1';        -- slow clock can be enabled
          clk_x       <= '0';        -- clock low
-         wait_n_x    <= '0';
 
          -- Shift the data during clock zero.
          shift_x  <= shift_r(6 downto 0) & din_r;
          count_x  <= count_r - 1;
 
          if count_r = 0 then
-            state_x     <= st_wait_eoc;
+            if dma_r = '1' then
+               state_x  <= st_dma_ack;
+            elsif pf_r = '1' then
+               state_x  <= st_idle;
+               push_s   <= '1';     -- prefetched byte goes to the FIFO
+            else
+               state_x  <= st_wait_eoc;
+            end if;
          end if;
 
       when st_wait_eoc =>
 
          -- Wait for the end of this CPU IO cycle.
          if cs_n_i = '1' then
-            state_x <= st_idle;
+            state_x  <= st_idle;
+         else
+            wait_n_x <= '1';
+            done_x   <= '1';
+         end if;
+
+      when st_dma_ack =>
+
+         -- Hold the byte until the DMA engine has taken it.
+         if dma_req_i = '0' then
+            state_x  <= st_idle;
          end if;
 
       end case;
@@ -278,22 +481,25 @@ begin
    end process;
 
 
-   process ( slow_clk_i, slow_en_s, slow_clk_r )
+   -- The fast clock only looks at the LSb of the divider.
+   div_s <= slow_clk_r when slow_clk_i = '1' else "00000" & slow_clk_r(0);
+
+   process ( slow_clk_i, high_clk_i, slow_en_s, slow_clk_r, div_s )
    begin
       rt_en_s     <= '1';           -- enable register-transfer
       clk_en_s    <= '1';           -- no clock delay
       slow_clk_x  <= slow_clk_r;
 
-      if slow_clk_i = '1' and slow_en_s = '1' then
-         if slow_clk_r /= 0 then
+      if (slow_clk_i = '1' or high_clk_i = '0') and slow_en_s = '1' then
+         if div_s /= 0 then
             rt_en_s <= '0';
          end if;
 
-         if slow_clk_r /= 1 then
+         if div_s /= 1 then
             clk_en_s <= '0';
          end if;
 
-         -- Divide the input clock to produce the slow clock.
+         -- Divide the input clock to produce the slow or fast clock.
          slow_clk_x <= slow_clk_r - 1;
       end if;
    end process;
@@ -311,8 +517,20 @@ begin
             din_r       <= '0';
 
             wait_n_r    <= '1';
+            done_r      <= '0';
             spi_ss_n_r  <= '1';
             clk_r       <= '0';
+
+            pf_r        <= '0';
+            dma_r       <= '0';
+            arm_r       <= '0';
+            pop_r       <= '0';
+            fifo_wr_r   <= "00";
+            fifo_rd_r   <= "00";
+            fifo_cnt_r  <= "000";
+
+            crc_r       <= (others => '0');
+            crc_cnt_r   <= (others => '0');
          else
 
             -- Limit register-transfer based on the slow clock setting
@@ -321,6 +539,8 @@ begin
                state_r  <= state_x;
                shift_r  <= shift_x;
                count_r  <= count_x;
+               pf_r     <= pf_x;
+               dma_r    <= dma_x;
             end if;
 
             -- Delay the clock to place the transition in the middle of
@@ -333,7 +553,45 @@ begin
             din_r       <= din_x;
 
             wait_n_r    <= wait_n_x;
-            spi_ss_n_r  <= spi_ss_n_i;
+            done_r      <= done_x;
+            arm_r       <= arm_x;
+            pop_r       <= pop_x;
+
+            -- The chip-select only changes between transfers.
+            if state_r = st_idle then
+               spi_ss_n_r  <= spi_ss_n_i;
+            end if;
+
+            -- Prefetch FIFO.  A push is only real when the FSM advances.
+            if flush_s = '1' then
+               fifo_wr_r   <= "00";
+               fifo_rd_r   <= "00";
+               fifo_cnt_r  <= "000";
+            else
+               if push_s = '1' and rt_en_s = '1' then
+                  fifo_r(to_integer(fifo_wr_r)) <= shift_x;
+                  fifo_wr_r   <= fifo_wr_r + 1;
+               end if;
+
+               if pop_s = '1' then
+                  fifo_rd_r   <= fifo_rd_r + 1;
+               end if;
+
+               if push_s = '1' and rt_en_s = '1' and pop_s = '0' then
+                  fifo_cnt_r  <= fifo_cnt_r + 1;
+               elsif (push_s = '0' or rt_en_s = '0') and pop_s = '1' then
+                  fifo_cnt_r  <= fifo_cnt_r - 1;
+               end if;
+            end if;
+
+            -- Data block CRC, stops after the 2 CRC bytes.
+            if crc_clr_i = '1' then
+               crc_r       <= (others => '0');
+               crc_cnt_r   <= (others => '0');
+            elsif crc_en_s = '1' and crc_cnt_r /= 514 then
+               crc_r       <= crc16_f(crc_r, crc_din_s);
+               crc_cnt_r   <= crc_cnt_r + 1;
+            end if;
 
          end if;
       end if;
@@ -0,0 +1,351 @@
+--
+-- SD-card to external SRAM DMA engine.
+--
+
+-- Released under the 3-Clause BSD License:
+--
+-- Copyright 2020 Phoenix contributors
+--
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+--
+-- 1. Redistributions of source code must retain the above copyright notice,
+-- this list of conditions and the following disclaimer.
+--
+-- 2. Redistributions in binary form must reproduce the above copyright
+-- notice, this list of conditions and the following disclaimer in the
+-- documentation and/or other materials provided with the distribution.
+--
+-- 3. Neither the name of the copyright holder nor the names of its
+-- contributors may be used to endorse or promote products derived from this
+-- software without specific prior written permission.
+--
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+-- ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+-- LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+-- CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+-- SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+-- INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+-- CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+-- ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+-- POSSIBILITY OF SUCH DAMAGE.
+
+--
+-- Moves 512-byte data blocks from the SD-card directly into the 512K external
+-- SRAM, so the Z80 does not have to pass every byte through its registers.
+--
+-- The host sends the read command (normally CMD18, READ_MULTIPLE_BLOCK) and
+-- checks the R1 response as usual, with the card left selected.  Then the
+-- destination and block count are set and the DMA is started.  For each block
+-- the engine waits for the start block token (>FE), writes the 512 data bytes
+-- to consecutive SRAM addresses, and checks the 16-bit CRC with the sdcard
+-- CRC checker.  When the count reaches zero the engine goes idle, and the host
+-- sends CMD12 to stop the transmission and deselects the card.
+--
+-- An error token, no token within about 168ms, or a bad CRC stops the
+-- transfer with the error flag set.  The destination and count registers track the transfer, so
+-- the host can read them to show progress, and after an error they indicate
+-- the block that failed.
+--
+-- SD-card bytes are read through the sdcard DMA handshake, and the SRAM is
+-- written through the ext512x8sram DMA port between CPU memory cycles.  While
+-- busy_o is '1' CPU access to the SD-card data port is held off.
+--
+-- Registers (cpu_addr_i is the LS nibble of the I/O port):
+--
+--  >5A  WWWWWWWW (W) Destination 512-byte block, bits 7..0 (SRAM A16..A9)
+--       RRRRRRRR (R) Current block
+--  >5B  xxxxxxWW (W) Destination 512-byte block, bits 9..8 (SRAM A18..A17)
+--       000000RR (R) Current block
+--  >5C  WWWWWWWW (W) Block count, bits 7..0
+--       RRRRRRRR (R) Blocks remaining
+--  >5D  xxxxxWWW (W) Block count, bits 10..8, 1024 blocks max (512K)
+--       00000RRR (R) Blocks remaining
+--  >5E  xxxxxxxW (W) 1 = start, ignored when busy or the count is zero
+--       xxxxxxWx (W) 1 = abort
+--       RR000000 (R) >80 busy, >40 error
+--
+-- The address and count registers can only be written while the engine is
+-- idle.
+--
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity sddma is
+port
+   ( clk_i              : in     std_logic -- system clock
+   ; reset_n_i          : in     std_logic -- active low
+
+   -- CPU
+   ; cs_n_i             : in     std_logic -- '0' for the duration of a register access
+   ; wr_n_i             : in     std_logic
+   ; addr_i             : in     std_logic_vector( 3 downto 0)
+   ; data_i             : in     std_logic_vector( 7 downto 0)
+   ; data_o             : out    std_logic_vector( 7 downto 0)
+   ; busy_o             : out    std_logic -- '1' while the DMA owns the SD-card
+
+   -- SD-card byte reads
+   ; sd_req_o           : out    std_logic
+   ; sd_ack_i           : in     std_logic
+   ; sd_data_i          : in     std_logic_vector( 7 downto 0)
+   ; sd_crc_clr_o       : out    std_logic
+   ; sd_crc_ok_i        : in     std_logic
+
+   -- SRAM byte writes
+   ; ram_req_o          : out    std_logic
+   ; ram_ack_i          : in     std_logic
+   ; ram_addr_o         : out    std_logic_vector(18 downto 0)
+   ; ram_data_o         : out    std_logic_vector( 7 downto 0)
+);
+end entity;
+
+architecture rtl of sddma is
+
+   type state_t is (st_idle, st_token, st_data, st_ram, st_crc, st_check);
+   signal state_r, state_x       : state_t;
+
+   signal blk_r, blk_x           : unsigned( 9 downto 0) := (others => '0');
+   signal cnt_r, cnt_x           : unsigned(10 downto 0) := (others => '0');
+   signal byte_r, byte_x         : unsigned( 8 downto 0) := (others => '0');
+   signal crc_r, crc_x           : std_logic := '0'; -- second CRC byte
+   signal data_r, data_x         : std_logic_vector( 7 downto 0) := (others => '0');
+   signal err_r, err_x           : std_logic := '0';
+
+   -- Start block token timeout, 2^22 clocks is about 168ms at 25MHz.
+   signal tmo_r, tmo_x           : unsigned(21 downto 0) := (others => '1');
+
+   signal sd_req_r, sd_req_x     : std_logic := '0';
+   signal ram_req_r, ram_req_x   : std_logic := '0';
+
+   -- The CPU select is held for the whole IO cycle, so only act on the
+   -- first clock of a control register write.
+   signal cs_n_r                 : std_logic := '1';
+   signal busy_s                 : std_logic;
+
+
+begin
+
+   busy_s      <= '0' when state_r = st_idle else '1';
+   busy_o      <= busy_s;
+
+   sd_req_o    <= sd_req_r;
+   ram_req_o   <= ram_req_r;
+   ram_addr_o  <= std_logic_vector(blk_r & byte_r);
+   ram_data_o  <= data_r;
+
+   -- Restart the sdcard CRC check until the start block token has been taken,
+   -- which is when the first data byte is requested.
+   sd_crc_clr_o <= '1' when state_r = st_token else
+                   '1' when state_r = st_data and byte_r = 0 and sd_req_r = '0' else
+                   '0';
+
+   -- Register reads.
+   process ( addr_i, blk_r, cnt_r, busy_s, err_r )
+   begin
+      case addr_i is
+      when x"A"   => data_o <= std_logic_vector(blk_r(7 downto 0));
+      when x"B"   => data_o <= "000000" & std_logic_vector(blk_r(9 downto 8));
+      when x"C"   => data_o <= std_logic_vector(cnt_r(7 downto 0));
+      when x"D"   => data_o <= "00000" & std_logic_vector(cnt_r(10 downto 8));
+      when others => data_o <= busy_s & err_r & "000000";
+      end case;
+   end process;
+
+
+   process ( state_r, blk_r, cnt_r, byte_r, crc_r, data_r, err_r, tmo_r
+           , sd_req_r, ram_req_r, cs_n_r, busy_s
+           , cs_n_i, wr_n_i, addr_i, data_i, sd_ack_i, sd_data_i, sd_crc_ok_i, ram_ack_i )
+   begin
+
+      state_x     <= state_r;
+      blk_x       <= blk_r;
+      cnt_x       <= cnt_r;
+      byte_x      <= byte_r;
+      crc_x       <= crc_r;
+      data_x      <= data_r;
+      err_x       <= err_r;
+      tmo_x       <= tmo_r;
+      sd_req_x    <= sd_req_r;
+      ram_req_x   <= ram_req_r;
+
+      -- Register writes.
+      if cs_n_i = '0' and wr_n_i = '0' then
+         case addr_i is
+         when x"A" =>
+            if busy_s = '0' then
+               blk_x(7 downto 0) <= unsigned(data_i);
+            end if;
+
+         when x"B" =>
+            if busy_s = '0' then
+               blk_x(9 downto 8) <= unsigned(data_i(1 downto 0));
+            end if;
+
+         when x"C" =>
+            if busy_s = '0' then
+               cnt_x(7 downto 0) <= unsigned(data_i);
+            end if;
+
+         when x"D" =>
+            if busy_s = '0' then
+               cnt_x(10 downto 8) <= unsigned(data_i(2 downto 0));
+            end if;
+
+         when x"E" =>
+            if cs_n_r = '1' then
+               if data_i(1) = '1' then
+                  -- Abort.  A byte in progress in the SD-card controller or
+                  -- SRAM finishes on its own.
+                  state_x     <= st_idle;
+                  sd_req_x    <= '0';
+                  ram_req_x   <= '0';
+
+               elsif data_i(0) = '1' and busy_s = '0' and cnt_r /= 0 then
+                  state_x     <= st_token;
+                  tmo_x       <= (others => '1');
+                  err_x       <= '0';
+               end if;
+            end if;
+
+         when others => null;
+         end case;
+      end if;
+
+      case state_r is
+
+      when st_idle =>
+         null;
+
+      when st_token =>
+
+         -- Poll for the start block token.
+         tmo_x <= tmo_r - 1;
+
+         if sd_req_r = '0' and sd_ack_i = '0' then
+            sd_req_x <= '1';
+
+         elsif sd_req_r = '1' and sd_ack_i = '1' then
+            sd_req_x <= '0';
+
+            if sd_data_i = x"FE" then
+               state_x  <= st_data;
+               byte_x   <= (others => '0');
+            elsif sd_data_i /= x"FF" then
+               state_x  <= st_idle;    -- error token
+               err_x    <= '1';
+            end if;
+         end if;
+
+         if tmo_r = 0 then
+            state_x  <= st_idle;
+            sd_req_x <= '0';
+            err_x    <= '1';
+         end if;
+
+      when st_data =>
+
+         if sd_req_r = '0' and sd_ack_i = '0' then
+            sd_req_x <= '1';
+
+         elsif sd_req_r = '1' and sd_ack_i = '1' then
+            sd_req_x <= '0';
+            data_x   <= sd_data_i;
+            state_x  <= st_ram;
+         end if;
+
+      when st_ram =>
+
+         ram_req_x <= '1';
+
+         if ram_req_r = '1' and ram_ack_i = '1' then
+            ram_req_x   <= '0';
+            byte_x      <= byte_r + 1;
+
+            if byte_r = 511 then
+               state_x  <= st_crc;
+               crc_x    <= '0';
+            else
+               state_x  <= st_data;
+            end if;
+         end if;
+
+      when st_crc =>
+
+         -- Read the 16-bit CRC through the checker.
+         if sd_req_r = '0' and sd_ack_i = '0' then
+            sd_req_x <= '1';
+
+         elsif sd_req_r = '1' and sd_ack_i = '1' then
+            sd_req_x <= '0';
+            crc_x    <= '1';
+
+            if crc_r = '1' then
+               state_x  <= st_check;
+            end if;
+         end if;
+
+      when st_check =>
+
+         -- The last CRC byte is checked when the sdcard sees the request
+         -- drop, then move on to the next block.  A bad block leaves the
+         -- address and count pointing at it.
+         if sd_ack_i = '0' then
+            if sd_crc_ok_i = '0' then
+               state_x  <= st_idle;
+               err_x    <= '1';
+            else
+               blk_x    <= blk_r + 1;
+               cnt_x    <= cnt_r - 1;
+               tmo_x    <= (others => '1');
+
+               if cnt_r = 1 then
+                  state_x  <= st_idle;
+               else
+                  state_x  <= st_token;
+               end if;
+            end if;
+         end if;
+
+      end case;
+   end process;
+
+
+   process ( clk_i )
+   begin
+      if rising_edge(clk_i) then
+         if reset_n_i = '0' then
+
+            state_r     <= st_idle;
+            blk_r       <= (others => '0');
+            cnt_r       <= (others => '0');
+            byte_r      <= (others => '0');
+            crc_r       <= '0';
+            err_r       <= '0';
+            tmo_r       <= (others => '1');
+            sd_req_r    <= '0';
+            ram_req_r   <= '0';
+            cs_n_r      <= '1';
+
+         else
+
+            state_r     <= state_x;
+            blk_r       <= blk_x;
+            cnt_r       <= cnt_x;
+            byte_r      <= byte_x;
+            crc_r       <= crc_x;
+            data_r      <= data_x;
+            err_r       <= err_x;
+            tmo_r       <= tmo_x;
+            sd_req_r    <= sd_req_x;
+            ram_req_r   <= ram_req_x;
+            cs_n_r      <= cs_n_i;
+
+         end if;
+      end if;
+   end process;
+
+end rtl;
@@ -0,0 +1,189 @@
+--
+-- Configuration flash SPI master, byte-wide with CPU-wait signal.
+--
+
+-- Released under the 3-Clause BSD License:
+--
+-- Copyright 2020 Phoenix contributors
+--
+-- Redistribution and use in source and binary forms, with or without
+-- modification, are permitted provided that the following conditions are met:
+--
+-- 1. Redistributions of source code must retain the above copyright notice,
+-- this list of conditions and the following disclaimer.
+--
+-- 2. Redistributions in binary form must reproduce the above copyright
+-- notice, this list of conditions and the following disclaimer in the
+-- documentation and/or other materials provided with the distribution.
+--
+-- 3. Neither the name of the copyright holder nor the names of its
+-- contributors may be used to endorse or promote products derived from this
+-- software without specific prior written permission.
+--
+-- THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+-- AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+-- IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+-- ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+-- LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+-- CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+-- SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+-- INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+-- CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+-- ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+-- POSSIBILITY OF SUCH DAMAGE.
+
+--
+-- The FPGA configuration flash holds the core, and the ROM loader rewrites
+-- it from the SD-card.  This is the same CPU interface as the SD-card SPI
+-- (sdcard.vhd) without the clock options, prefetch or DMA: every IN or OUT
+-- on the data port clocks one byte through the flash, so a page can be
+-- programmed with OTIR and read with INIR.
+--
+-- The FSM is clocked by the 50MHz clock from the system PLL and advances
+-- every other input clock, one SPI clock phase per state, for a 12.5MHz SPI
+-- clock.  That is within the limit of the READ (>03) command on any serial
+-- flash, and FAST_READ (>0B) works the same with one dummy byte.  A byte
+-- takes 640ns, so a Z80 IO instruction sees at most one extra wait-state.
+--
+-- SPI Mode 0 is implemented:
+--
+-- Clock Polarity (CPOL):  0 idle low
+-- Clock Phase    (CPHA):  0 sample on rising edge
+-- Data transfer        :  MSbit first
+--
+-- The host controls the flash chip-select separately, and holds it low for
+-- the instruction, address and data bytes of one command.  The select only
+-- changes between transfers.  A write sends the CPU byte, a read sends >FF
+-- and returns the byte shifted in.
+--
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+entity spiflash is
+port
+   ( clk_i              : in     std_logic -- 50MHz max
+   ; reset_n_i          : in     std_logic -- active low
+
+   -- Flash control
+   ; spi_ss_n_i         : in     std_logic -- '0' to select the flash device
+
+   -- CPU
+   ; cs_n_i             : in     std_logic -- '0' start an 8-bit transfer, hold low until wait_n_o = '1'
+   ; wait_n_o           : out    std_logic -- '0' during transfer, CPU should wait
+   ; wr_n_i             : in     std_logic -- '0' for write, >FF is written during a read
+   ; data_i             : in     std_logic_vector( 7 downto 0)
+   ; data_o             : out    std_logic_vector( 7 downto 0)
+
+   -- Flash SPI
+   ; spi_cs_n_o         : out    std_logic
+   ; spi_sclk_o         : out    std_logic
+   ; spi_mosi_o         : out    std_logic
+   ; spi_miso_i         : in     std_logic
+);
+end entity;
+
+architecture rtl of spiflash is
+
+   type state_t is (st_idle, st_clk1, st_clk0, st_wait_eoc);
+   signal state_r                : state_t := st_idle;
+
+   signal shift_r                : std_logic_vector( 7 downto 0) := x"FF";
+   signal count_r                : unsigned( 2 downto 0) := "111";
+   signal din_r                  : std_logic := '0';
+   signal wait_n_r               : std_logic := '1';
+
+   signal spi_ss_n_r             : std_logic := '1';
+   signal clk_r                  : std_logic := '0';
+   signal div_r                  : std_logic := '0'; -- FSM advances when '1'
+
+begin
+
+   spi_cs_n_o <= spi_ss_n_r;
+   spi_sclk_o <= clk_r;
+   spi_mosi_o <= shift_r(7);
+
+   data_o   <= shift_r;
+   wait_n_o <= wait_n_r;
+
+   process (clk_i)
+   begin
+      if rising_edge(clk_i) then
+         if reset_n_i = '0' then
+
+            state_r     <= st_idle;
+            shift_r     <= (others => '1');
+            count_r     <= (others => '1');
+            din_r       <= '0';
+            wait_n_r    <= '1';
+            spi_ss_n_r  <= '1';
+            clk_r       <= '0';
+            div_r       <= '0';
+         else
+
+            div_r       <= not div_r;
+            wait_n_r    <= '1';     -- not waiting
+
+            case state_r is
+            when st_idle =>
+
+               clk_r       <= '0';  -- clock idle low
+               spi_ss_n_r  <= spi_ss_n_i;
+
+               if cs_n_i = '0' then
+                  wait_n_r <= '0';
+
+                  if div_r = '1' then
+                     state_r  <= st_clk1;
+                     count_r  <= "111";
+
+                     if wr_n_i = '0' then
+                        shift_r  <= data_i;
+                     else
+                        shift_r  <= (others => '1');
+                     end if;
+                  end if;
+               end if;
+
+            when st_clk1 =>
+
+               wait_n_r <= '0';
+
+               if div_r = '1' then
+                  state_r  <= st_clk0;
+                  clk_r    <= '1';        -- clock high
+                  din_r    <= spi_miso_i; -- latch input data
+               end if;
+
+            when st_clk0 =>
+
+               wait_n_r <= '0';
+
+               if div_r = '1' then
+                  state_r  <= st_clk1;
+                  clk_r    <= '0';        -- clock low
+
+                  -- Shift the data during clock zero.
+                  shift_r  <= shift_r(6 downto 0) & din_r;
+                  count_r  <= count_r - 1;
+
+                  if count_r = 0 then
+                     state_r  <= st_wait_eoc;
+                  end if;
+               end if;
+
+            when st_wait_eoc =>
+
+               -- Wait for the end of this CPU IO cycle.
+               if cs_n_i = '1' then
+                  state_r  <= st_idle;
+               end if;
+
+            end case;
+
+         end if;
+      end if;
+   end process;
+
+end rtl;
@@ -131,14 +131,13 @@ port
    ; sd_miso_i          : in     std_logic
    ; sd_cd_n_i          : in     std_logic -- Card detect, active low, ext pull-up
 
-   -- Flash
--- Unused. MH June 2020.
---   ; flash_cs_n_o       : out    std_logic := '1'
---   ; flash_sclk_o       : out    std_logic := '0'
---   ; flash_mosi_o       : out    std_logic := '0'
---   ; flash_miso_i       : in     std_logic
---   ; flash_wp_o         : out    std_logic := '0'
---   ; flash_hold_o       : out    std_logic := '1'
+   -- Flash, written by the ROM loader to update the core
+   ; flash_cs_n_o       : out    std_logic := '1'
+   ; flash_sclk_o       : out    std_logic := '0'
+   ; flash_mosi_o       : out    std_logic := '0'
+   ; flash_miso_i       : in     std_logic
+   ; flash_wp_o         : out    std_logic := '0'
+   ; flash_hold_o       : out    std_logic := '1'
 
    -- Joystick
    ; joy_p5_o           : out    std_logic
@@ -191,6 +190,7 @@ architecture rtl of phoenix_top is
    -- Clocks and enables
    signal clk_25m0_s       : std_logic;
    signal clk_100m0_s      : std_logic;
+   signal clk_50m0_s       : std_logic;
    signal clock_tmds_s     : std_logic;
    signal clock_tmds_n_s   : std_logic;
 
@@ -198,6 +198,8 @@ architecture rtl of phoenix_top is
    signal clk_3m58_en_r    : std_logic := '0';
    signal cnt3m58_r        : unsigned(2 downto 0) := "000";
    signal cnt3m58_x        : unsigned(2 downto 0);
+   signal clk_7m16_en_r    : std_logic := '0';
+   signal clk_12m5_en_r    : std_logic := '0';
 
    -- Resets
    signal rst_cnt_r        : unsigned(7 downto 0) := (others => '1');
@@ -297,6 +299,7 @@ begin
    , clk_100m0_o        => clk_100m0_s
    , clk_125m0_o        => clock_tmds_s
    , clk_125m0_n_o      => clock_tmds_n_s
+   , clk_50m0_o         => clk_50m0_s
    );
 
 
@@ -334,6 +337,22 @@ begin
    end if;
    end process;
 
+   -- Turbo CPU clock-enables for the loader, twice per 3.58MHz period (4 and
+   -- 3 clocks apart), and every other clock.  The external SRAM needs two
+   -- clocks per access, so 12.5MHz is as fast as the CPU can go, rather than
+   -- a true 4x of 14.3MHz.
+   process ( clk_25m0_s )
+   begin
+   if rising_edge(clk_25m0_s) then
+      if cnt3m58_r = 2 or cnt3m58_r = 6 then
+         clk_7m16_en_r <= '1';
+      else
+         clk_7m16_en_r <= '0';
+      end if;
+      clk_12m5_en_r <= not clk_12m5_en_r;
+   end if;
+   end process;
+
 
    --
    -- The System Reset has multiple sources:
@@ -402,6 +421,12 @@ begin
    rgb_led_o <= "001";
 
 
+   --
+   -- Configuration flash, HOLD is not used
+   --
+   flash_hold_o <= '1';
+
+
    --
    -- ColecoVision Core
    --
@@ -412,7 +437,10 @@ begin
    port map
    ( clk_25m0_i      => clk_25m0_s
    , clk_100m0_i     => clk_100m0_s
+   , clk_50m0_i      => clk_50m0_s
    , clk_3m58_en_i   => clk_3m58_en_s
+   , clk_7m16_en_i   => clk_7m16_en_r
+   , clk_12m5_en_i   => clk_12m5_en_r
    , reset_i         => reset_r -- active high
    , por_n_i         => por_n_r -- active low
    -- Physical controller interface
@@ -455,6 +483,12 @@ begin
    , sd_sclk_o       => sd_sclk_o
    , sd_cs_n_o       => sd_cs_n_o
    , sd_cd_n_i       => sd_cd_n_i -- Card detect, active low.
+   -- Configuration flash SPI
+   , flash_miso_i    => flash_miso_i
+   , flash_mosi_o    => flash_mosi_o
+   , flash_sclk_o    => flash_sclk_o
+   , flash_cs_n_o    => flash_cs_n_o
+   , flash_wp_n_o    => flash_wp_o
    -- Indication
    , led_o           => cv_led_s
    );